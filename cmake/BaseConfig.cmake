@@ -146,6 +146,10 @@ target_compile_definitions(${CMAKE_PROJECT_NAME}_Base INTERFACE "${PROJECT_PREFI
 target_compile_definitions(${CMAKE_PROJECT_NAME}_Base INTERFACE "${PROJECT_PREFIX}_MINOR=\"${CMAKE_PROJECT_VERSION_MINOR}\"")
 target_compile_definitions(${CMAKE_PROJECT_NAME}_Base INTERFACE "${PROJECT_PREFIX}_PATCH=\"${CMAKE_PROJECT_VERSION_PATCH}\"")
 target_compile_definitions(${CMAKE_PROJECT_NAME}_Base INTERFACE ${PROJECT_PREFIX}_AUTHOR="Silmaen")
+set(${PROJECT_PREFIX}_LOG_MIN_LEVEL 0 CACHE STRING
+        "Lowest log level compiled in (0: Trace, 1: Debug, 2: Info, 3: Warning, 4: Error, 5: Critical)")
+target_compile_definitions(${CMAKE_PROJECT_NAME}_Base INTERFACE
+        ${PROJECT_PREFIX}_LOG_MIN_LEVEL=${${PROJECT_PREFIX}_LOG_MIN_LEVEL})
 
 if (${${PROJECT_PREFIX}_IS_GENERATOR_MULTI_CONFIG})
     target_compile_definitions(${CMAKE_PROJECT_NAME}_Base INTERFACE ${PROJECT_PREFIX}_$<IF:$<CONFIG:Debug>,DEBUG,RELEASE>)
@@ -0,0 +1,391 @@
+/**
+ * @file Autosave.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "Autosave.h"
+
+#include "BinaryIO.h"
+#include "Log.h"
+#include "utilities.h"
+
+#ifdef EVL_PLATFORM_WINDOWS
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
+namespace evl::core {
+
+using namespace binary;
+
+namespace {
+/// Magic bytes at the start of a log.
+constexpr std::string_view g_magic = "EVLWALOG";
+/// Version of the log format.
+constexpr uint16_t g_version = 2;
+/// Size of the log header.
+constexpr size_t g_headerSize = g_magic.size() + sizeof(uint16_t);
+/// Name of the marker file holding the path of the active log.
+constexpr std::string_view g_markerName = "autosave.lst";
+/// Name of the log of an event never saved.
+constexpr std::string_view g_unsavedName = "unsaved.lev.wal";
+/// Size of the time at the start of the payload of the timed entries.
+constexpr size_t g_timeSize = sizeof(int64_t);
+
+/// Kind of a log entry (draws, winners and state changes start with the time of the operation).
+enum struct Entry : uint8_t {
+	Base,
+	Draw,
+	CancelPick,
+	Winner,
+	NextState,
+	DisplayRules,
+	Undo,
+	Redo,
+	Seek,
+};
+
+/**
+ * @brief FNV-1a checksum of an entry.
+ * @param iKind The kind of entry.
+ * @param iPayload The payload.
+ * @return The checksum.
+ */
+auto checksum(const Entry iKind, const std::string_view iPayload) -> uint32_t {
+	uint32_t hash = 0x811C9DC5U;
+	hash = (hash ^ static_cast<uint8_t>(iKind)) * 0x01000193U;
+	for (const char c: iPayload) hash = (hash ^ static_cast<uint8_t>(c)) * 0x01000193U;
+	return hash;
+}
+
+/**
+ * @brief Append an entry: kind, payload size, payload and checksum.
+ * @param oBuffer The buffer.
+ * @param iKind The kind of entry.
+ * @param iPayload The payload.
+ */
+void putEntry(std::vector<char>& oBuffer, const Entry iKind, const std::string_view iPayload = {}) {
+	oBuffer.push_back(static_cast<char>(iKind));
+	putLittleEndian(oBuffer, static_cast<uint32_t>(iPayload.size()));
+	oBuffer.insert(oBuffer.end(), iPayload.begin(), iPayload.end());
+	putLittleEndian(oBuffer, checksum(iKind, iPayload));
+}
+
+/**
+ * @brief Append a timed entry: the time of a record then its data.
+ * @param oBuffer The buffer.
+ * @param iKind The kind of entry.
+ * @param iRecord The record.
+ * @param iData The data.
+ */
+void putTimedEntry(std::vector<char>& oBuffer, const Entry iKind, const Journal::Record& iRecord,
+				   const std::string_view iData = {}) {
+	std::vector<char> payload;
+	putTime(payload, iRecord.time);
+	payload.insert(payload.end(), iData.begin(), iData.end());
+	putEntry(oBuffer, iKind, {payload.data(), payload.size()});
+}
+
+auto markerPath() -> std::filesystem::path { return getExecPath() / g_markerName; }
+
+void writeMarker(const std::filesystem::path& iLog) {
+	const auto log = iLog.u8string();
+	std::ofstream(markerPath(), std::ios::out | std::ios::binary | std::ios::trunc)
+			.write(reinterpret_cast<const char*>(log.data()), static_cast<std::streamsize>(log.size()));
+}
+
+auto openFile(const std::filesystem::path& iPath, const bool iAppend) -> std::FILE* {
+#ifdef EVL_PLATFORM_WINDOWS
+	return _wfopen(iPath.c_str(), iAppend ? L"ab" : L"wb");
+#else
+	return std::fopen(iPath.c_str(), iAppend ? "ab" : "wb");
+#endif
+}
+
+/**
+ * @brief Write a buffer and wait for the disk.
+ * @param iFile The file.
+ * @param iBuffer The bytes.
+ * @return True if everything is on the disk.
+ */
+auto writeSync(std::FILE* iFile, const std::span<const char> iBuffer) -> bool {
+	if (std::fwrite(iBuffer.data(), 1, iBuffer.size(), iFile) != iBuffer.size() || std::fflush(iFile) != 0)
+		return false;
+#ifdef EVL_PLATFORM_WINDOWS
+	return _commit(_fileno(iFile)) == 0;
+#else
+	return fsync(fileno(iFile)) == 0;
+#endif
+}
+}// namespace
+
+Autosave::Autosave() : m_writer{[this](const std::stop_token& iStop) { run(iStop); }} {}
+
+Autosave::~Autosave() {
+	m_writer.request_stop();
+	m_writer.join();
+	close();
+}
+
+auto Autosave::logPath(const std::filesystem::path& iEventFile) -> std::filesystem::path {
+	if (iEventFile.empty())
+		return getExecPath() / g_unsavedName;
+	auto log = iEventFile;
+	log += g_extension;
+	return log;
+}
+
+auto Autosave::eventPath(const std::filesystem::path& iLog) -> std::filesystem::path {
+	if (iLog.filename() == g_unsavedName)
+		return {};
+	auto file = iLog;
+	file.replace_extension();
+	return file;
+}
+
+auto Autosave::pendingLog() -> std::filesystem::path {
+	std::ifstream marker(markerPath(), std::ios::in | std::ios::binary);
+	if (!marker.is_open())
+		return {};
+	std::string log{std::istreambuf_iterator<char>(marker), std::istreambuf_iterator<char>()};
+	const std::filesystem::path path = std::u8string(log.begin(), log.end());
+	std::error_code error;
+	if (const auto size = std::filesystem::file_size(path, error); error || size <= g_headerSize)
+		return {};
+	return path;
+}
+
+auto Autosave::recover(const std::filesystem::path& iLog, Event& oEvent) -> bool {
+	std::string content;
+	if (!readContent(iLog, content))
+		return false;
+	const std::span data{reinterpret_cast<const uint8_t*>(content.data()), content.size()};
+	if (data.size() < g_headerSize || !content.starts_with(g_magic) ||
+		getLittleEndian<uint16_t>(data, g_magic.size()) != g_version) {
+		log_warn("Journal de sauvegarde '{}' invalide", iLog.string());
+		return false;
+	}
+	Journal journal(oEvent);
+	bool hasBase = false;
+	size_t changes = 0;
+	size_t offset = g_headerSize;
+	while (offset < data.size()) {
+		if (data.size() - offset < 5) {
+			log_warn("Journal de sauvegarde '{}' tronqué", iLog.string());
+			break;
+		}
+		const auto kind = static_cast<Entry>(data[offset]);
+		const auto size = getLittleEndian<uint32_t>(data, offset + 1);
+		if (data.size() - offset - 5 < size + sizeof(uint32_t)) {
+			log_warn("Journal de sauvegarde '{}' tronqué", iLog.string());
+			break;
+		}
+		const size_t start = offset + 5;
+		const std::string_view payload{content.data() + start, size};
+		if (getLittleEndian<uint32_t>(data, start + size) != checksum(kind, payload)) {
+			log_warn("Journal de sauvegarde '{}' corrompu", iLog.string());
+			break;
+		}
+		offset = start + size + sizeof(uint32_t);
+		if (kind == Entry::Base) {
+			std::istringstream stream(std::string(payload), std::ios::in | std::ios::binary);
+			oEvent.read(stream, getSaveVersion());
+			journal.reset();
+			hasBase = true;
+			continue;
+		}
+		if (!hasBase)
+			continue;
+		++changes;
+		// the operations are replayed at their original time
+		const bool timed = size >= g_timeSize;
+		const auto time = timed ? getTime(data, start) : time_point{};
+		switch (kind) {
+			case Entry::Draw:
+				if (size == g_timeSize + 1)
+					journal.draw(static_cast<uint8_t>(payload.back()), time);
+				break;
+			case Entry::CancelPick:
+				journal.cancelPick();
+				break;
+			case Entry::Winner:
+				if (timed)
+					journal.addWinner(std::string(payload.substr(g_timeSize)), time);
+				break;
+			case Entry::NextState:
+				if (timed)
+					journal.nextState(time);
+				break;
+			case Entry::DisplayRules:
+				journal.displayRules();
+				break;
+			case Entry::Undo:
+				journal.undo();
+				break;
+			case Entry::Redo:
+				journal.redo();
+				break;
+			case Entry::Seek:
+				if (size == sizeof(uint64_t))
+					journal.seek(getLittleEndian<uint64_t>(data, start));
+				break;
+			case Entry::Base:
+				break;
+		}
+	}
+	if (hasBase)
+		log_info("Événement récupéré depuis '{}' ({} changements rejoués)", iLog.string(), changes);
+	return hasBase;
+}
+
+auto Autosave::start(const std::filesystem::path& iLog) -> bool {
+	flush();
+	const std::scoped_lock lock(m_mutex);
+	close();
+	m_file = openFile(iLog, false);
+	if (m_file == nullptr) {
+		log_warn("Impossible de créer le journal de sauvegarde '{}'", iLog.string());
+		return false;
+	}
+	m_path = iLog;
+	std::vector<char> header(g_magic.begin(), g_magic.end());
+	putLittleEndian(header, g_version);
+	if (!writeSync(m_file, header))
+		log_warn("Impossible d'écrire le journal de sauvegarde '{}'", iLog.string());
+	writeMarker(m_path);
+	return true;
+}
+
+auto Autosave::moveTo(const std::filesystem::path& iLog) -> bool {
+	flush();
+	const std::scoped_lock lock(m_mutex);
+	if (m_file == nullptr || iLog == m_path)
+		return m_file != nullptr;
+	std::fclose(m_file);
+	m_file = nullptr;
+	std::error_code error;
+	std::filesystem::rename(m_path, iLog, error);
+	if (error) {
+		log_warn("Impossible de déplacer le journal de sauvegarde vers '{}'", iLog.string());
+		m_file = openFile(m_path, true);
+		return false;
+	}
+	m_path = iLog;
+	m_file = openFile(m_path, true);
+	writeMarker(m_path);
+	return m_file != nullptr;
+}
+
+void Autosave::stop() {
+	flush();
+	const std::scoped_lock lock(m_mutex);
+	if (m_file == nullptr)
+		return;
+	close();
+	std::error_code error;
+	std::filesystem::remove(m_path, error);
+	std::filesystem::remove(markerPath(), error);
+	m_path.clear();
+}
+
+void Autosave::record(const Journal& iJournal, const Journal::Change iChange) {
+	const std::scoped_lock lock(m_mutex);
+	if (m_file == nullptr)
+		return;
+	switch (iChange) {
+		case Journal::Change::Reset:
+			putEntry(m_pending, Entry::Base, iJournal.getBase());
+			break;
+		case Journal::Change::Append:
+			{
+				const auto& record = iJournal.getRecords()[iJournal.getPosition() - 1];
+				switch (record.operation) {
+					case Journal::Operation::Draw:
+						putTimedEntry(m_pending, Entry::Draw, record,
+									  {reinterpret_cast<const char*>(&record.number), 1});
+						break;
+					case Journal::Operation::CancelPick:
+						putEntry(m_pending, Entry::CancelPick);
+						break;
+					case Journal::Operation::Winner:
+						putTimedEntry(m_pending, Entry::Winner, record, iJournal.getWinner(record));
+						break;
+					case Journal::Operation::NextState:
+						putTimedEntry(m_pending, Entry::NextState, record);
+						break;
+					case Journal::Operation::DisplayRules:
+						putEntry(m_pending, Entry::DisplayRules);
+						break;
+				}
+				break;
+			}
+		case Journal::Change::Undo:
+			putEntry(m_pending, Entry::Undo);
+			break;
+		case Journal::Change::Redo:
+			putEntry(m_pending, Entry::Redo);
+			break;
+		case Journal::Change::Seek:
+			{
+				std::vector<char> position;
+				putLittleEndian(position, static_cast<uint64_t>(iJournal.getPosition()));
+				putEntry(m_pending, Entry::Seek, {position.data(), position.size()});
+				break;
+			}
+	}
+	m_wakeUp.notify_one();
+}
+
+void Autosave::flush() {
+	std::unique_lock lock(m_mutex);
+	m_flushRequested = true;
+	m_wakeUp.notify_one();
+	m_written.wait(lock, [this] { return m_pending.empty() && !m_writing; });
+	m_flushRequested = false;
+}
+
+auto Autosave::getCommitCount() const -> size_t {
+	const std::scoped_lock lock(m_mutex);
+	return m_commits;
+}
+
+void Autosave::run(const std::stop_token& iStop) {
+	std::unique_lock lock(m_mutex);
+	while (true) {
+		m_wakeUp.wait(lock, iStop, [this] { return !m_pending.empty(); });
+		if (m_pending.empty())
+			return;
+		// group commit: the changes of the next milliseconds share the same fsync
+		if (!m_flushRequested)
+			m_wakeUp.wait_for(lock, iStop, g_commitDelay, [this] { return m_flushRequested; });
+		std::vector<char> buffer;
+		buffer.swap(m_pending);
+		m_writing = true;
+		lock.unlock();
+		commit(buffer);
+		lock.lock();
+		m_writing = false;
+		++m_commits;
+		m_written.notify_all();
+	}
+}
+
+void Autosave::commit(const std::vector<char>& iBuffer) {
+	// the file only changes while the writer is idle (see start, moveTo and stop)
+	if (m_file != nullptr && !writeSync(m_file, iBuffer))
+		log_warn("Impossible d'écrire le journal de sauvegarde '{}'", m_path.string());
+}
+
+void Autosave::close() {
+	if (m_file == nullptr)
+		return;
+	std::fclose(m_file);
+	m_file = nullptr;
+}
+
+}// namespace evl::core
@@ -0,0 +1,163 @@
+/**
+ * @file Autosave.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#pragma once
+
+#include "Journal.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace evl::core {
+
+/**
+ * @brief Class Autosave: crash-safe write-ahead log of the changes of a journal.
+ *
+ * Each change of the journal is encoded in memory and written by a background thread, which groups the
+ * writes of g_commitDelay in a single fsync: the game never waits for the disk. The log starts with the
+ * base state of the journal and is replayed on the next startup if the application did not stop cleanly.
+ * The draws, winners and state changes carry their time: the recovered event keeps its original clock values.
+ *
+ * The path of the active log is kept in a marker file next to the executable, so that a dirty log is found
+ * on startup even if the event has never been saved.
+ */
+class Autosave {
+public:
+	/// Extension added to the event file to get the log file.
+	static constexpr std::string_view g_extension = ".wal";
+	/// Maximal delay between a change and its fsync.
+	static constexpr std::chrono::milliseconds g_commitDelay{50};
+
+	Autosave();
+	/**
+	 * @brief Destructor: the pending changes are written, the log is kept.
+	 */
+	~Autosave();
+	Autosave(const Autosave&) = delete;
+	Autosave(Autosave&&) = delete;
+	auto operator=(const Autosave&) -> Autosave& = delete;
+	auto operator=(Autosave&&) -> Autosave& = delete;
+
+	/**
+	 * @brief Get the log file of an event file.
+	 * @param iEventFile The event file, empty for an event never saved.
+	 * @return The log file.
+	 */
+	static auto logPath(const std::filesystem::path& iEventFile) -> std::filesystem::path;
+
+	/**
+	 * @brief Get the event file of a log file.
+	 * @param iLog The log file.
+	 * @return The event file, empty for an event never saved.
+	 */
+	static auto eventPath(const std::filesystem::path& iLog) -> std::filesystem::path;
+
+	/**
+	 * @brief Get the log left by an application that did not stop cleanly.
+	 * @return The log file, empty if there is nothing to recover.
+	 */
+	static auto pendingLog() -> std::filesystem::path;
+
+	/**
+	 * @brief Rebuild an event from a log.
+	 *
+	 * The replay stops at the first incomplete or corrupted change (write interrupted by the crash).
+	 * @param iLog The log file.
+	 * @param oEvent The rebuilt event.
+	 * @return False if the log has no valid base state.
+	 */
+	static auto recover(const std::filesystem::path& iLog, Event& oEvent) -> bool;
+
+	/**
+	 * @brief Start a new log, replacing the previous one.
+	 *
+	 * The base state is written on the next reset of the journal.
+	 * @param iLog The log file.
+	 * @return False if the file cannot be created.
+	 */
+	auto start(const std::filesystem::path& iLog) -> bool;
+
+	/**
+	 * @brief Move the log (the event has been saved under another name).
+	 * @param iLog The new log file.
+	 * @return False if the log cannot be moved.
+	 */
+	auto moveTo(const std::filesystem::path& iLog) -> bool;
+
+	/**
+	 * @brief Stop the logging after a clean shutdown: the log and the marker are removed.
+	 */
+	void stop();
+
+	/**
+	 * @brief Record a change of the journal (to be used as journal listener).
+	 * @param iJournal The journal.
+	 * @param iChange The change.
+	 */
+	void record(const Journal& iJournal, Journal::Change iChange);
+
+	/**
+	 * @brief Wait until all the recorded changes are on the disk.
+	 */
+	void flush();
+
+	/**
+	 * @brief Get the active log file.
+	 * @return The log file, empty if not started.
+	 */
+	[[nodiscard]] auto getPath() const -> const std::filesystem::path& { return m_path; }
+
+	/**
+	 * @brief Get the number of fsync done.
+	 * @return The number of commits.
+	 */
+	[[nodiscard]] auto getCommitCount() const -> size_t;
+
+private:
+	/**
+	 * @brief Writer thread loop.
+	 * @param iStop The stop token.
+	 */
+	void run(const std::stop_token& iStop);
+	/**
+	 * @brief Write and sync a buffer.
+	 * @param iBuffer The bytes to write.
+	 */
+	void commit(const std::vector<char>& iBuffer);
+	/**
+	 * @brief Close the log file.
+	 */
+	void close();
+
+	/// The log file.
+	std::filesystem::path m_path;
+	/// The open log file.
+	std::FILE* m_file = nullptr;
+	/// Protection of the buffer and the counters.
+	mutable std::mutex m_mutex;
+	/// Wakes up the writer.
+	std::condition_variable_any m_wakeUp;
+	/// Wakes up flush() when the changes are written.
+	std::condition_variable m_written;
+	/// Encoded changes not written yet.
+	std::vector<char> m_pending;
+	/// True while the writer writes outside the lock.
+	bool m_writing = false;
+	/// True when flush() waits.
+	bool m_flushRequested = false;
+	/// Number of fsync.
+	size_t m_commits = 0;
+	/// The writer (last member: joined first).
+	std::jthread m_writer;
+};
+
+}// namespace evl::core
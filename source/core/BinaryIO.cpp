@@ -0,0 +1,107 @@
+/**
+ * @file BinaryIO.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "BinaryIO.h"
+
+#include "Log.h"
+
+#ifdef EVL_PLATFORM_WINDOWS
+#include <io.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace evl::core::binary {
+
+namespace {
+/// Extension of the temporary file of an atomic write.
+constexpr std::string_view g_tempExtension = ".tmp";
+
+/**
+ * @brief Write a file and wait for the disk.
+ * @param iPath The file.
+ * @param iParts The parts of the content.
+ * @return True if everything is on the disk.
+ */
+auto writeSync(const std::filesystem::path& iPath, const std::span<const std::string_view> iParts) -> bool {
+#ifdef EVL_PLATFORM_WINDOWS
+	std::FILE* file = _wfopen(iPath.c_str(), L"wb");
+#else
+	std::FILE* file = std::fopen(iPath.c_str(), "wb");
+#endif
+	if (file == nullptr)
+		return false;
+	bool success = std::ranges::all_of(iParts, [file](const std::string_view iPart) {
+		return std::fwrite(iPart.data(), 1, iPart.size(), file) == iPart.size();
+	});
+	success = success && std::fflush(file) == 0;
+#ifdef EVL_PLATFORM_WINDOWS
+	success = success && _commit(_fileno(file)) == 0;
+#else
+	success = success && fsync(fileno(file)) == 0;
+#endif
+	return std::fclose(file) == 0 && success;
+}
+
+/**
+ * @brief Make the renaming of a file durable.
+ * @param iDirectory The directory of the file.
+ */
+void syncDirectory([[maybe_unused]] const std::filesystem::path& iDirectory) {
+#ifndef EVL_PLATFORM_WINDOWS
+	if (const int dir = open(iDirectory.empty() ? "." : iDirectory.c_str(), O_RDONLY); dir >= 0) {
+		fsync(dir);
+		::close(dir);
+	}
+#endif
+}
+}// namespace
+
+auto contentHash(const std::span<const uint8_t> iData) -> uint64_t {
+	uint64_t hash = 0xCBF29CE484222325ULL;
+	for (const uint8_t c: iData) {
+		hash ^= c;
+		hash *= 0x100000001B3ULL;
+	}
+	return hash;
+}
+
+auto contentHash(const std::string_view iData) -> uint64_t {
+	return contentHash({reinterpret_cast<const uint8_t*>(iData.data()), iData.size()});
+}
+
+auto readContent(const std::filesystem::path& iPath, std::string& oContent) -> bool {
+	std::ifstream file(iPath, std::ios::in | std::ios::binary);
+	if (!file.is_open())
+		return false;
+	oContent.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+	return !file.bad();
+}
+
+auto writeAtomic(const std::filesystem::path& iPath, const std::span<const std::string_view> iParts) -> bool {
+	auto temp = iPath;
+	temp += g_tempExtension;
+	std::error_code error;
+	if (!writeSync(temp, iParts)) {
+		log_warn("Impossible d'écrire le fichier '{}'", temp.string());
+		std::filesystem::remove(temp, error);
+		return false;
+	}
+	std::filesystem::rename(temp, iPath, error);
+	if (error) {
+		log_warn("Impossible de remplacer le fichier '{}': {}", iPath.string(), error.message());
+		std::filesystem::remove(temp, error);
+		return false;
+	}
+	syncDirectory(iPath.parent_path());
+	return true;
+}
+
+}// namespace evl::core::binary
@@ -0,0 +1,113 @@
+/**
+ * @file BinaryIO.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#pragma once
+
+#include "timeFunctions.h"
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Helpers shared by the file formats (events, archives, indexes, packs, logs, settings).
+ */
+namespace evl::core::binary {
+
+/**
+ * @brief Append a fixed-width little-endian integer to a buffer.
+ * @tparam T The integer type.
+ * @param oBuffer The buffer.
+ * @param iValue The value.
+ */
+template<typename T>
+void putLittleEndian(std::vector<char>& oBuffer, const T iValue) {
+	for (size_t i = 0; i < sizeof(T); ++i)
+		oBuffer.push_back(static_cast<char>(static_cast<uint64_t>(iValue) >> (8 * i) & 0xFFU));
+}
+
+/**
+ * @brief Read a fixed-width little-endian integer (bounds checked by the caller).
+ * @tparam T The integer type.
+ * @param iData The data.
+ * @param iOffset Offset of the integer.
+ * @return The value.
+ */
+template<typename T>
+auto getLittleEndian(const std::span<const uint8_t> iData, const size_t iOffset) -> T {
+	uint64_t value = 0;
+	for (size_t i = 0; i < sizeof(T); ++i) value |= static_cast<uint64_t>(iData[iOffset + i]) << (8 * i);
+	return static_cast<T>(value);
+}
+
+/**
+ * @brief Append a time as little-endian nanoseconds since the epoch.
+ * @param oBuffer The buffer.
+ * @param iTime The time.
+ */
+inline void putTime(std::vector<char>& oBuffer, const time_point& iTime) {
+	const auto nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(iTime.time_since_epoch());
+	putLittleEndian(oBuffer, static_cast<int64_t>(nanoseconds.count()));
+}
+
+/**
+ * @brief Read a time written by putTime (bounds checked by the caller).
+ * @param iData The data.
+ * @param iOffset Offset of the time.
+ * @return The time.
+ */
+inline auto getTime(const std::span<const uint8_t> iData, const size_t iOffset) -> time_point {
+	return time_point{std::chrono::duration_cast<clock::duration>(
+			std::chrono::nanoseconds{getLittleEndian<int64_t>(iData, iOffset)})};
+}
+
+/**
+ * @brief FNV-1a hash of a content.
+ * @param iData The content.
+ * @return The hash.
+ */
+auto contentHash(std::span<const uint8_t> iData) -> uint64_t;
+
+/**
+ * @brief FNV-1a hash of a content.
+ * @param iData The content.
+ * @return The hash.
+ */
+auto contentHash(std::string_view iData) -> uint64_t;
+
+/**
+ * @brief Read a whole file.
+ * @param iPath The file.
+ * @param oContent The content.
+ * @return False if the file cannot be read.
+ */
+auto readContent(const std::filesystem::path& iPath, std::string& oContent) -> bool;
+
+/**
+ * @brief Replace a file durably: the parts are written beside it, synced to the disk, then renamed over it.
+ *
+ * A crash leaves either the old or the new content, never a mix of both.
+ * @param iPath The file.
+ * @param iParts The parts of the content, in order.
+ * @return False (the file untouched) if the content cannot be written or renamed.
+ */
+auto writeAtomic(const std::filesystem::path& iPath, std::span<const std::string_view> iParts) -> bool;
+
+/**
+ * @brief Replace a file durably (see the multi-part version).
+ * @param iPath The file.
+ * @param iContent The content.
+ * @return False (the file untouched) if the content cannot be written or renamed.
+ */
+inline auto writeAtomic(const std::filesystem::path& iPath, const std::string_view iContent) -> bool {
+	return writeAtomic(iPath, std::span{&iContent, 1});
+}
+
+}// namespace evl::core::binary
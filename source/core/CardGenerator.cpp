@@ -0,0 +1,149 @@
+/**
+ * @file CardGenerator.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "CardGenerator.h"
+
+#include "Parallel.h"
+#include "RandomEngines.h"
+
+#include <cstring>
+
+namespace evl::core {
+
+namespace {
+/// Minimal number of cards generated by a thread.
+constexpr size_t g_minChunk = 4096;
+/// Number of columns holding a second or third number.
+constexpr uint8_t g_extraNumbers = CardRegistry::g_rows * CardRegistry::g_numbersPerRow - CardGenerator::g_columns;
+/// Largest column (80 to 90).
+constexpr uint8_t g_maxColumnSize = 11;
+
+/**
+ * @brief Draw a value in [0, iBound) by multiply-shift (Lemire) on the high 32 bits.
+ * @param ioState The generator state.
+ * @param iBound The exclusive upper bound.
+ * @return The random value.
+ */
+auto bounded(uint64_t& ioState, const uint8_t iBound) -> uint8_t {
+	return static_cast<uint8_t>(((splitMix64(ioState) >> 32U) * iBound) >> 32U);
+}
+
+auto columnOf(const uint8_t iNumber) -> uint8_t {
+	return iNumber == 90 ? uint8_t{8} : static_cast<uint8_t>(iNumber / 10);
+}
+auto columnFirst(const uint8_t iColumn) -> uint8_t {
+	return iColumn == 0 ? uint8_t{1} : static_cast<uint8_t>(iColumn * 10);
+}
+auto columnSize(const uint8_t iColumn) -> uint8_t {
+	if (iColumn == 0)
+		return 9;
+	return iColumn == CardGenerator::g_columns - 1 ? g_maxColumnSize : uint8_t{10};
+}
+
+/// Hash of the numbers of a card.
+struct CardHash {
+	auto operator()(const CardRegistry::numbers_type& iNumbers) const noexcept -> size_t {
+		uint64_t low = 0;
+		uint64_t high = 0;
+		std::memcpy(&low, iNumbers.data(), sizeof(low));
+		std::memcpy(&high, iNumbers.data() + sizeof(low), iNumbers.size() - sizeof(low));
+		uint64_t state = low;
+		return static_cast<size_t>(splitMix64(state) ^ high * 0xD1B54A32D192ED03ULL);
+	}
+};
+}// namespace
+
+auto CardGenerator::generate(const size_t iCount) const -> cards_type {
+	cards_type cards(iCount);
+	parallelChunks(iCount, chunkCount(iCount, g_minChunk), [&](size_t, const size_t iBegin, const size_t iEnd) {
+		for (size_t card = iBegin; card < iEnd; ++card) cards[card] = generateCard(card);
+	});
+	// Deduplication in index order keeps the result independent of the thread count.
+	std::unordered_set<CardRegistry::numbers_type, CardHash> seen;
+	seen.reserve(iCount);
+	for (size_t card = 0; card < iCount; ++card) {
+		uint64_t attempt = 0;
+		while (!seen.insert(cards[card]).second) cards[card] = generateCard(card, ++attempt);
+	}
+	return cards;
+}
+
+auto CardGenerator::generateCard(const uint64_t iIndex, const uint64_t iAttempt) const -> CardRegistry::numbers_type {
+	uint64_t state = m_seed ^ (iIndex * 0xD1B54A32D192ED03ULL) ^ (iAttempt * 0x8CB92BA72F3D8DD7ULL);
+	splitMix64(state);
+	// numbers per column
+	std::array<uint8_t, g_columns> counts{};
+	counts.fill(1);
+	for (uint8_t extra = 0; extra < g_extraNumbers;) {
+		const uint8_t column = bounded(state, g_columns);
+		if (counts[column] < CardRegistry::g_rows) {
+			++counts[column];
+			++extra;
+		}
+	}
+	// Columns with the most numbers first, each one in the rows with the most room left (Gale-Ryser):
+	// this always fills the rows with exactly 5 numbers.
+	std::array<uint8_t, g_columns> order{};
+	std::iota(order.begin(), order.end(), uint8_t{0});
+	std::ranges::stable_sort(order, std::greater{}, [&counts](const uint8_t iColumn) { return counts[iColumn]; });
+	std::array<uint8_t, CardRegistry::g_rows> room{};
+	room.fill(CardRegistry::g_numbersPerRow);
+	std::array<std::array<uint8_t, g_columns>, CardRegistry::g_rows> grid{};
+	for (const uint8_t column: order) {
+		std::array<uint8_t, CardRegistry::g_rows> rows{0, 1, 2};
+		for (uint8_t i = CardRegistry::g_rows - 1; i > 0; --i)
+			std::swap(rows[i], rows[bounded(state, static_cast<uint8_t>(i + 1))]);
+		std::ranges::stable_sort(rows, std::greater{}, [&room](const uint8_t iRow) { return room[iRow]; });
+		const auto used = std::next(rows.begin(), counts[column]);
+		std::sort(rows.begin(), used);
+		// partial Fisher-Yates on the column values
+		std::array<uint8_t, g_maxColumnSize> values{};
+		const uint8_t size = columnSize(column);
+		std::iota(values.begin(), std::next(values.begin(), size), columnFirst(column));
+		for (uint8_t i = 0; i < counts[column]; ++i)
+			std::swap(values[i], values[i + bounded(state, static_cast<uint8_t>(size - i))]);
+		std::sort(values.begin(), std::next(values.begin(), counts[column]));
+		for (uint8_t i = 0; i < counts[column]; ++i) {
+			grid[rows[i]][column] = values[i];
+			--room[rows[i]];
+		}
+	}
+	CardRegistry::numbers_type numbers{};
+	size_t next = 0;
+	for (const auto& row: grid) {
+		for (const uint8_t number: row) {
+			if (number != 0)
+				numbers[next++] = number;
+		}
+	}
+	return numbers;
+}
+
+auto CardGenerator::isValid(const CardRegistry::numbers_type& iNumbers) -> bool {
+	NumberMask all;
+	std::array<uint8_t, g_columns> lastInColumn{};
+	for (uint8_t row = 0; row < CardRegistry::g_rows; ++row) {
+		int previousColumn = -1;
+		for (uint8_t i = 0; i < CardRegistry::g_numbersPerRow; ++i) {
+			const uint8_t number = iNumbers[static_cast<size_t>(row * CardRegistry::g_numbersPerRow + i)];
+			if (!NumberMask::isValid(number) || all.test(number))
+				return false;
+			all.set(number);
+			const uint8_t column = columnOf(number);
+			// one number per column in a row, sorted from top to bottom in a column
+			if (column <= previousColumn || lastInColumn[column] > number)
+				return false;
+			lastInColumn[column] = number;
+			previousColumn = column;
+		}
+	}
+	return std::ranges::none_of(lastInColumn, [](const uint8_t iLast) { return iLast == 0; });
+}
+
+}// namespace evl::core
@@ -0,0 +1,72 @@
+/**
+ * @file CardGenerator.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#pragma once
+
+#include "CardRegistry.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace evl::core {
+
+/**
+ * @brief Class CardGenerator: deterministic generation of 90-ball cards.
+ *
+ * A card is a 3x9 grid with 5 numbers per row, column c holding numbers from its decade (1-9, 10-19,
+ * ..., 80-90), each column holding 1 to 3 numbers sorted from top to bottom.
+ *
+ * Each card only depends on the seed, its index and a retry counter, so the cards can be produced in
+ * parallel and the result is the same whatever the number of threads.
+ */
+class CardGenerator {
+public:
+	/// List of generated cards.
+	using cards_type = std::vector<CardRegistry::numbers_type>;
+	/// Number of columns of a card.
+	static constexpr uint8_t g_columns = 9;
+
+	/**
+	 * @brief Constructor.
+	 * @param iSeed The seed of the generation.
+	 */
+	explicit CardGenerator(const uint64_t iSeed) : m_seed{iSeed} {}
+
+	/**
+	 * @brief Get the seed.
+	 * @return The seed.
+	 */
+	[[nodiscard]] auto getSeed() const -> uint64_t { return m_seed; }
+
+	/**
+	 * @brief Generate a list of unique cards.
+	 * @param iCount The number of cards.
+	 * @return The cards, in index order.
+	 */
+	[[nodiscard]] auto generate(size_t iCount) const -> cards_type;
+
+	/**
+	 * @brief Generate one card.
+	 * @param iIndex The index of the card.
+	 * @param iAttempt The retry counter (used to replace a duplicated card).
+	 * @return The numbers of the card, row by row.
+	 */
+	[[nodiscard]] auto generateCard(uint64_t iIndex, uint64_t iAttempt = 0) const -> CardRegistry::numbers_type;
+
+	/**
+	 * @brief Check that numbers make a valid 90-ball card.
+	 * @param iNumbers The numbers of the card, row by row.
+	 * @return True if valid.
+	 */
+	[[nodiscard]] static auto isValid(const CardRegistry::numbers_type& iNumbers) -> bool;
+
+private:
+	/// The seed of the generation.
+	uint64_t m_seed = 0;
+};
+
+}// namespace evl::core
@@ -0,0 +1,97 @@
+/**
+ * @file CardPack.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "CardPack.h"
+
+#include "BinaryIO.h"
+#include "Log.h"
+
+namespace evl::core {
+
+using namespace binary;
+
+namespace {
+/// Magic bytes at the start of a pack.
+constexpr std::string_view g_magic = "EVLCARDS";
+}// namespace
+
+auto CardPack::write(const std::filesystem::path& iPath, const std::span<const CardRegistry::numbers_type> iCards,
+					 const uint64_t iSeed) -> bool {
+	if (iCards.size() > std::numeric_limits<uint32_t>::max()) {
+		log_warn("Trop de cartons pour un fichier de cartons");
+		return false;
+	}
+	std::vector<char> buffer;
+	buffer.reserve(g_headerSize + iCards.size() * g_stride);
+	buffer.insert(buffer.end(), g_magic.begin(), g_magic.end());
+	putLittleEndian(buffer, g_version);
+	putLittleEndian(buffer, g_stride);
+	putLittleEndian(buffer, static_cast<uint32_t>(iCards.size()));
+	putLittleEndian(buffer, iSeed);
+	putLittleEndian(buffer, uint64_t{0});
+	for (const auto& card: iCards) {
+		buffer.insert(buffer.end(), card.begin(), card.end());
+		buffer.resize(buffer.size() + g_stride - card.size(), 0);
+	}
+	return writeAtomic(iPath, {buffer.data(), buffer.size()});
+}
+
+auto CardPack::open(const std::filesystem::path& iPath) -> bool {
+	close();
+	if (!m_file.open(iPath))
+		return false;
+	const auto data = m_file.data();
+	if (data.size() < g_headerSize || !std::equal(g_magic.begin(), g_magic.end(), data.begin())) {
+		log_warn("Le fichier '{}' n'est pas un fichier de cartons", iPath.string());
+		close();
+		return false;
+	}
+	const auto version = getLittleEndian<uint16_t>(data, 8);
+	const auto stride = getLittleEndian<uint16_t>(data, 10);
+	const auto count = getLittleEndian<uint32_t>(data, 12);
+	if (version > g_version || stride < std::tuple_size_v<CardRegistry::numbers_type> ||
+		data.size() < g_headerSize + size_t{count} * stride) {
+		log_warn("Fichier de cartons '{}' incompatible ou tronqué", iPath.string());
+		close();
+		return false;
+	}
+	m_stride = stride;
+	m_count = count;
+	m_seed = getLittleEndian<uint64_t>(data, 16);
+	return true;
+}
+
+void CardPack::close() {
+	m_file.close();
+	m_count = 0;
+	m_stride = g_stride;
+	m_seed = 0;
+}
+
+auto CardPack::getCard(const size_t iIndex) const -> CardRegistry::numbers_type {
+	CardRegistry::numbers_type numbers{};
+	if (iIndex >= m_count)
+		return numbers;
+	const auto record = m_file.data().subspan(g_headerSize + iIndex * m_stride, numbers.size());
+	std::ranges::copy(record, numbers.begin());
+	return numbers;
+}
+
+auto CardPack::loadInto(CardRegistry& oRegistry) const -> size_t {
+	oRegistry.clear();
+	size_t added = 0;
+	for (size_t card = 0; card < m_count; ++card) {
+		if (oRegistry.addCard(getCard(card), static_cast<CardRegistry::serial_type>(card + 1)))
+			++added;
+	}
+	log_info("{} cartons chargés sur {}", added, m_count);
+	return added;
+}
+
+}// namespace evl::core
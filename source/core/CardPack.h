@@ -0,0 +1,102 @@
+/**
+ * @file CardPack.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#pragma once
+
+#include "CardRegistry.h"
+#include "MappedFile.h"
+
+#include <filesystem>
+#include <span>
+
+namespace evl::core {
+
+/**
+ * @brief Class CardPack: binary file of cards, read in place through a memory mapping.
+ *
+ * Layout (little endian):
+ * - header of 32 bytes: magic "EVLCARDS", version (u16), record stride (u16), card count (u32),
+ *   generation seed (u64), reserved (u64);
+ * - one fixed-size record per card: the 15 numbers row by row, then padding up to the stride.
+ *
+ * The serial of a card is its index in the pack + 1.
+ */
+class CardPack {
+public:
+	/// Current version of the format.
+	static constexpr uint16_t g_version = 1;
+	/// Size of the header.
+	static constexpr size_t g_headerSize = 32;
+	/// Size of a card record.
+	static constexpr uint16_t g_stride = 16;
+
+	/**
+	 * @brief Write a card pack, replacing any previous file atomically.
+	 * @param iPath The file to write.
+	 * @param iCards The cards to write.
+	 * @param iSeed The seed used to generate the cards.
+	 * @return True if the file has been written.
+	 */
+	static auto write(const std::filesystem::path& iPath, std::span<const CardRegistry::numbers_type> iCards,
+					  uint64_t iSeed = 0) -> bool;
+
+	/**
+	 * @brief Map a card pack and check its header.
+	 * @param iPath The file to open.
+	 * @return True if the pack is valid.
+	 */
+	auto open(const std::filesystem::path& iPath) -> bool;
+
+	/**
+	 * @brief Release the pack.
+	 */
+	void close();
+
+	/**
+	 * @brief Check if a pack is opened.
+	 * @return True if opened.
+	 */
+	[[nodiscard]] auto isOpen() const -> bool { return m_file.isOpen(); }
+
+	/**
+	 * @brief Get the number of cards.
+	 * @return The number of cards.
+	 */
+	[[nodiscard]] auto size() const -> size_t { return m_count; }
+
+	/**
+	 * @brief Get the seed used to generate the cards.
+	 * @return The seed.
+	 */
+	[[nodiscard]] auto getSeed() const -> uint64_t { return m_seed; }
+
+	/**
+	 * @brief Get the numbers of a card.
+	 * @param iIndex The index of the card.
+	 * @return The numbers of the card, row by row.
+	 */
+	[[nodiscard]] auto getCard(size_t iIndex) const -> CardRegistry::numbers_type;
+
+	/**
+	 * @brief Replace the cards of a registry by the cards of the pack.
+	 * @param oRegistry The registry to fill.
+	 * @return The number of cards added.
+	 */
+	auto loadInto(CardRegistry& oRegistry) const -> size_t;
+
+private:
+	/// The mapped file.
+	MappedFile m_file;
+	/// Number of cards.
+	size_t m_count = 0;
+	/// Size of a record.
+	size_t m_stride = g_stride;
+	/// Generation seed.
+	uint64_t m_seed = 0;
+};
+
+}// namespace evl::core
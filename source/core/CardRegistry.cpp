@@ -0,0 +1,329 @@
+/**
+ * @file CardRegistry.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "CardRegistry.h"
+
+#include "Log.h"
+#include "Parallel.h"
+#include "StringUtils.h"
+
+namespace evl::core {
+
+namespace {
+/// Number of cards processed by a kernel call.
+constexpr size_t g_blockSize = 1024;
+/// Minimal number of cards per thread when building the index.
+constexpr size_t g_minIndexChunk = 65536;
+/// Number of number slots in the index.
+constexpr size_t g_slots = NumberMask::g_maxNumber + 1;
+}// namespace
+
+auto CardRegistry::addCard(const numbers_type& iNumbers, const serial_type iSerial) -> bool {
+	NumberMask card;
+	std::array<NumberMask, g_rows> rows;
+	for (uint8_t row = 0; row < g_rows; ++row) {
+		for (uint8_t col = 0; col < g_numbersPerRow; ++col) {
+			const uint8_t number = iNumbers[static_cast<size_t>(row * g_numbersPerRow + col)];
+			if (!NumberMask::isValid(number) || card.test(number)) {
+				log_warn("Carton invalide: numéro {} hors limite ou en double", number);
+				return false;
+			}
+			card.set(number);
+			rows[row].set(number);
+		}
+	}
+	for (uint8_t row = 0; row < g_rows; ++row) {
+		m_rowLow[row].push_back(rows[row].low());
+		m_rowHigh[row].push_back(rows[row].high());
+	}
+	m_cardLow.push_back(card.low());
+	m_cardHigh.push_back(card.high());
+	m_serials.push_back(iSerial == 0 ? static_cast<serial_type>(m_serials.size() + 1) : iSerial);
+	m_indexDirty = true;
+	return true;
+}
+
+void CardRegistry::clear() {
+	for (uint8_t row = 0; row < g_rows; ++row) {
+		m_rowLow[row].clear();
+		m_rowHigh[row].clear();
+	}
+	m_cardLow.clear();
+	m_cardHigh.clear();
+	m_serials.clear();
+	m_postingOffsets.fill(0);
+	m_postings.clear();
+	m_remaining.clear();
+	m_lines.clear();
+	m_tracked.clear();
+	m_indexDirty = false;
+	m_survivors.clear();
+	m_eliminated.clear();
+	m_eliminationOffsets.clear();
+}
+
+auto CardRegistry::countMissing(const card_id iCard, const NumberMask& iDraws) const -> uint8_t {
+	return static_cast<uint8_t>(std::popcount(m_cardLow[iCard] & ~iDraws.low()) +
+								std::popcount(m_cardHigh[iCard] & ~iDraws.high()));
+}
+
+auto CardRegistry::countLines(const card_id iCard, const NumberMask& iDraws) const -> uint8_t {
+	uint8_t lines = 0;
+	for (uint8_t row = 0; row < g_rows; ++row) {
+		if (getRowMask(iCard, row).isSubsetOf(iDraws))
+			++lines;
+	}
+	return lines;
+}
+
+auto CardRegistry::requiredLines(const SubGameRound::Type iType) -> uint8_t {
+	switch (iType) {
+		case SubGameRound::Type::OneQuine:
+			return 1;
+		case SubGameRound::Type::TwoQuines:
+			return 2;
+		case SubGameRound::Type::FullCard:
+			return g_rows;
+		case SubGameRound::Type::Inverse:
+		case SubGameRound::Type::Invalid:
+			break;
+	}
+	return 0;
+}
+
+void CardRegistry::lineKernel(const NumberMask& iDraws, const NumberMask& iLastDraw, const size_t iBegin,
+							  std::span<uint8_t> oNow, std::span<uint8_t> oBefore) const {
+	const uint64_t missLow = ~iDraws.low();
+	const uint64_t missHigh = ~iDraws.high();
+	const uint64_t lastLow = iLastDraw.low();
+	const uint64_t lastHigh = iLastDraw.high();
+	const size_t count = oNow.size();
+	std::ranges::fill(oNow, uint8_t{0});
+	std::ranges::fill(oBefore, uint8_t{0});
+	// Branch-free loops over contiguous words: a row is complete when (row AND NOT draws) is zero,
+	// it was already complete before the last draw if it does not hold the last number.
+	for (uint8_t row = 0; row < g_rows; ++row) {
+		const uint64_t* low = m_rowLow[row].data() + iBegin;
+		const uint64_t* high = m_rowHigh[row].data() + iBegin;
+		for (size_t i = 0; i < count; ++i) {
+			const bool complete = ((low[i] & missLow) | (high[i] & missHigh)) == 0;
+			const bool hasLast = ((low[i] & lastLow) | (high[i] & lastHigh)) != 0;
+			oNow[i] = static_cast<uint8_t>(oNow[i] + static_cast<uint8_t>(complete));
+			oBefore[i] = static_cast<uint8_t>(oBefore[i] + static_cast<uint8_t>(complete && !hasLast));
+		}
+	}
+}
+
+auto CardRegistry::findWinners(const SubGameRound::Type iType, const NumberMask& iDraws) const -> winners_type {
+	winners_type winners;
+	const uint8_t required = requiredLines(iType);
+	if (required == 0)
+		return winners;
+	std::array<uint8_t, g_blockSize> now{};
+	std::array<uint8_t, g_blockSize> before{};
+	for (size_t begin = 0; begin < size(); begin += g_blockSize) {
+		const size_t count = std::min(g_blockSize, size() - begin);
+		lineKernel(iDraws, {}, begin, std::span{now}.first(count), std::span{before}.first(count));
+		for (size_t i = 0; i < count; ++i) {
+			if (now[i] >= required)
+				winners.push_back(static_cast<card_id>(begin + i));
+		}
+	}
+	return winners;
+}
+
+auto CardRegistry::findNewWinners(const SubGameRound::Type iType, const NumberMask& iDraws,
+								  const uint8_t iLastDraw) const -> winners_type {
+	winners_type winners;
+	const uint8_t required = requiredLines(iType);
+	if (required == 0 || !iDraws.test(iLastDraw))
+		return winners;
+	NumberMask last;
+	last.set(iLastDraw);
+	std::array<uint8_t, g_blockSize> now{};
+	std::array<uint8_t, g_blockSize> before{};
+	for (size_t begin = 0; begin < size(); begin += g_blockSize) {
+		const size_t count = std::min(g_blockSize, size() - begin);
+		lineKernel(iDraws, last, begin, std::span{now}.first(count), std::span{before}.first(count));
+		for (size_t i = 0; i < count; ++i) {
+			if (now[i] >= required && before[i] < required)
+				winners.push_back(static_cast<card_id>(begin + i));
+		}
+	}
+	return winners;
+}
+
+auto CardRegistry::getSerialsStr(const winners_type& iCards) const -> std::string {
+	std::vector<serial_type> serials;
+	serials.reserve(iCards.size());
+	for (const auto card: iCards) serials.push_back(m_serials[card]);
+	return join(serials, ", ");
+}
+
+void CardRegistry::buildIndex() {
+	// Two passes over contiguous chunks of cards: count the rows holding each number, then fill the posting
+	// lists at offsets given by the prefix sums. Each chunk writes its own slice, in card order.
+	const size_t chunks = chunkCount(size(), g_minIndexChunk);
+	std::vector<std::array<uint32_t, g_slots>> counts(chunks);
+	const auto forEachEntry = [this](const size_t iBegin, const size_t iEnd, const auto& iFunc) {
+		for (size_t card = iBegin; card < iEnd; ++card) {
+			for (uint8_t row = 0; row < g_rows; ++row) {
+				uint64_t low = m_rowLow[row][card];
+				while (low != 0) {
+					iFunc(static_cast<size_t>(std::countr_zero(low)) + 1, card, row);
+					low &= low - 1;
+				}
+				uint64_t high = m_rowHigh[row][card];
+				while (high != 0) {
+					iFunc(static_cast<size_t>(std::countr_zero(high)) + 65, card, row);
+					high &= high - 1;
+				}
+			}
+		}
+	};
+	parallelChunks(size(), chunks, [&](const size_t iChunk, const size_t iBegin, const size_t iEnd) {
+		auto& count = counts[iChunk];
+		count.fill(0);
+		forEachEntry(iBegin, iEnd, [&count](const size_t iNumber, size_t, uint8_t) { ++count[iNumber]; });
+	});
+	uint32_t offset = 0;
+	for (size_t number = 0; number < g_slots; ++number) {
+		m_postingOffsets[number] = offset;
+		for (auto& count: counts) {
+			const uint32_t chunkSize = count[number];
+			count[number] = offset;
+			offset += chunkSize;
+		}
+	}
+	m_postingOffsets[g_slots] = offset;
+	m_postings.resize(offset);
+	parallelChunks(size(), chunks, [&](const size_t iChunk, const size_t iBegin, const size_t iEnd) {
+		auto& cursor = counts[iChunk];
+		forEachEntry(iBegin, iEnd, [&](const size_t iNumber, const size_t iCard, const uint8_t iRow) {
+			m_postings[cursor[iNumber]++] = static_cast<uint32_t>(iCard << 2U) | iRow;
+		});
+	});
+	m_indexDirty = false;
+	syncTracking({});
+}
+
+void CardRegistry::syncTracking(const std::span<const uint8_t> iDraws) {
+	if (m_indexDirty)
+		buildIndex();
+	m_remaining.assign(size() * g_rows, g_numbersPerRow);
+	m_lines.assign(size(), 0);
+	m_tracked.clear();
+	for (const auto number: iDraws) (void)applyDraw(number, SubGameRound::Type::Invalid);
+}
+
+auto CardRegistry::applyDraw(const uint8_t iNumber, const SubGameRound::Type iType) -> winners_type {
+	winners_type winners;
+	if (m_indexDirty)
+		syncTracking({});
+	if (!NumberMask::isValid(iNumber) || m_tracked.test(iNumber))
+		return winners;
+	m_tracked.set(iNumber);
+	const uint8_t required = requiredLines(iType);
+	for (uint32_t i = m_postingOffsets[iNumber]; i < m_postingOffsets[iNumber + 1U]; ++i) {
+		const uint32_t entry = m_postings[i];
+		const uint32_t card = entry >> 2U;
+		if (--m_remaining[card * g_rows + (entry & 3U)] != 0)
+			continue;
+		if (++m_lines[card] == required)
+			winners.push_back(card);
+	}
+	return winners;
+}
+
+void CardRegistry::undoDraw(const uint8_t iNumber) {
+	if (!m_tracked.test(iNumber))
+		return;
+	m_tracked.reset(iNumber);
+	for (uint32_t i = m_postingOffsets[iNumber]; i < m_postingOffsets[iNumber + 1U]; ++i) {
+		const uint32_t entry = m_postings[i];
+		const uint32_t card = entry >> 2U;
+		if (m_remaining[card * g_rows + (entry & 3U)]++ == 0)
+			--m_lines[card];
+	}
+}
+
+auto CardRegistry::getWinnersByDraw(const uint8_t iNumber, const SubGameRound::Type iType) const -> winners_type {
+	winners_type winners;
+	const uint8_t required = requiredLines(iType);
+	if (required == 0 || m_indexDirty || !m_tracked.test(iNumber))
+		return winners;
+	for (uint32_t i = m_postingOffsets[iNumber]; i < m_postingOffsets[iNumber + 1U]; ++i) {
+		const uint32_t entry = m_postings[i];
+		const uint32_t card = entry >> 2U;
+		if (m_remaining[card * g_rows + (entry & 3U)] == 0 && m_lines[card] == required)
+			winners.push_back(card);
+	}
+	return winners;
+}
+
+auto CardRegistry::getTrackedWinners(const SubGameRound::Type iType) const -> winners_type {
+	winners_type winners;
+	const uint8_t required = requiredLines(iType);
+	if (required == 0 || m_indexDirty)
+		return winners;
+	for (size_t card = 0; card < m_lines.size(); ++card) {
+		if (m_lines[card] >= required)
+			winners.push_back(static_cast<card_id>(card));
+	}
+	return winners;
+}
+
+auto CardRegistry::getPostingSize(const uint8_t iNumber) const -> size_t {
+	if (!NumberMask::isValid(iNumber))
+		return 0;
+	return m_postingOffsets[iNumber + 1U] - m_postingOffsets[iNumber];
+}
+
+void CardRegistry::syncElimination(const std::span<const uint8_t> iDraws) {
+	if (m_indexDirty)
+		buildIndex();
+	m_survivors.fill(static_cast<SurvivorSet::value_type>(size()));
+	m_eliminated.clear();
+	m_eliminationOffsets.clear();
+	for (const auto number: iDraws) (void)eliminate(number);
+}
+
+auto CardRegistry::eliminate(const uint8_t iNumber) -> size_t {
+	if (m_indexDirty)
+		syncElimination({});
+	m_eliminationOffsets.push_back(m_eliminated.size());
+	if (!NumberMask::isValid(iNumber))
+		return 0;
+	for (uint32_t i = m_postingOffsets[iNumber]; i < m_postingOffsets[iNumber + 1U]; ++i) {
+		const card_id card = m_postings[i] >> 2U;
+		if (m_survivors.remove(card))
+			m_eliminated.push_back(card);
+	}
+	return m_eliminated.size() - m_eliminationOffsets.back();
+}
+
+void CardRegistry::undoElimination() {
+	if (m_eliminationOffsets.empty())
+		return;
+	const size_t offset = m_eliminationOffsets.back();
+	for (size_t i = offset; i < m_eliminated.size(); ++i) (void)m_survivors.add(m_eliminated[i]);
+	m_eliminated.resize(offset);
+	m_eliminationOffsets.pop_back();
+}
+
+auto CardRegistry::getSurvivors(const size_t iLimit) const -> winners_type { return m_survivors.toVector(iLimit); }
+
+auto CardRegistry::getLastEliminated() const -> winners_type {
+	if (m_eliminationOffsets.empty())
+		return {};
+	const auto first = std::next(m_eliminated.begin(), static_cast<std::ptrdiff_t>(m_eliminationOffsets.back()));
+	return {first, m_eliminated.end()};
+}
+
+}// namespace evl::core
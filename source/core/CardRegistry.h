@@ -0,0 +1,306 @@
+/**
+ * @file CardRegistry.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#pragma once
+
+#include "NumberMask.h"
+#include "SubGameRound.h"
+#include "SurvivorSet.h"
+
+#include <array>
+#include <span>
+#include <vector>
+
+namespace evl::core {
+
+/**
+ * @brief Class CardRegistry: the cards sold for an event and the winner detection.
+ *
+ * Cards are stored as a structure of arrays: one 90-bit mask per row and one for the full card, so that
+ * the detection kernels stream over contiguous words and can be auto-vectorized by the compiler.
+ *
+ * For the live game, an inverted index gives for each number the rows holding it, and per-row remaining
+ * counters are only updated for the cards hit by a draw. Inverse games use the same index to shrink a
+ * compressed set of surviving cards.
+ */
+class CardRegistry {
+public:
+	/// Index of a card in the registry.
+	using card_id = uint32_t;
+	/// Number printed on the card.
+	using serial_type = uint32_t;
+	/// Number of rows of a card.
+	static constexpr uint8_t g_rows = 3;
+	/// Number of numbers on a row.
+	static constexpr uint8_t g_numbersPerRow = 5;
+	/// Numbers of a card, row by row.
+	using numbers_type = std::array<uint8_t, g_rows * g_numbersPerRow>;
+	/// List of cards.
+	using winners_type = std::vector<card_id>;
+
+	/**
+	 * @brief Add a card to the registry.
+	 * @param iNumbers The 15 numbers of the card, row by row.
+	 * @param iSerial The number printed on the card (0 to use the index in the registry + 1).
+	 * @return True if the card is valid and has been added.
+	 */
+	auto addCard(const numbers_type& iNumbers, serial_type iSerial = 0) -> bool;
+
+	/**
+	 * @brief Remove all the cards.
+	 */
+	void clear();
+
+	/**
+	 * @brief Get the number of cards.
+	 * @return The number of cards.
+	 */
+	[[nodiscard]] auto size() const -> size_t { return m_serials.size(); }
+
+	/**
+	 * @brief Check if the registry is empty.
+	 * @return True if no card.
+	 */
+	[[nodiscard]] auto empty() const -> bool { return m_serials.empty(); }
+
+	/**
+	 * @brief Get the number printed on a card.
+	 * @param iCard The card.
+	 * @return The serial of the card.
+	 */
+	[[nodiscard]] auto getSerial(const card_id iCard) const -> serial_type { return m_serials[iCard]; }
+
+	/**
+	 * @brief Get the mask of all the numbers of a card.
+	 * @param iCard The card.
+	 * @return The card mask.
+	 */
+	[[nodiscard]] auto getCardMask(const card_id iCard) const -> NumberMask {
+		return {m_cardLow[iCard], m_cardHigh[iCard]};
+	}
+
+	/**
+	 * @brief Get the mask of a row of a card.
+	 * @param iCard The card.
+	 * @param iRow The row index.
+	 * @return The row mask.
+	 */
+	[[nodiscard]] auto getRowMask(const card_id iCard, const uint8_t iRow) const -> NumberMask {
+		return {m_rowLow[iRow][iCard], m_rowHigh[iRow][iCard]};
+	}
+
+	/**
+	 * @brief Count the numbers of a card not drawn yet.
+	 * @param iCard The card.
+	 * @param iDraws The drawn numbers.
+	 * @return The number of missing numbers.
+	 */
+	[[nodiscard]] auto countMissing(card_id iCard, const NumberMask& iDraws) const -> uint8_t;
+
+	/**
+	 * @brief Count the completed rows of a card.
+	 * @param iCard The card.
+	 * @param iDraws The drawn numbers.
+	 * @return The number of completed rows.
+	 */
+	[[nodiscard]] auto countLines(card_id iCard, const NumberMask& iDraws) const -> uint8_t;
+
+	/**
+	 * @brief Number of completed rows required to win a sub-round.
+	 * @param iType The sub-round type.
+	 * @return The number of rows (0 if the type cannot be won by completing rows).
+	 */
+	[[nodiscard]] static auto requiredLines(SubGameRound::Type iType) -> uint8_t;
+
+	/**
+	 * @brief Search all the cards fulfilling the sub-round.
+	 * @param iType The sub-round type.
+	 * @param iDraws The drawn numbers.
+	 * @return The winning cards.
+	 */
+	[[nodiscard]] auto findWinners(SubGameRound::Type iType, const NumberMask& iDraws) const -> winners_type;
+
+	/**
+	 * @brief Search the cards that just fulfilled the sub-round with the last drawn number.
+	 * @param iType The sub-round type.
+	 * @param iDraws The drawn numbers, including the last one.
+	 * @param iLastDraw The last drawn number.
+	 * @return The new winning cards.
+	 */
+	[[nodiscard]] auto findNewWinners(SubGameRound::Type iType, const NumberMask& iDraws, uint8_t iLastDraw) const
+			-> winners_type;
+
+	/**
+	 * @brief Format the serial of a list of cards.
+	 * @param iCards The cards.
+	 * @return The serials separated by commas.
+	 */
+	[[nodiscard]] auto getSerialsStr(const winners_type& iCards) const -> std::string;
+
+	// ---- incremental tracking ----
+	/**
+	 * @brief Build the number to cards index, in parallel for large registries.
+	 *
+	 * Also reset the tracking counters.
+	 */
+	void buildIndex();
+
+	/**
+	 * @brief Check if the index must be rebuilt.
+	 * @return True if cards have been added since the last build.
+	 */
+	[[nodiscard]] auto isIndexDirty() const -> bool { return m_indexDirty; }
+
+	/**
+	 * @brief Reset the tracking to the given draws.
+	 * @param iDraws The numbers already drawn, in order.
+	 */
+	void syncTracking(std::span<const uint8_t> iDraws);
+
+	/**
+	 * @brief Apply a draw to the tracking counters.
+	 *
+	 * Only the cards reaching the sub-round with this draw are reported: the cards already beyond it when the
+	 * sub-round opened are given by getTrackedWinners.
+	 * @param iNumber The number drawn.
+	 * @param iType The current sub-round type.
+	 * @return The cards that just fulfilled the sub-round.
+	 */
+	auto applyDraw(uint8_t iNumber, SubGameRound::Type iType) -> winners_type;
+
+	/**
+	 * @brief Revert a draw from the tracking counters.
+	 * @param iNumber The number to revert.
+	 */
+	void undoDraw(uint8_t iNumber);
+
+	/**
+	 * @brief Get the cards that fulfilled the sub-round with a given tracked draw.
+	 * @param iNumber The number drawn.
+	 * @param iType The current sub-round type.
+	 * @return The cards whose row holding iNumber completed the sub-round.
+	 */
+	[[nodiscard]] auto getWinnersByDraw(uint8_t iNumber, SubGameRound::Type iType) const -> winners_type;
+
+	/**
+	 * @brief Get all the cards fulfilling a sub-round according to the tracking counters.
+	 *
+	 * To call when a sub-round opens: its cards may have been completed during the previous sub-rounds.
+	 * @param iType The sub-round type.
+	 * @return The cards with at least the required number of completed rows.
+	 */
+	[[nodiscard]] auto getTrackedWinners(SubGameRound::Type iType) const -> winners_type;
+
+	/**
+	 * @brief Get the numbers applied to the tracking counters.
+	 * @return The tracked draws.
+	 */
+	[[nodiscard]] auto getTrackedDraws() const -> const NumberMask& { return m_tracked; }
+
+	/**
+	 * @brief Get the number of completed rows of a card according to the tracking counters.
+	 * @param iCard The card.
+	 * @return The number of completed rows.
+	 */
+	[[nodiscard]] auto getTrackedLines(const card_id iCard) const -> uint8_t { return m_lines[iCard]; }
+
+	/**
+	 * @brief Get the number of cards holding a number.
+	 * @param iNumber The number.
+	 * @return The number of cards.
+	 */
+	[[nodiscard]] auto getPostingSize(uint8_t iNumber) const -> size_t;
+
+	// ---- inverse game ----
+	/**
+	 * @brief Reset the elimination to the given draws.
+	 * @param iDraws The numbers already drawn, in order.
+	 */
+	void syncElimination(std::span<const uint8_t> iDraws);
+
+	/**
+	 * @brief Eliminate the surviving cards holding a number.
+	 * @param iNumber The number drawn.
+	 * @return The number of cards eliminated.
+	 */
+	auto eliminate(uint8_t iNumber) -> size_t;
+
+	/**
+	 * @brief Restore the cards eliminated by the last draw.
+	 */
+	void undoElimination();
+
+	/**
+	 * @brief Get the number of draws applied to the elimination.
+	 * @return The number of draws.
+	 */
+	[[nodiscard]] auto getEliminationDepth() const -> size_t { return m_eliminationOffsets.size(); }
+
+	/**
+	 * @brief Get the number of cards still in game.
+	 * @return The number of survivors.
+	 */
+	[[nodiscard]] auto getSurvivorCount() const -> size_t { return m_survivors.size(); }
+
+	/**
+	 * @brief Get the cards still in game.
+	 * @param iLimit The maximal number of cards to return.
+	 * @return The survivors, in registry order.
+	 */
+	[[nodiscard]] auto getSurvivors(size_t iLimit) const -> winners_type;
+
+	/**
+	 * @brief Get the cards eliminated by the last draw.
+	 * @return The cards.
+	 */
+	[[nodiscard]] auto getLastEliminated() const -> winners_type;
+
+private:
+	/**
+	 * @brief Count the rows completed for a block of cards.
+	 * @param iDraws The drawn numbers.
+	 * @param iLastDraw Mask of the last drawn number (may be empty).
+	 * @param iBegin The first card of the block.
+	 * @param oNow The completed rows with all the draws.
+	 * @param oBefore The completed rows without the last draw.
+	 */
+	void lineKernel(const NumberMask& iDraws, const NumberMask& iLastDraw, size_t iBegin, std::span<uint8_t> oNow,
+					std::span<uint8_t> oBefore) const;
+
+	/// Low words of the row masks.
+	std::array<std::vector<uint64_t>, g_rows> m_rowLow;
+	/// High words of the row masks.
+	std::array<std::vector<uint64_t>, g_rows> m_rowHigh;
+	/// Low words of the card masks.
+	std::vector<uint64_t> m_cardLow;
+	/// High words of the card masks.
+	std::vector<uint64_t> m_cardHigh;
+	/// Numbers printed on the cards.
+	std::vector<serial_type> m_serials;
+
+	/// Start of each number's posting list (index 0 is unused, index 91 is the end).
+	std::array<uint32_t, NumberMask::g_maxNumber + 2> m_postingOffsets{};
+	/// Posting lists: the card index shifted by 2, ored with the row index.
+	std::vector<uint32_t> m_postings;
+	/// If the index must be rebuilt.
+	bool m_indexDirty = false;
+	/// Remaining numbers per card row.
+	std::vector<uint8_t> m_remaining;
+	/// Completed rows per card.
+	std::vector<uint8_t> m_lines;
+	/// The numbers applied to the counters.
+	NumberMask m_tracked;
+
+	/// Cards still in game for an inverse round.
+	SurvivorSet m_survivors;
+	/// Cards eliminated, draw after draw.
+	std::vector<card_id> m_eliminated;
+	/// Start in m_eliminated of each draw's eliminations.
+	std::vector<size_t> m_eliminationOffsets;
+};
+
+}// namespace evl::core
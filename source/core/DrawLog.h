@@ -0,0 +1,146 @@
+/**
+ * @file DrawLog.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#pragma once
+
+#include "NumberMask.h"
+
+#include <array>
+#include <span>
+
+namespace evl::core {
+
+/**
+ * @brief Class DrawLog: ordered draws of a round with constant time lookups and no allocation.
+ *
+ * Besides the ordered draws, the log keeps the mask of the drawn numbers, the position of the last
+ * draw of each number and the sub-round of each draw.
+ */
+class DrawLog {
+public:
+	/// Maximal number of draws in a round.
+	static constexpr uint8_t g_capacity = NumberMask::g_maxNumber;
+	/// Recency of a number not drawn.
+	static constexpr uint8_t g_notDrawn = 0xFF;
+
+	/**
+	 * @brief Remove all the draws.
+	 */
+	constexpr void clear() {
+		m_size = 0;
+		m_mask.clear();
+		m_position.fill(0);
+	}
+
+	/**
+	 * @brief Add a draw at the end of the log.
+	 * @param iNumber The drawn number.
+	 * @param iSubRound Index of the sub-round of the draw.
+	 * @return False if the number is invalid or the log is full.
+	 */
+	constexpr auto push(const uint8_t iNumber, const uint8_t iSubRound) -> bool {
+		if (!NumberMask::isValid(iNumber) || m_size == g_capacity)
+			return false;
+		m_draws[m_size] = iNumber;
+		m_subRounds[m_size] = iSubRound;
+		++m_size;
+		m_position[iNumber] = m_size;
+		m_mask.set(iNumber);
+		return true;
+	}
+
+	/**
+	 * @brief Remove the last draw.
+	 */
+	constexpr void pop() {
+		if (m_size == 0)
+			return;
+		--m_size;
+		const uint8_t number = m_draws[m_size];
+		// a number drawn twice goes back to its previous position
+		m_position[number] = 0;
+		for (uint8_t pos = m_size; pos > 0; --pos) {
+			if (m_draws[pos - 1] == number) {
+				m_position[number] = pos;
+				break;
+			}
+		}
+		if (m_position[number] == 0)
+			m_mask.reset(number);
+	}
+
+	/**
+	 * @brief Get the number of draws.
+	 * @return The number of draws.
+	 */
+	[[nodiscard]] constexpr auto size() const -> uint8_t { return m_size; }
+
+	/**
+	 * @brief Check if there is no draw.
+	 * @return True if nothing has been drawn.
+	 */
+	[[nodiscard]] constexpr auto empty() const -> bool { return m_size == 0; }
+
+	/**
+	 * @brief Access to the ordered draws.
+	 * @return The draws, oldest first.
+	 */
+	[[nodiscard]] auto draws() const -> std::span<const uint8_t> { return {m_draws.data(), m_size}; }
+
+	/**
+	 * @brief Get the last drawn number.
+	 * @return The last number, 0 if nothing has been drawn.
+	 */
+	[[nodiscard]] constexpr auto last() const -> uint8_t { return m_size == 0 ? 0 : m_draws[m_size - 1]; }
+
+	/**
+	 * @brief Check if a number has been drawn.
+	 * @param iNumber The number.
+	 * @return True if drawn.
+	 */
+	[[nodiscard]] constexpr auto isDrawn(const uint8_t iNumber) const -> bool { return m_mask.test(iNumber); }
+
+	/**
+	 * @brief Get how recently a number has been drawn.
+	 * @param iNumber The number.
+	 * @return 0 for the last draw, 1 for the one before and so on, g_notDrawn if not drawn.
+	 */
+	[[nodiscard]] constexpr auto recency(const uint8_t iNumber) const -> uint8_t {
+		if (!m_mask.test(iNumber))
+			return g_notDrawn;
+		return static_cast<uint8_t>(m_size - m_position[iNumber]);
+	}
+
+	/**
+	 * @brief Get the sub-round of a draw.
+	 * @param iPosition Position of the draw in the log.
+	 * @return Index of the sub-round.
+	 */
+	[[nodiscard]] constexpr auto subRoundOf(const uint8_t iPosition) const -> uint8_t {
+		return m_subRounds[iPosition];
+	}
+
+	/**
+	 * @brief Access to the mask of the drawn numbers.
+	 * @return The mask.
+	 */
+	[[nodiscard]] constexpr auto mask() const -> const NumberMask& { return m_mask; }
+
+private:
+	/// The draws in order.
+	std::array<uint8_t, g_capacity> m_draws{};
+	/// Sub-round of each draw.
+	std::array<uint8_t, g_capacity> m_subRounds{};
+	/// Position (starting at 1) of the last draw of each number, 0 if not drawn.
+	std::array<uint8_t, g_capacity + 1> m_position{};
+	/// The drawn numbers.
+	NumberMask m_mask;
+	/// Number of draws.
+	uint8_t m_size = 0;
+};
+
+}// namespace evl::core
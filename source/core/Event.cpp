@@ -9,7 +9,11 @@
 
 #include "Event.h"
 
+#include "CardPack.h"
+#include "EventFile.h"
 #include "Log.h"
+#include "Migration.h"
+#include "TextStream.h"
 #include "utilities.h"
 
 namespace evl::core {
@@ -32,90 +36,191 @@ const std::unordered_map<Event::Status, const char*> g_statusConvert = {
 auto Event::getStatusStr() const -> std::string { return g_statusConvert.at(m_status); }
 
 // ---- Serialisation ----
-void Event::read(std::istream& iBs, int) {
+void Event::read(std::istream& iBs, int, const CardLoading iCards) {
+	const auto previousPack = m_cardPack;
 	uint16_t save_version = 0;
 	iBs.read(reinterpret_cast<char*>(&save_version), sizeof(uint16_t));
 	log_debug("Version des données du stream: {}, version courante: {}", save_version, getSaveVersion());
-	if (save_version > getSaveVersion())
+	if (save_version > getSaveVersion()) {
+		iBs.setstate(std::ios::failbit);
 		return;// incompatible
+	}
+	if (hasFormatChange(save_version, FormatChange::Chunks)) {
+		std::vector<uint8_t> data;
+		if (EventFileView view; EventFileView::readStream(iBs, save_version, data) && view.parse(data))
+			readChunks(view, iCards);
+		else {
+			log_warn("Impossible de lire l'événement");
+			iBs.setstate(std::ios::failbit);
+		}
+		return;
+	}
 	iBs.read(reinterpret_cast<char*>(&m_status), sizeof(m_status));
-	std::string::size_type l = 0;
-	std::string::size_type i = 0;
-	iBs.read(reinterpret_cast<char*>(&l), sizeof(l));
-	m_organizerName.resize(l);
-	for (i = 0; i < l; ++i) iBs.read(&m_organizerName[i], sizeof(std::string::value_type));
+	if (m_status > Status::Finished) {
+		m_status = Status::Invalid;
+		iBs.setstate(std::ios::failbit);
+	}
 	std::string temp;
-	iBs.read(reinterpret_cast<char*>(&l), sizeof(l));
-	temp.resize(l);
-	for (i = 0; i < l; ++i) iBs.read(&temp[i], sizeof(std::string::value_type));
+	eventFile::readLegacyString(iBs, m_organizerName);
+	eventFile::readLegacyString(iBs, temp);
 	m_organizerLogo = temp;
-	iBs.read(reinterpret_cast<char*>(&l), sizeof(l));
-	m_name.resize(l);
-	for (i = 0; i < l; ++i) iBs.read(&m_name[i], sizeof(std::string::value_type));
-	iBs.read(reinterpret_cast<char*>(&l), sizeof(l));
-	temp.resize(l);
-	for (i = 0; i < l; ++i) iBs.read(&temp[i], sizeof(std::string::value_type));
+	eventFile::readLegacyString(iBs, m_name);
+	eventFile::readLegacyString(iBs, temp);
 	m_logo = temp;
-	iBs.read(reinterpret_cast<char*>(&l), sizeof(l));
-	m_location.resize(l);
-	for (i = 0; i < l; ++i) iBs.read(&m_location[i], sizeof(std::string::value_type));
-	// version 2
-	if (save_version > 1) {
-		iBs.read(reinterpret_cast<char*>(&l), sizeof(l));
-		m_rules.resize(l);
-		for (i = 0; i < l; ++i) iBs.read(&m_rules[i], sizeof(std::string::value_type));
-	}
-	// version 3
-	if (save_version > 2 && save_version < 4) {//----UNCOVER----
-		std::string srules;//----UNCOVER----
-		iBs.read(reinterpret_cast<char*>(&l), sizeof(l));//----UNCOVER----
-		srules.resize(l);//----UNCOVER----
-		for (i = 0; i < l; ++i) iBs.read(&srules[i], sizeof(std::string::value_type));//----UNCOVER----
-	}//----UNCOVER----
-	// version 1
+	eventFile::readLegacyString(iBs, m_location);
+	m_rules.clear();
+	if (hasFormatChange(save_version, FormatChange::EventRules))
+		eventFile::readLegacyString(iBs, m_rules);
+	// chaîne propre à la version 3, abandonnée depuis
+	if (hasFormatChange(save_version, FormatChange::RoundIds) &&
+		!hasFormatChange(save_version, FormatChange::SubRoundResults))
+		eventFile::readLegacyString(iBs, temp);
 	rounds_type::size_type lv = 0;
 	iBs.read(reinterpret_cast<char*>(&lv), sizeof(lv));
+	if (!iBs || lv > eventFile::g_maxRounds) {
+		log_warn("Impossible de lire l'événement");
+		iBs.setstate(std::ios::failbit);
+		m_gameRounds.clear();
+		afterRead(iCards, previousPack);
+		return;
+	}
 	m_gameRounds.resize(lv);
 	for (rounds_type::size_type iv = 0; iv < lv; ++iv) m_gameRounds[iv].read(iBs, save_version);
 	log_info("Event lu et contenant {} parties", lv);
 	iBs.read(reinterpret_cast<char*>(&m_start), sizeof(m_start));
 	iBs.read(reinterpret_cast<char*>(&m_end), sizeof(m_end));
+	m_cardPack.clear();
+	if (hasFormatChange(save_version, FormatChange::CardPack)) {
+		eventFile::readLegacyString(iBs, temp);
+		m_cardPack = temp;
+	}
+	afterRead(iCards, previousPack);
+}
+
+void Event::readChunks(const EventFileView& iView, const CardLoading iCards) {
+	using String = eventFile::EventString;
+	const auto previousPack = m_cardPack;
+	m_status = static_cast<Status>(iView.getStatus());
+	m_organizerName = iView.getString(String::OrganizerName);
+	m_organizerLogo = iView.getString(String::OrganizerLogo);
+	m_name = iView.getString(String::Name);
+	m_logo = iView.getString(String::Logo);
+	m_location = iView.getString(String::Location);
+	m_rules = iView.getString(String::Rules);
+	m_cardPack = iView.getString(String::CardPack);
+	m_start = iView.getStart();
+	m_end = iView.getEnd();
+	m_gameRounds.resize(iView.roundCount());
+	for (uint32_t i = 0; i < iView.roundCount(); ++i) m_gameRounds[i].readChunk(iView, i);
+	log_info("Event lu et contenant {} parties", m_gameRounds.size());
+	afterRead(iCards, previousPack);
+}
+
+void Event::afterRead(const CardLoading iCards, const std::filesystem::path& iPreviousPack) {
+	rewindCurrentGameRound();
+	if (iCards == CardLoading::Skip) {
+		m_cards.clear();
+		m_pendingWinners.clear();
+		m_cardsRound = -1;
+	} else if (iCards == CardLoading::Keep && m_cardPack == iPreviousPack && !m_cards.isIndexDirty()) {
+		m_pendingWinners.clear();
+		syncCards();
+	} else {
+		loadCardPack();
+		rebuildCardIndex();
+	}
+	m_forecast.reset(m_gameRounds);
+	rebuildStats();
 	log_info("Event in state: {}", getStateString());
 }
 
 void Event::write(std::ostream& oBs) const {
-	const auto vers = getSaveVersion();
-	oBs.write(reinterpret_cast<const char*>(&vers), sizeof(uint16_t));
-	oBs.write(reinterpret_cast<const char*>(&m_status), sizeof(m_status));
-	std::string::size_type l = 0;
-	std::string::size_type i = 0;
-	l = m_organizerName.size();
-	oBs.write(reinterpret_cast<char*>(&l), sizeof(l));
-	for (i = 0; i < l; ++i) oBs.write(&m_organizerName[i], sizeof(std::string::value_type));
-	l = m_organizerLogo.string().size();
-	oBs.write(reinterpret_cast<char*>(&l), sizeof(l));
-	for (i = 0; i < l; ++i) oBs.write(&m_organizerLogo.string()[i], sizeof(std::string::value_type));
-	l = m_name.size();
-	oBs.write(reinterpret_cast<char*>(&l), sizeof(l));
-	for (i = 0; i < l; ++i) oBs.write(&m_name[i], sizeof(std::string::value_type));
-	l = m_logo.string().size();
-	oBs.write(reinterpret_cast<char*>(&l), sizeof(l));
-	for (i = 0; i < l; ++i) oBs.write(&m_logo.string()[i], sizeof(std::string::value_type));
-	l = m_location.size();
-	oBs.write(reinterpret_cast<char*>(&l), sizeof(l));
-	for (i = 0; i < l; ++i) oBs.write(&m_location[i], sizeof(std::string::value_type));
-	// version >= 2
-	l = m_rules.size();
-	oBs.write(reinterpret_cast<char*>(&l), sizeof(l));
-	for (i = 0; i < l; ++i) oBs.write(&m_rules[i], sizeof(std::string::value_type));
-	// version >= 1
-	rounds_type::size_type lv = 0;
-	lv = m_gameRounds.size();
-	oBs.write(reinterpret_cast<char*>(&lv), sizeof(lv));
-	for (rounds_type::size_type iv = 0; iv < lv; ++iv) m_gameRounds[iv].write(oBs);
+	constexpr auto record = eventFile::Chunk::Event;
+	EventFileWriter writer;
+	writer.put(record, static_cast<uint8_t>(m_status));
+	writer.putTime(record, m_start);
+	writer.putTime(record, m_end);
+	writer.putString(record, m_organizerName);
+	writer.putString(record, m_organizerLogo.string());
+	writer.putString(record, m_name);
+	writer.putString(record, m_logo.string());
+	writer.putString(record, m_location);
+	writer.putString(record, m_rules);
+	writer.putString(record, m_cardPack.string());
+	for (const auto& round: m_gameRounds) round.writeChunk(writer);
+	writer.write(oBs);
+}
+
+auto Event::readText(TextReader& ioReader) -> bool {
+	if (!ioReader.enterMap())
+		return false;
+	std::string key;
+	std::string text;
+	while (ioReader.nextKey(key)) {
+		if (key == "status") {
+			if (!ioReader.readString(text))
+				break;
+			if (const auto result = std::ranges::find_if(
+						g_statusConvert, [&text](const auto& iItem) -> auto { return iItem.second == text; });
+				result != g_statusConvert.end()) {
+				m_status = result->first;
+				m_previousStatus = m_status;
+			}
+		} else if (key == "organizerName") {
+			ioReader.readString(m_organizerName);
+		} else if (key == "organizerLogo") {
+			if (ioReader.readString(text))
+				m_organizerLogo = text;
+		} else if (key == "name") {
+			ioReader.readString(m_name);
+		} else if (key == "logo") {
+			if (ioReader.readString(text))
+				m_logo = text;
+		} else if (key == "location") {
+			ioReader.readString(m_location);
+		} else if (key == "rules") {
+			ioReader.readString(m_rules);
+		} else if (key == "cardPack") {
+			if (ioReader.readString(text))
+				m_cardPack = text;
+		} else if (key == "start") {
+			ioReader.readTime(m_start);
+		} else if (key == "end") {
+			ioReader.readTime(m_end);
+		} else if (key == "rounds") {
+			m_gameRounds.clear();
+			if (!ioReader.enterSeq())
+				break;
+			while (ioReader.nextItem())
+				if (!m_gameRounds.emplace_back().readText(ioReader))
+					break;
+		} else {
+			ioReader.skip();
+		}
+	}
+	if (ioReader.hasFailed())
+		return false;
+	afterRead();
+	return true;
+}
 
-	oBs.write(reinterpret_cast<const char*>(&m_start), sizeof(m_start));
-	oBs.write(reinterpret_cast<const char*>(&m_end), sizeof(m_end));
+void Event::writeText(TextWriter& ioWriter) const {
+	ioWriter.beginMap();
+	ioWriter.putString("status", getStatusStr());
+	ioWriter.putString("organizerName", m_organizerName);
+	ioWriter.putString("organizerLogo", m_organizerLogo.string());
+	ioWriter.putString("name", m_name);
+	ioWriter.putString("logo", m_logo.string());
+	ioWriter.putString("location", m_location);
+	ioWriter.putString("rules", m_rules);
+	ioWriter.putString("cardPack", m_cardPack.string());
+	ioWriter.putTime("start", m_start);
+	ioWriter.putTime("end", m_end);
+	ioWriter.key("rounds");
+	ioWriter.beginSeq();
+	for (const auto& round: m_gameRounds) round.writeText(ioWriter);
+	ioWriter.endSeq();
+	ioWriter.endMap();
 }
 
 auto Event::toJson() const -> Json::Value {
@@ -129,6 +234,10 @@ auto Event::toJson() const -> Json::Value {
 void Event::fromJson(const Json::Value& iJson) {
 	m_gameRounds.clear();
 	for (auto& jj: iJson.get("rounds", Json::Value::null)) { m_gameRounds.emplace_back().fromJson(jj); }
+	rewindCurrentGameRound();
+	rebuildCardIndex();
+	m_forecast.reset(m_gameRounds);
+	rebuildStats();
 }
 
 auto Event::toYaml() const -> YAML::Node {
@@ -146,35 +255,106 @@ void Event::fromYaml(const YAML::Node& iNode) {
 		gr.fromYaml(jj);
 		m_gameRounds.push_back(gr);
 	}
+	rewindCurrentGameRound();
+	rebuildCardIndex();
+	m_forecast.reset(m_gameRounds);
+	rebuildStats();
 }
 
-void Event::exportJSON(const std::filesystem::path& iFile) const {
-	std::ofstream file_save;
-	file_save.open(iFile, std::ios::out | std::ios::binary);
-	file_save << std::setw(4) << toJson();
-	file_save.close();
+void Event::setCardPack(const std::filesystem::path& iPack) {
+	if (!isEditable())
+		return;
+	if (iPack.empty() || iPack.is_relative() || m_basePath.empty())
+		m_cardPack = iPack;
+	else
+		m_cardPack = relative(iPack, m_basePath);
+	loadCardPack();
+	rebuildCardIndex();
 }
 
-void Event::importJSON(const std::filesystem::path& iFile) {
-	std::ifstream file_read;
-	file_read.open(iFile, std::ios::in | std::ios::binary);
-	Json::Value j;
-	file_read >> j;
-	fromJson(j);
-	file_read.close();
+void Event::loadCardPack() {
+	m_cards.clear();
+	if (m_cardPack.empty())
+		return;
+	CardPack pack;
+	if (!pack.open(getCardPackFull())) {
+		log_warn("Impossible de charger les cartons de '{}'", m_cardPack.string());
+		return;
+	}
+	pack.loadInto(m_cards);
 }
 
-void Event::exportYaml(const std::filesystem::path& iFile) const {
-	YAML::Emitter out;
-	out << toYaml();
-	std::ofstream fileOut(iFile);
-	fileOut << out.c_str();
-	fileOut.close();
+void Event::rebuildCardIndex() {
+	m_pendingWinners.clear();
+	if (m_cards.empty())
+		return;
+	m_cards.buildIndex();
+	syncCards();
 }
 
-void Event::importYaml(const std::filesystem::path& iFile) {
-	const YAML::Node data = YAML::LoadFile(iFile.string());
-	fromYaml(data);
+auto Event::exportJSON(const std::filesystem::path& iFile) const -> bool {
+	std::ofstream file(iFile, std::ios::out | std::ios::binary);
+	JsonWriter writer(file);
+	writeText(writer);
+	file.flush();
+	if (!writer.good()) {
+		log_warn("Impossible d'écrire le fichier '{}'", iFile.string());
+		return false;
+	}
+	return true;
+}
+
+auto Event::importJSON(const std::filesystem::path& iFile) -> bool {
+	std::ifstream file(iFile, std::ios::in | std::ios::binary);
+	JsonReader reader(file);
+	return importText(reader, iFile);
+}
+
+auto Event::exportYaml(const std::filesystem::path& iFile) const -> bool {
+	std::ofstream file(iFile, std::ios::out | std::ios::binary);
+	YamlWriter writer(file);
+	writeText(writer);
+	file.flush();
+	if (!writer.good()) {
+		log_warn("Impossible d'écrire le fichier '{}'", iFile.string());
+		return false;
+	}
+	return true;
+}
+
+auto Event::importYaml(const std::filesystem::path& iFile) -> bool {
+	std::ifstream file(iFile, std::ios::in | std::ios::binary);
+	YamlReader reader(file);
+	return importText(reader, iFile);
+}
+
+auto Event::importText(TextReader& ioReader, const std::filesystem::path& iFile) -> bool {
+	if (!isEditable()) {
+		log_warn("Impossible d'importer des parties dans un événement commencé");
+		return false;
+	}
+	// lecture à part: l’événement reste intact si le fichier est invalide
+	Event imported;
+	if (!imported.readText(ioReader) || ioReader.next() != TextReader::Token::End) {
+		log_warn("Impossible d'importer le fichier '{}': {}", iFile.string(), ioReader.getError());
+		return false;
+	}
+	// seule la configuration des parties est reprise, comme un modèle
+	m_gameRounds.clear();
+	for (const auto& round: imported.m_gameRounds) {
+		auto& target = m_gameRounds.emplace_back(round.getType());
+		target.setId(round.getId());
+		if (const auto [path, delay] = round.getDiapo(); !path.empty())
+			target.setDiapo(path.string(), delay);
+		if (target.sizeSubRound() != round.sizeSubRound())
+			continue;
+		auto sub = round.beginSubRound();
+		for (uint32_t i = 0; i < target.sizeSubRound(); ++i, ++sub)
+			target.getSubRound(i)->define(sub->getType(), sub->getPrices(), sub->getValue());
+	}
+	checkValidConfig();
+	afterRead();
+	return true;
 }
 
 void Event::checkValidConfig() {
@@ -241,6 +421,7 @@ void Event::setOrganizerLogo(const std::filesystem::path& iLogo) {
 void Event::setBasePath(const std::filesystem::path& iBasePath) {
 	const std::filesystem::path t_logo = getLogoFull();
 	const std::filesystem::path t_org_logo = getOrganizerLogoFull();
+	const std::filesystem::path t_card_pack = getCardPackFull();
 	if (is_directory(iBasePath))
 		m_basePath = iBasePath;
 	else
@@ -253,6 +434,10 @@ void Event::setBasePath(const std::filesystem::path& iBasePath) {
 		m_organizerLogo = t_org_logo;
 	else
 		m_organizerLogo = relative(t_org_logo, m_basePath);
+	if (t_card_pack.empty() || t_card_pack.is_relative() || m_basePath.empty())
+		m_cardPack = t_card_pack;
+	else
+		m_cardPack = relative(t_card_pack, m_basePath);
 }
 
 void Event::setRules(const std::string& iNewRules) {
@@ -269,6 +454,9 @@ void Event::pushGameRound(const GameRound& iRound) {
 		return;
 	}
 	m_gameRounds.push_back(iRound);
+	rewindCurrentGameRound();
+	m_forecast.reset(m_gameRounds);
+	rebuildStats();
 	checkValidConfig();
 }
 
@@ -286,6 +474,9 @@ void Event::deleteRoundByIndex(const uint16_t& iIndex) {
 		return;
 	}
 	m_gameRounds.erase(std::next(m_gameRounds.begin(), iIndex));
+	rewindCurrentGameRound();
+	m_forecast.reset(m_gameRounds);
+	rebuildStats();
 }
 
 void Event::swapRoundByIndex(const uint16_t& iIndex, const uint16_t& iIndex2) {
@@ -305,13 +496,11 @@ void Event::swapRoundByIndex(const uint16_t& iIndex, const uint16_t& iIndex2) {
 }
 
 auto Event::getCurrentCGameRound() const -> rounds_type::const_iterator {
-	return std::ranges::find_if(
-			m_gameRounds, [](const GameRound& iGr) -> bool { return iGr.getStatus() != GameRound::Status::Done; });
+	return std::next(m_gameRounds.cbegin(), static_cast<std::ptrdiff_t>(m_currentRound));
 }
 
 auto Event::getCurrentGameRound() -> rounds_type::iterator {
-	return std::ranges::find_if(
-			m_gameRounds, [](const GameRound& iGr) -> bool { return iGr.getStatus() != GameRound::Status::Done; });
+	return std::next(m_gameRounds.begin(), static_cast<std::ptrdiff_t>(m_currentRound));
 }
 
 auto Event::getGameRound(const uint32_t& iIndex) -> rounds_type::iterator {
@@ -319,10 +508,9 @@ auto Event::getGameRound(const uint32_t& iIndex) -> rounds_type::iterator {
 }
 
 auto Event::getCurrentGameRoundIndex() const -> int {
-	const uint64_t i = static_cast<uint64_t>(getCurrentCGameRound() - m_gameRounds.begin());
-	if (i >= m_gameRounds.size())
+	if (m_currentRound >= m_gameRounds.size())
 		return -1;
-	return static_cast<int>(i);
+	return static_cast<int>(m_currentRound);
 }
 
 auto Event::getNextCGameRound() const -> rounds_type::const_iterator {
@@ -342,7 +530,7 @@ auto Event::getNextGameRound() -> rounds_type::iterator {
 // ----- Action sur le flow -----
 
 //NOLINTBEGIN(misc-no-recursion)
-void Event::nextState() {
+void Event::nextState(const time_point& iTime) {
 	const auto status_save = m_status;
 	m_changed = false;
 	const auto sub = getCurrentGameRound();
@@ -353,11 +541,13 @@ void Event::nextState() {
 			break;
 		case Status::Ready:
 			m_status = Status::EventStarting;
-			m_start = clock::now();
+			m_start = iTime;
+			m_forecast.reset(m_gameRounds);
 			break;
 		case Status::EventStarting:
 			m_status = Status::GameRunning;
-			sub->nextStatus();
+			sub->nextStatus(iTime);
+			advanceCurrentGameRound();
 			break;
 		case Status::DisplayRules:
 			m_status = Status::GameRunning;
@@ -366,10 +556,19 @@ void Event::nextState() {
 			if (sub == m_gameRounds.end()) {
 				m_status = Status::EventEnding;
 			} else {
-				sub->nextStatus();
+				const auto roundStatus = sub->getStatus();
+				sub->nextStatus(iTime);
+				if (sub->getType() == GameRound::Type::Pause && roundStatus == GameRound::Status::Running &&
+					sub->getStatus() == GameRound::Status::PostScreen)
+					m_forecast.closePause(sub->getEnding() - sub->getStarting());
 				if (sub->isFinished()) {
-					m_end = clock::now();
-					nextState();
+					advanceCurrentGameRound();
+					if (sub->getType() != GameRound::Type::Pause)
+						m_forecast.closeRound(*sub);
+					if (sub->getType() != GameRound::Type::Pause && sub->getType() != GameRound::Type::Enfant)
+						m_stats.pushFinishedRound(*sub);
+					m_end = iTime;
+					nextState(iTime);
 				}
 				m_changed = true;
 			}
@@ -382,6 +581,8 @@ void Event::nextState() {
 	}
 	if (status_save != m_status)
 		m_changed = true;
+	if (m_cardsRound != getCurrentGameRoundIndex())
+		syncCards();
 	if (m_changed)
 		log_info("Event switching to {}", getStateString());
 	else
@@ -398,14 +599,128 @@ auto Event::getStateString() const -> std::string {
 	return result;
 }
 
-void Event::addWinnerToCurrentRound(const std::string& iWin) {
+void Event::addWinnerToCurrentRound(const std::string& iWin, const time_point& iTime) {
 	if (m_status != Status::GameRunning)
 		return;
 	const auto round = getCurrentGameRound();
-	round->addWinner(iWin);
+	const auto sub = round->getCurrentSubRound();
+	const bool wasRunning = sub != round->endSubRound() && !sub->isFinished();
+	round->addWinner(iWin, iTime);
+	m_pendingWinners.clear();
+	if (wasRunning && sub->isFinished()) {
+		m_forecast.closeSubRound(Forecast::kindOf(*round, *sub), sub->getDraws().size());
+		if (round->getType() != GameRound::Type::Enfant)
+			m_stats.pushSubRound(*sub);
+	}
 	if (round->isFinished()) {
-		nextState();
+		nextState(iTime);
+		return;
+	}
+	// les cartons ayant déjà atteint la sous-partie suivante gagnent dès son ouverture
+	if (!wasRunning || !sub->isFinished() || m_cards.empty() || round->getType() == GameRound::Type::Inverse)
+		return;
+	if (!isCardTrackingInSync(round->drawsCount()))
+		syncCards();
+	m_pendingWinners = m_cards.getTrackedWinners(round->getCurrentSubRound()->getType());
+	if (!m_pendingWinners.empty())
+		log_info("Cartons gagnants détectés: {}", getPendingWinnersStr());
+}
+
+void Event::addPickedNumber(const uint8_t iNumber, const time_point& iTime) {
+	if (!canDraw()) {
+		log_warn("Impossible de tirer un numéro hors d'une partie en cours");
+		return;
 	}
+	const auto round = getCurrentGameRound();
+	const auto count = round->drawsCount();
+	round->addPickedNumber(iNumber, iTime);
+	m_pendingWinners.clear();
+	if (round->drawsCount() == count)
+		return;
+	const auto type = round->getCurrentSubRound()->getType();
+	m_forecast.pushDraw(Forecast::kindOf(*round, *round->getCurrentSubRound()), iTime);
+	if (round->getType() != GameRound::Type::Enfant)
+		m_stats.pushDraw(iNumber);
+	if (m_cards.empty())
+		return;
+	if (round->getType() == GameRound::Type::Inverse) {
+		if (isCardTrackingInSync(count))
+			m_cards.eliminate(iNumber);
+		else
+			syncCards();
+		updateSurvivorWinners();
+		return;
+	}
+	if (isCardTrackingInSync(count)) {
+		m_pendingWinners = m_cards.applyDraw(iNumber, type);
+	} else {
+		syncCards();
+		m_pendingWinners = m_cards.getWinnersByDraw(iNumber, type);
+	}
+	if (!m_pendingWinners.empty())
+		log_info("Cartons gagnants détectés: {}", getPendingWinnersStr());
+}
+
+void Event::removeLastPick() {
+	if (!canDraw())
+		return;
+	const auto round = getCurrentGameRound();
+	const auto count = round->drawsCount();
+	const uint8_t last = round->getLastCancelableDraw();
+	round->removeLastPick();
+	m_pendingWinners.clear();
+	if (round->drawsCount() == count)
+		return;
+	m_forecast.popDraw();
+	if (round->getType() != GameRound::Type::Enfant)
+		m_stats.popDraw(last);
+	if (m_cards.empty())
+		return;
+	const bool inverse = round->getType() == GameRound::Type::Inverse;
+	if (!isCardTrackingInSync(count))
+		syncCards();
+	else if (inverse)
+		m_cards.undoElimination();
+	else
+		m_cards.undoDraw(last);
+	if (inverse)
+		updateSurvivorWinners();
+	else
+		m_pendingWinners =
+				m_cards.getWinnersByDraw(round->getLastCancelableDraw(), round->getCurrentSubRound()->getType());
+}
+
+auto Event::isCardTrackingInSync(const GameRound::draws_type::size_type iCount) const -> bool {
+	if (m_cards.isIndexDirty() || m_cardsRound != getCurrentGameRoundIndex())
+		return false;
+	if (getCurrentCGameRound()->getType() == GameRound::Type::Inverse)
+		return m_cards.getEliminationDepth() == iCount;
+	return m_cards.getTrackedDraws().count() == iCount;
+}
+
+void Event::syncCards() {
+	m_cardsRound = getCurrentGameRoundIndex();
+	if (m_cards.empty())
+		return;
+	const auto round = getCurrentCGameRound();
+	if (round == m_gameRounds.cend()) {
+		m_cards.syncTracking({});
+		return;
+	}
+	const auto draws = round->getDrawLog().draws();
+	if (round->getType() == GameRound::Type::Inverse)
+		m_cards.syncElimination(draws);
+	else
+		m_cards.syncTracking(draws);
+}
+
+void Event::updateSurvivorWinners() {
+	// Le dernier survivant gagne, si le tirage élimine tous les survivants ils sont ex æquo.
+	if (m_cards.getSurvivorCount() == 1)
+		m_pendingWinners = m_cards.getSurvivors(1);
+	else if (m_cards.getSurvivorCount() == 0)
+		m_pendingWinners = m_cards.getLastEliminated();
+	log_info("Cartons restants: {}", m_cards.getSurvivorCount());
 }
 
 void Event::displayRules() {
@@ -427,8 +742,13 @@ void Event::changeStatus(const Status& iNewStatus) {
 
 void Event::restoreStatus() { m_status = m_previousStatus; }
 
-auto Event::getStats(const bool iWithoutChild) const -> Statistics {
+auto Event::computeStats(const bool iWithoutChild) const -> Statistics {
 	Statistics stat;
+	fillStats(stat, iWithoutChild);
+	return stat;
+}
+
+void Event::fillStats(Statistics& oStats, const bool iWithoutChild) const {
 	for (const auto& round: m_gameRounds) {
 		if (round.getType() == GameRound::Type::Pause)
 			continue;
@@ -436,9 +756,8 @@ auto Event::getStats(const bool iWithoutChild) const -> Statistics {
 			break;
 		if (iWithoutChild && round.getType() == GameRound::Type::Enfant)
 			continue;
-		stat.pushRound(round);
+		oStats.pushRound(round);
 	}
-	return stat;
 }
 
 auto Event::getProgression() const -> float {
@@ -6,6 +6,8 @@
  * All modification must get authorization from the author.
  */
 #pragma once
+#include "CardRegistry.h"
+#include "Forecast.h"
 #include "GameRound.h"
 #include "Serializable.h"
 #include "Statistics.h"
@@ -40,13 +42,28 @@ public:
 	 */
 	[[nodiscard]] auto getStatusStr() const -> std::string;
 
+	/// Traitement des cartons à la lecture.
+	enum struct CardLoading : uint8_t {
+		Load,///< Le fichier de cartons est chargé et indexé.
+		Keep,///< Les cartons chargés sont gardés si le fichier de cartons n’a pas changé, seul le suivi est recalculé.
+		Skip,///< Pas de cartons : seules les données de l’événement sont lues (validation, statistiques).
+	};
+
 	// ---- Serialisation ----
 	/**
 	 * @brief Lecture depuis un stream
 	 * @param iBs Le stream d’entrée.
 	 * @param iFileVersion La version du fichier à lire
 	 */
-	void read(std::istream& iBs, int iFileVersion) override;
+	void read(std::istream& iBs, int iFileVersion) override { read(iBs, iFileVersion, CardLoading::Load); }
+
+	/**
+	 * @brief Lecture depuis un stream
+	 * @param iBs Le stream d’entrée.
+	 * @param iFileVersion La version du fichier à lire
+	 * @param iCards Le traitement des cartons.
+	 */
+	void read(std::istream& iBs, int iFileVersion, CardLoading iCards);
 
 	/**
 	 * @brief Écriture dans un stream.
@@ -54,6 +71,26 @@ public:
 	 */
 	void write(std::ostream& oBs) const override;
 
+	/**
+	 * @brief Lecture depuis un fichier par blocs (version 9 et suivantes), par exemple projeté en mémoire.
+	 * @param iView Le fichier validé.
+	 * @param iCards Le traitement des cartons.
+	 */
+	void readChunks(const EventFileView& iView, CardLoading iCards = CardLoading::Load);
+
+	/**
+	 * @brief Lecture en flux depuis un document JSON ou YAML, avec l’état de l’événement.
+	 * @param ioReader Le lecteur du document.
+	 * @return Faux si le document est invalide.
+	 */
+	auto readText(TextReader& ioReader) -> bool;
+
+	/**
+	 * @brief Écriture en flux dans un document JSON ou YAML.
+	 * @param ioWriter Le rédacteur du document.
+	 */
+	void writeText(TextWriter& ioWriter) const;
+
 	/**
 	 * @brief Écriture dans un json.
 	 * @return Le json à remplir
@@ -79,28 +116,40 @@ public:
 	void fromYaml(const YAML::Node& iNode) override;
 
 	/**
-	 * @brief Export des parties au format JSON
+	 * @brief Export de l’événement complet au format JSON, écrit en flux.
 	 * @param iFile Le fichier où exporter
+	 * @return Faux si le fichier n’a pas pu être écrit.
 	 */
-	void exportJSON(const std::filesystem::path& iFile) const;
+	auto exportJSON(const std::filesystem::path& iFile) const -> bool;
 
 	/**
-	 * @brief Import des parties au format JSON
+	 * @brief Import des parties d’un modèle au format JSON, lu en flux.
+	 *
+	 * Seule la configuration des parties est reprise (types, lots, diaporamas) : l’état, les tirages et les
+	 * gagnants du fichier sont ignorés. L’événement n’est pas modifié si le fichier est invalide ou si
+	 * l’événement n’est plus éditable.
 	 * @param iFile Le fichier à importer
+	 * @return Faux si le fichier est invalide.
 	 */
-	void importJSON(const std::filesystem::path& iFile);
+	auto importJSON(const std::filesystem::path& iFile) -> bool;
 
 	/**
-	 * @brief Export des parties au format YAML
+	 * @brief Export de l’événement complet au format YAML, écrit en flux.
 	 * @param iFile Le fichier où exporter
+	 * @return Faux si le fichier n’a pas pu être écrit.
 	 */
-	void exportYaml(const std::filesystem::path& iFile) const;
+	auto exportYaml(const std::filesystem::path& iFile) const -> bool;
 
 	/**
-	 * @brief Import des parties au format YAML
+	 * @brief Import des parties d’un modèle au format YAML, lu en flux.
+	 *
+	 * Seule la configuration des parties est reprise (types, lots, diaporamas) : l’état, les tirages et les
+	 * gagnants du fichier sont ignorés. L’événement n’est pas modifié si le fichier est invalide ou si
+	 * l’événement n’est plus éditable.
 	 * @param iFile Le fichier à importer
+	 * @return Faux si le fichier est invalide.
 	 */
-	void importYaml(const std::filesystem::path& iFile);
+	auto importYaml(const std::filesystem::path& iFile) -> bool;
 
 	// ---- manipulation du statut ----
 	/**
@@ -235,13 +284,13 @@ public:
 	}
 
 	/**
-	 * @brief Cherche la première partie non terminée de la liste.
+	 * @brief Renvoie la première partie non terminée de la liste (index tenu à jour, en temps constant).
 	 * @return La première partie non terminée de la liste.
 	 */
 	[[nodiscard]] auto getCurrentCGameRound() const -> rounds_type::const_iterator;
 
 	/**
-	 * @brief Cherche la première partie non terminée de la liste.
+	 * @brief Renvoie la première partie non terminée de la liste (index tenu à jour, en temps constant).
 	 * @return La première partie non terminée de la liste.
 	 */
 	auto getCurrentGameRound() -> rounds_type::iterator;
@@ -287,8 +336,9 @@ public:
 
 	/**
 	 * @brief Démarre l’événement
+	 * @param iTime Date et heure du changement.
 	 */
-	void nextState();
+	void nextState(const time_point& iTime = clock::now());
 
 	/**
 	 * @brief Renvoie une chaine de caractère décrivant l'état courant
@@ -304,8 +354,90 @@ public:
 	/**
 	 * @brief Termine la partie en cours.
 	 * @param iWin Le numéro de la grille à ajouter
+	 * @param iTime Date et heure de la fin de la sous-partie.
 	 */
-	void addWinnerToCurrentRound(const std::string& iWin);
+	void addWinnerToCurrentRound(const std::string& iWin, const time_point& iTime = clock::now());
+
+	/**
+	 * @brief Ajoute un numéro tiré à la partie courante et recherche les cartons gagnants.
+	 * @param iNumber Le numéro tiré.
+	 * @param iTime Date et heure du tirage.
+	 */
+	void addPickedNumber(uint8_t iNumber, const time_point& iTime = clock::now());
+
+	/**
+	 * @brief Annule le dernier tirage de la partie courante.
+	 */
+	void removeLastPick();
+
+	// ---- cartons ----
+	/**
+	 * @brief Accès aux cartons vendus pour l’événement.
+	 * @return Les cartons.
+	 */
+	[[nodiscard]] auto getCards() const -> const CardRegistry& { return m_cards; }
+
+	/**
+	 * @brief Accès aux cartons vendus pour l’événement.
+	 * @return Les cartons.
+	 */
+	auto getCards() -> CardRegistry& { return m_cards; }
+
+	/**
+	 * @brief Renvoie le fichier de cartons de l’événement.
+	 * @return Le chemin du fichier de cartons (relatif au chemin de base).
+	 */
+	[[nodiscard]] auto getCardPack() const -> const std::filesystem::path& { return m_cardPack; }
+
+	/**
+	 * @brief Renvoie le chemin complet du fichier de cartons de l’événement.
+	 * @return Le chemin complet du fichier de cartons.
+	 */
+	[[nodiscard]] auto getCardPackFull() const -> std::filesystem::path {
+		if (m_cardPack.empty())
+			return m_cardPack;
+		return getBasePath() / getCardPack();
+	}
+
+	/**
+	 * @brief Définit le fichier de cartons de l’événement et charge ses cartons.
+	 * @param iPack Le fichier de cartons.
+	 */
+	void setCardPack(const std::filesystem::path& iPack);
+
+	/**
+	 * @brief Renvoie les cartons ayant gagné la sous-partie courante au dernier tirage.
+	 * @return Les cartons gagnants.
+	 */
+	[[nodiscard]] auto getPendingWinners() const -> const CardRegistry::winners_type& { return m_pendingWinners; }
+
+	/**
+	 * @brief Reconstruit l’index des cartons et le resynchronise avec la partie courante.
+	 */
+	void rebuildCardIndex();
+
+	/**
+	 * @brief Renvoie le nombre de cartons encore en jeu dans une partie inverse.
+	 * @return Le nombre de cartons survivants.
+	 */
+	[[nodiscard]] auto getSurvivorCount() const -> size_t { return m_cards.getSurvivorCount(); }
+
+	/**
+	 * @brief Renvoie les numéros des derniers cartons encore en jeu dans une partie inverse.
+	 * @param iLimit Le nombre maximal de cartons renvoyés.
+	 * @return Les numéros des cartons survivants.
+	 */
+	[[nodiscard]] auto getSurvivorsStr(const size_t iLimit) const -> std::string {
+		return m_cards.getSerialsStr(m_cards.getSurvivors(iLimit));
+	}
+
+	/**
+	 * @brief Renvoie les numéros des cartons ayant gagné la sous-partie courante au dernier tirage.
+	 * @return Les numéros des cartons gagnants (vide si aucun).
+	 */
+	[[nodiscard]] auto getPendingWinnersStr() const -> std::string {
+		return m_cards.getSerialsStr(m_pendingWinners);
+	}
 
 	/**
 	 * @brief Passe l’événement en mode d’affichage des règles.
@@ -353,10 +485,18 @@ public:
 	void setBasePath(const std::filesystem::path& iBasePath);
 
 	/**
-	 * @brief Renvoie le nombre de tirages et la liste des numéros les moins tirés
+	 * @brief Renvoie les statistiques de l’événement hors parties enfant, tenues à jour à chaque tirage, annulation,
+	 * gagnant et fin de partie.
 	 * @return Les statistiques
 	 */
-	[[nodiscard]] auto getStats(bool iWithoutChild = true) const -> Statistics;
+	[[nodiscard]] auto getStats() const -> const Statistics& { return m_stats; }
+
+	/**
+	 * @brief Recalcule les statistiques en parcourant toutes les parties.
+	 * @param iWithoutChild Si vrai, ignore les parties enfant.
+	 * @return Les statistiques
+	 */
+	[[nodiscard]] auto computeStats(bool iWithoutChild = true) const -> Statistics;
 
 	/**
 	 * @brief Renvoie la progression de l’événement entre 0.0 et 1.0
@@ -364,6 +504,12 @@ public:
 	 */
 	[[nodiscard]] auto getProgression() const -> float;
 
+	/**
+	 * @brief Renvoie l’estimation de la durée restante, mise à jour à chaque tirage et changement d’état.
+	 * @return L’estimation.
+	 */
+	[[nodiscard]] auto getForecast() const -> const Forecast& { return m_forecast; }
+
 	/**
 	 * @brief Vérifie si l’événement attend un tirage de numéro.
 	 * @return True si l’événement attend un tirage de numéro.
@@ -403,6 +549,9 @@ private:
 	/// Liste des parties de l’événement.
 	rounds_type m_gameRounds;
 
+	/// Fichier des cartons vendus pour l’événement.
+	std::filesystem::path m_cardPack;
+
 	/// La date et heure de début de l’événement
 	time_point m_start;
 
@@ -415,6 +564,91 @@ private:
 	/// status change
 	bool m_changed = false;
 
+	/// Les cartons vendus pour l’événement.
+	CardRegistry m_cards;
+
+	/// Les cartons gagnants détectés au dernier tirage.
+	CardRegistry::winners_type m_pendingWinners;
+
+	/// Index de la partie suivie par les compteurs des cartons.
+	int m_cardsRound = -1;
+
+	/// L’estimation de la durée restante.
+	Forecast m_forecast;
+
+	/// Les statistiques courantes (hors parties enfant).
+	Statistics m_stats;
+
+	/// Index de la partie courante (la première non terminée).
+	rounds_type::size_type m_currentRound = 0;
+
+	/**
+	 * @brief Ajoute aux statistiques les parties commencées.
+	 * @param oStats Les statistiques à compléter.
+	 * @param iWithoutChild Si vrai, ignore les parties enfant.
+	 */
+	void fillStats(Statistics& oStats, bool iWithoutChild) const;
+
+	/**
+	 * @brief Recalcule les statistiques courantes.
+	 */
+	void rebuildStats() {
+		m_stats.clear();
+		fillStats(m_stats, true);
+	}
+
+	/**
+	 * @brief Avance l’index de la partie courante après les parties terminées.
+	 */
+	void advanceCurrentGameRound() {
+		while (m_currentRound < m_gameRounds.size() && m_gameRounds[m_currentRound].isFinished()) ++m_currentRound;
+	}
+
+	/**
+	 * @brief Recalcule l’index de la partie courante depuis le début.
+	 */
+	void rewindCurrentGameRound() {
+		m_currentRound = 0;
+		advanceCurrentGameRound();
+	}
+
+	/**
+	 * @brief Vérifie si les compteurs des cartons correspondent à la partie courante.
+	 * @param iCount Le nombre de tirages attendus dans les compteurs.
+	 * @return True si les compteurs sont à jour.
+	 */
+	[[nodiscard]] auto isCardTrackingInSync(GameRound::draws_type::size_type iCount) const -> bool;
+
+	/**
+	 * @brief Remplace les cartons par ceux du fichier de cartons.
+	 */
+	void loadCardPack();
+
+	/**
+	 * @brief Reconstruit les données dérivées après une lecture.
+	 * @param iCards Le traitement des cartons.
+	 * @param iPreviousPack Le fichier de cartons avant la lecture.
+	 */
+	void afterRead(CardLoading iCards = CardLoading::Load, const std::filesystem::path& iPreviousPack = {});
+
+	/**
+	 * @brief Import des parties d’un document JSON ou YAML, sans leur état.
+	 * @param ioReader Le lecteur du document.
+	 * @param iFile Le fichier lu, pour les messages.
+	 * @return Faux si le document est invalide.
+	 */
+	auto importText(TextReader& ioReader, const std::filesystem::path& iFile) -> bool;
+
+	/**
+	 * @brief Remet les compteurs des cartons en phase avec les tirages de la partie courante.
+	 */
+	void syncCards();
+
+	/**
+	 * @brief Définit les gagnants d’une partie inverse à partir des cartons survivants.
+	 */
+	void updateSurvivorWinners();
+
 	/**
 	 * @brief Si l’événement est en phase d’édition, met à jour son statuT.
 	 */
@@ -0,0 +1,271 @@
+/**
+ * @file EventFile.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "EventFile.h"
+
+#include "BinaryIO.h"
+#include "Event.h"
+#include "Log.h"
+#include "utilities.h"
+
+namespace evl::core {
+
+using namespace binary;
+using namespace eventFile;
+
+namespace {
+auto getDouble(const std::span<const uint8_t> iData, const size_t iOffset) -> double {
+	return std::bit_cast<double>(getLittleEndian<uint64_t>(iData, iOffset));
+}
+}// namespace
+
+// ---- Legacy strings ----
+auto eventFile::readLegacyString(std::istream& iBs, std::string& oString) -> bool {
+	std::string::size_type length = 0;
+	iBs.read(reinterpret_cast<char*>(&length), sizeof(length));
+	if (!iBs || length > g_maxStringLength) {
+		oString.clear();
+		iBs.setstate(std::ios::failbit);
+		return false;
+	}
+	oString.resize(length);
+	iBs.read(oString.data(), static_cast<std::streamsize>(length));
+	return static_cast<bool>(iBs);
+}
+
+void eventFile::writeLegacyString(std::ostream& oBs, const std::string_view iString) {
+	const std::string::size_type length = iString.size();
+	oBs.write(reinterpret_cast<const char*>(&length), sizeof(length));
+	oBs.write(iString.data(), static_cast<std::streamsize>(length));
+}
+
+// ---- Writer ----
+void EventFileWriter::putDouble(const Chunk iChunk, const double iValue) {
+	put(iChunk, std::bit_cast<uint64_t>(iValue));
+}
+
+void EventFileWriter::putTime(const Chunk iChunk, const time_point& iTime) {
+	put(iChunk, static_cast<int64_t>(
+						std::chrono::duration_cast<std::chrono::nanoseconds>(iTime.time_since_epoch()).count()));
+}
+
+void EventFileWriter::putString(const Chunk iChunk, const std::string_view iString) {
+	auto& pool = m_chunks[static_cast<size_t>(Chunk::Strings)];
+	auto [entry, inserted] = m_pool.try_emplace(std::string(iString), static_cast<uint32_t>(pool.size()));
+	if (inserted)
+		pool.insert(pool.end(), iString.begin(), iString.end());
+	put(iChunk, entry->second);
+	put(iChunk, static_cast<uint32_t>(iString.size()));
+}
+
+void EventFileWriter::putBytes(const Chunk iChunk, const std::span<const uint8_t> iBytes) {
+	auto& buffer = m_chunks[static_cast<size_t>(iChunk)];
+	buffer.insert(buffer.end(), iBytes.begin(), iBytes.end());
+}
+
+void EventFileWriter::write(std::ostream& oBs) const {
+	std::vector<char> header;
+	header.reserve(g_headerSize + g_chunkCount * g_tocEntrySize);
+	const auto putHeader = [&header]<typename T>(const T iValue) {
+		for (size_t i = 0; i < sizeof(T); ++i)
+			header.push_back(static_cast<char>(static_cast<uint64_t>(iValue) >> (8 * i) & 0xFFU));
+	};
+	uint64_t offset = g_headerSize + g_chunkCount * g_tocEntrySize;
+	uint64_t total = offset;
+	for (const auto& chunk: m_chunks) total += chunk.size();
+	putHeader(getSaveVersion());
+	header.insert(header.end(), g_magic.begin(), g_magic.end());
+	putHeader(total);
+	putHeader(static_cast<uint32_t>(g_chunkCount));
+	putHeader(uint32_t{0});
+	for (size_t i = 0; i < g_chunkCount; ++i) {
+		header.insert(header.end(), g_tags[i].begin(), g_tags[i].end());
+		putHeader(uint32_t{0});
+		putHeader(offset);
+		putHeader(static_cast<uint64_t>(m_chunks[i].size()));
+		offset += m_chunks[i].size();
+	}
+	oBs.write(header.data(), static_cast<std::streamsize>(header.size()));
+	for (const auto& chunk: m_chunks) oBs.write(chunk.data(), static_cast<std::streamsize>(chunk.size()));
+}
+
+// ---- View ----
+auto EventFileView::SubRound::delay(const size_t iIndex) const -> uint32_t {
+	return getLittleEndian<uint32_t>(delays, iIndex * sizeof(uint32_t));
+}
+
+auto EventFileView::open(const std::filesystem::path& iPath) -> bool {
+	m_data = {};
+	if (!m_mapping.open(iPath))
+		return false;
+	return parse(m_mapping.data());
+}
+
+auto EventFileView::readStream(std::istream& iBs, const uint16_t iVersion, std::vector<uint8_t>& oData) -> bool {
+	oData.resize(g_headerSize);
+	oData[0] = static_cast<uint8_t>(iVersion & 0xFFU);
+	oData[1] = static_cast<uint8_t>(iVersion >> 8U);
+	iBs.read(reinterpret_cast<char*>(oData.data() + 2), g_headerSize - 2);
+	if (!iBs)
+		return false;
+	const auto total = getLittleEndian<uint64_t>(oData, 8);
+	if (total < g_headerSize || total > g_maxSize) {
+		iBs.setstate(std::ios::failbit);
+		return false;
+	}
+	oData.resize(total);
+	iBs.read(reinterpret_cast<char*>(oData.data() + g_headerSize), static_cast<std::streamsize>(total - g_headerSize));
+	return static_cast<bool>(iBs);
+}
+
+auto EventFileView::parse(const std::span<const uint8_t> iData) -> bool {
+	m_data = {};
+	m_chunks = {};
+	m_roundCount = 0;
+	m_subRoundCount = 0;
+	const auto fail = [this](const std::string_view iReason) {
+		m_data = {};
+		log_warn("Fichier d'événement invalide: {}", iReason);
+		return false;
+	};
+	// the older versions have no magic bytes: not an error, they are read by the streams
+	if (iData.size() < g_headerSize ||
+		std::string_view(reinterpret_cast<const char*>(iData.data()) + 2, g_magic.size()) != g_magic) {
+		log_debug("Pas un fichier d'événement par blocs");
+		return false;
+	}
+	m_version = getLittleEndian<uint16_t>(iData, 0);
+	if (m_version < g_firstVersion || m_version > getSaveVersion())
+		return fail("version");
+	if (getLittleEndian<uint64_t>(iData, 8) != iData.size() || iData.size() > g_maxSize)
+		return fail("taille");
+	const auto count = getLittleEndian<uint32_t>(iData, 16);
+	if (count > g_maxChunks || g_headerSize + count * g_tocEntrySize > iData.size())
+		return fail("table des matières");
+	std::array<bool, g_chunkCount> found{};
+	for (uint32_t i = 0; i < count; ++i) {
+		const size_t entry = g_headerSize + i * g_tocEntrySize;
+		const std::string_view tag(reinterpret_cast<const char*>(iData.data()) + entry, 4);
+		const auto offset = getLittleEndian<uint64_t>(iData, entry + 8);
+		const auto size = getLittleEndian<uint64_t>(iData, entry + 16);
+		if (offset < g_headerSize + count * g_tocEntrySize || offset > iData.size() || size > iData.size() - offset)
+			return fail("bloc hors du fichier");
+		if (const auto known = std::ranges::find(g_tags, tag); known != g_tags.end()) {
+			const auto index = static_cast<size_t>(std::distance(g_tags.begin(), known));
+			m_chunks[index] = {offset, size};
+			found[index] = true;
+		}
+	}
+	if (!std::ranges::all_of(found, [](const bool iFound) { return iFound; }))
+		return fail("bloc manquant");
+	const auto chunkSize = [this](const Chunk iChunk) { return m_chunks[static_cast<size_t>(iChunk)].second; };
+	if (chunkSize(Chunk::Event) != g_eventRecordSize || chunkSize(Chunk::Rounds) % g_roundRecordSize != 0 ||
+		chunkSize(Chunk::SubRounds) % g_subRoundRecordSize != 0 ||
+		chunkSize(Chunk::Delays) != chunkSize(Chunk::Draws) * sizeof(uint32_t))
+		return fail("taille de bloc");
+	m_data = iData;
+	// all the references and the enumerations are checked here, the accessors trust them
+	const auto inRange = [&iData](const size_t iOffset, const auto iLast) {
+		return iData[iOffset] <= static_cast<uint8_t>(iLast);
+	};
+	const size_t event = m_chunks[static_cast<size_t>(Chunk::Event)].first;
+	if (!inRange(event, Event::Status::Finished))
+		return fail("statut de l'événement");
+	for (size_t i = 0; i < g_eventStringCount; ++i) {
+		if (!checkString(event + 17 + i * g_stringRefSize))
+			return fail("texte de l'événement");
+	}
+	const auto subCount = chunkSize(Chunk::SubRounds) / g_subRoundRecordSize;
+	const size_t subs = m_chunks[static_cast<size_t>(Chunk::SubRounds)].first;
+	for (size_t i = 0; i < subCount; ++i) {
+		const size_t record = subs + i * g_subRoundRecordSize;
+		const auto first = getLittleEndian<uint32_t>(iData, record + 42);
+		const auto drawCount = getLittleEndian<uint32_t>(iData, record + 46);
+		if (!inRange(record, SubGameRound::Type::Inverse) || !inRange(record + 1, SubGameRound::Status::Done) ||
+			!checkString(record + 10) || !checkString(record + 18) ||
+			uint64_t{first} + drawCount > chunkSize(Chunk::Draws))
+			return fail("sous-partie");
+	}
+	const auto roundCount = chunkSize(Chunk::Rounds) / g_roundRecordSize;
+	if (roundCount > g_maxRounds)
+		return fail("nombre de parties");
+	const size_t rounds = m_chunks[static_cast<size_t>(Chunk::Rounds)].first;
+	for (size_t i = 0; i < roundCount; ++i) {
+		const size_t record = rounds + i * g_roundRecordSize;
+		const auto first = getLittleEndian<uint32_t>(iData, record + 22);
+		const auto count2 = getLittleEndian<uint32_t>(iData, record + 26);
+		if (!inRange(record + 4, GameRound::Type::Pause) || !inRange(record + 5, GameRound::Status::Done) ||
+			!checkString(record + 30) || count2 > g_maxSubRounds || uint64_t{first} + count2 > subCount)
+			return fail("partie");
+	}
+	m_roundCount = static_cast<uint32_t>(roundCount);
+	m_subRoundCount = static_cast<uint32_t>(subCount);
+	return true;
+}
+
+auto EventFileView::getStatus() const -> uint8_t { return m_data[m_chunks[static_cast<size_t>(Chunk::Event)].first]; }
+
+auto EventFileView::getStart() const -> time_point {
+	return getTime(m_data, m_chunks[static_cast<size_t>(Chunk::Event)].first + 1);
+}
+
+auto EventFileView::getEnd() const -> time_point {
+	return getTime(m_data, m_chunks[static_cast<size_t>(Chunk::Event)].first + 9);
+}
+
+auto EventFileView::getString(const EventString iString) const -> std::string_view {
+	return stringAt(m_chunks[static_cast<size_t>(Chunk::Event)].first + 17 +
+					static_cast<size_t>(iString) * g_stringRefSize);
+}
+
+auto EventFileView::round(const uint32_t iIndex) const -> Round {
+	const size_t record = m_chunks[static_cast<size_t>(Chunk::Rounds)].first + iIndex * g_roundRecordSize;
+	return {.id = getLittleEndian<int32_t>(m_data, record),
+			.type = m_data[record + 4],
+			.status = m_data[record + 5],
+			.start = getTime(m_data, record + 6),
+			.end = getTime(m_data, record + 14),
+			.firstSubRound = getLittleEndian<uint32_t>(m_data, record + 22),
+			.subRoundCount = getLittleEndian<uint32_t>(m_data, record + 26),
+			.diapoPath = stringAt(record + 30),
+			.diapoDelay = getDouble(m_data, record + 38)};
+}
+
+auto EventFileView::subRound(const uint32_t iIndex) const -> SubRound {
+	const size_t record = m_chunks[static_cast<size_t>(Chunk::SubRounds)].first + iIndex * g_subRoundRecordSize;
+	const auto first = getLittleEndian<uint32_t>(m_data, record + 42);
+	const auto count = getLittleEndian<uint32_t>(m_data, record + 46);
+	const auto draws = m_data.subspan(m_chunks[static_cast<size_t>(Chunk::Draws)].first + first, count);
+	const auto delays = m_data.subspan(m_chunks[static_cast<size_t>(Chunk::Delays)].first + first * sizeof(uint32_t),
+									   count * sizeof(uint32_t));
+	return {.type = m_data[record],
+			.status = m_data[record + 1],
+			.value = getDouble(m_data, record + 2),
+			.winner = stringAt(record + 10),
+			.prices = stringAt(record + 18),
+			.start = getTime(m_data, record + 26),
+			.end = getTime(m_data, record + 34),
+			.draws = draws,
+			.delays = delays};
+}
+
+auto EventFileView::stringAt(const size_t iOffset) const -> std::string_view {
+	const auto offset = getLittleEndian<uint32_t>(m_data, iOffset);
+	const auto size = getLittleEndian<uint32_t>(m_data, iOffset + 4);
+	return {reinterpret_cast<const char*>(m_data.data()) + m_chunks[static_cast<size_t>(Chunk::Strings)].first + offset,
+			size};
+}
+
+auto EventFileView::checkString(const size_t iOffset) const -> bool {
+	const auto offset = getLittleEndian<uint32_t>(m_data, iOffset);
+	const auto size = getLittleEndian<uint32_t>(m_data, iOffset + 4);
+	return uint64_t{offset} + size <= m_chunks[static_cast<size_t>(Chunk::Strings)].second;
+}
+
+}// namespace evl::core
@@ -0,0 +1,319 @@
+/**
+ * @file EventFile.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#pragma once
+
+#include "MappedFile.h"
+#include "timeFunctions.h"
+
+#include <array>
+#include <iosfwd>
+#include <span>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <vector>
+
+namespace evl::core {
+
+/**
+ * @brief Layout of the chunked event files (save version 9 and later).
+ *
+ * A file starts with the save version, the magic bytes, the total size and the number of chunks, followed by
+ * the table of contents (tag, offset and size of each chunk). All the integers are little-endian with a fixed
+ * width, the dates are nanoseconds since the epoch. The chunks are:
+ * - EVNT: the event record;
+ * - RNDS: the fixed-size records of the rounds, each referencing a range of sub-rounds;
+ * - SUBS: the fixed-size records of the sub-rounds, each referencing a range of draws;
+ * - DRAW: the draws, one byte each;
+ * - DLAY: the delays of the draws, 4 bytes each;
+ * - STRS: the pool of strings, referenced by offset and size.
+ *
+ * Unknown chunks are ignored by the readers.
+ */
+namespace eventFile {
+/// First save version using the chunked format.
+constexpr uint16_t g_firstVersion = 9;
+/// Magic bytes after the version.
+constexpr std::string_view g_magic = "EVLCHK";
+/// Size of the header (version, magic, total size, chunk count, reserved).
+constexpr size_t g_headerSize = 24;
+/// Size of an entry of the table of contents.
+constexpr size_t g_tocEntrySize = 24;
+/// Maximal number of chunks.
+constexpr uint32_t g_maxChunks = 64;
+/// Maximal size of a file.
+constexpr uint64_t g_maxSize = uint64_t{256} << 20U;
+/// Maximal length of a string in the legacy formats.
+constexpr size_t g_maxStringLength = size_t{1} << 20U;
+/// Maximal number of rounds of an event.
+constexpr size_t g_maxRounds = 1024;
+/// Maximal number of sub-rounds of a round.
+constexpr size_t g_maxSubRounds = 16;
+
+/// Chunks of the format.
+enum struct Chunk : uint8_t { Event, Rounds, SubRounds, Draws, Delays, Strings };
+/// Number of chunks.
+constexpr size_t g_chunkCount = 6;
+/// Tags of the chunks.
+constexpr std::array<std::string_view, g_chunkCount> g_tags = {"EVNT", "RNDS", "SUBS", "DRAW", "DLAY", "STRS"};
+
+/// Strings of the event record.
+enum struct EventString : uint8_t { OrganizerName, OrganizerLogo, Name, Logo, Location, Rules, CardPack };
+/// Number of strings in the event record.
+constexpr size_t g_eventStringCount = 7;
+
+/// Size of a string reference (offset and size).
+constexpr size_t g_stringRefSize = 8;
+/// Size of the event record: status, start, end and strings.
+constexpr size_t g_eventRecordSize = 1 + 16 + g_eventStringCount * g_stringRefSize;
+/// Size of a round record: id, type, status, start, end, first sub-round, sub-round count, diapo path and delay.
+constexpr size_t g_roundRecordSize = 4 + 1 + 1 + 16 + 8 + g_stringRefSize + 8;
+/// Size of a sub-round record: type, status, value, winner, prices, start, end, first draw, draw count.
+constexpr size_t g_subRoundRecordSize = 1 + 1 + 8 + 2 * g_stringRefSize + 16 + 8;
+
+/**
+ * @brief Read a length-prefixed string of the legacy formats, with a bounded length.
+ * @param iBs The stream.
+ * @param oString The string.
+ * @return False (and the stream in fail state) if the length is out of bounds or the stream too short.
+ */
+auto readLegacyString(std::istream& iBs, std::string& oString) -> bool;
+
+/**
+ * @brief Write a length-prefixed string of the legacy formats.
+ * @param oBs The stream.
+ * @param iString The string.
+ */
+void writeLegacyString(std::ostream& oBs, std::string_view iString);
+}// namespace eventFile
+
+/**
+ * @brief Class EventFileWriter: builder of a chunked event file.
+ *
+ * The records are appended to the chunks in memory, then the whole file is written with one write per chunk.
+ */
+class EventFileWriter {
+public:
+	/**
+	 * @brief Append a fixed-width little-endian integer to a chunk.
+	 * @tparam T The integer type.
+	 * @param iChunk The chunk.
+	 * @param iValue The value.
+	 */
+	template<typename T>
+	void put(const eventFile::Chunk iChunk, const T iValue) {
+		auto& buffer = m_chunks[static_cast<size_t>(iChunk)];
+		for (size_t i = 0; i < sizeof(T); ++i)
+			buffer.push_back(static_cast<char>(static_cast<uint64_t>(iValue) >> (8 * i) & 0xFFU));
+	}
+	/**
+	 * @brief Append a floating point value to a chunk.
+	 * @param iChunk The chunk.
+	 * @param iValue The value.
+	 */
+	void putDouble(eventFile::Chunk iChunk, double iValue);
+	/**
+	 * @brief Append a date to a chunk.
+	 * @param iChunk The chunk.
+	 * @param iTime The date.
+	 */
+	void putTime(eventFile::Chunk iChunk, const time_point& iTime);
+	/**
+	 * @brief Add a string to the pool and append its reference to a chunk.
+	 * @param iChunk The chunk.
+	 * @param iString The string.
+	 */
+	void putString(eventFile::Chunk iChunk, std::string_view iString);
+	/**
+	 * @brief Append raw bytes to a chunk.
+	 * @param iChunk The chunk.
+	 * @param iBytes The bytes.
+	 */
+	void putBytes(eventFile::Chunk iChunk, std::span<const uint8_t> iBytes);
+
+	/**
+	 * @brief Get the size of a chunk.
+	 * @param iChunk The chunk.
+	 * @return The size in bytes.
+	 */
+	[[nodiscard]] auto size(const eventFile::Chunk iChunk) const -> size_t {
+		return m_chunks[static_cast<size_t>(iChunk)].size();
+	}
+
+	/**
+	 * @brief Write the file.
+	 * @param oBs The stream.
+	 */
+	void write(std::ostream& oBs) const;
+
+private:
+	/// The chunks.
+	std::array<std::vector<char>, eventFile::g_chunkCount> m_chunks;
+	/// Offset of the strings already in the pool.
+	std::unordered_map<std::string, uint32_t> m_pool;
+};
+
+/**
+ * @brief Class EventFileView: validated read-only view over a chunked event file.
+ *
+ * All the references of the file are checked once by parse(): the accessors return views into the data
+ * (mapped or not) without copy or further check.
+ */
+class EventFileView {
+public:
+	/// Record of a round.
+	struct Round {
+		/// Identifier.
+		int32_t id = 0;
+		/// Type.
+		uint8_t type = 0;
+		/// Status.
+		uint8_t status = 0;
+		/// Start date.
+		time_point start;
+		/// End date.
+		time_point end;
+		/// Index of the first sub-round.
+		uint32_t firstSubRound = 0;
+		/// Number of sub-rounds.
+		uint32_t subRoundCount = 0;
+		/// Path of the slide show of a pause.
+		std::string_view diapoPath;
+		/// Delay of the slide show.
+		double diapoDelay = 0;
+	};
+	/// Record of a sub-round.
+	struct SubRound {
+		/// Type.
+		uint8_t type = 0;
+		/// Status.
+		uint8_t status = 0;
+		/// Value of the prices.
+		double value = 0;
+		/// The winner.
+		std::string_view winner;
+		/// The prices.
+		std::string_view prices;
+		/// Start date.
+		time_point start;
+		/// End date.
+		time_point end;
+		/// The draws.
+		std::span<const uint8_t> draws;
+		/// The delays of the draws (little-endian, 4 bytes each).
+		std::span<const uint8_t> delays;
+
+		/**
+		 * @brief Get the delay of a draw.
+		 * @param iIndex Index of the draw.
+		 * @return The delay in milliseconds.
+		 */
+		[[nodiscard]] auto delay(size_t iIndex) const -> uint32_t;
+	};
+
+	/**
+	 * @brief Map and parse a file.
+	 * @param iPath The file.
+	 * @return False if the file cannot be mapped or is not a valid chunked event file.
+	 */
+	auto open(const std::filesystem::path& iPath) -> bool;
+
+	/**
+	 * @brief Parse and validate the data of a file (kept alive by the caller).
+	 * @param iData The data.
+	 * @return False if the data is not a valid chunked event file.
+	 */
+	auto parse(std::span<const uint8_t> iData) -> bool;
+
+	/**
+	 * @brief Read a chunked file from a stream, after its version.
+	 * @param iBs The stream.
+	 * @param iVersion The version already read.
+	 * @param oData The data of the whole file.
+	 * @return False if the stream is too short or the size out of bounds.
+	 */
+	static auto readStream(std::istream& iBs, uint16_t iVersion, std::vector<uint8_t>& oData) -> bool;
+
+	/**
+	 * @brief Get the save version.
+	 * @return The version.
+	 */
+	[[nodiscard]] auto getVersion() const -> uint16_t { return m_version; }
+	/**
+	 * @brief Get the status of the event.
+	 * @return The status.
+	 */
+	[[nodiscard]] auto getStatus() const -> uint8_t;
+	/**
+	 * @brief Get the start date of the event.
+	 * @return The date.
+	 */
+	[[nodiscard]] auto getStart() const -> time_point;
+	/**
+	 * @brief Get the end date of the event.
+	 * @return The date.
+	 */
+	[[nodiscard]] auto getEnd() const -> time_point;
+	/**
+	 * @brief Get a string of the event.
+	 * @param iString The string.
+	 * @return The string.
+	 */
+	[[nodiscard]] auto getString(eventFile::EventString iString) const -> std::string_view;
+	/**
+	 * @brief Get the number of rounds.
+	 * @return The number of rounds.
+	 */
+	[[nodiscard]] auto roundCount() const -> uint32_t { return m_roundCount; }
+	/**
+	 * @brief Get a round.
+	 * @param iIndex Index of the round.
+	 * @return The round.
+	 */
+	[[nodiscard]] auto round(uint32_t iIndex) const -> Round;
+	/**
+	 * @brief Get the number of sub-rounds.
+	 * @return The number of sub-rounds.
+	 */
+	[[nodiscard]] auto subRoundCount() const -> uint32_t { return m_subRoundCount; }
+	/**
+	 * @brief Get a sub-round.
+	 * @param iIndex Index of the sub-round.
+	 * @return The sub-round.
+	 */
+	[[nodiscard]] auto subRound(uint32_t iIndex) const -> SubRound;
+
+private:
+	/**
+	 * @brief Get a string of the pool.
+	 * @param iOffset Offset of the reference in the data.
+	 * @return The string.
+	 */
+	[[nodiscard]] auto stringAt(size_t iOffset) const -> std::string_view;
+	/**
+	 * @brief Check a string reference.
+	 * @param iOffset Offset of the reference in the data.
+	 * @return True if the string is in the pool.
+	 */
+	[[nodiscard]] auto checkString(size_t iOffset) const -> bool;
+
+	/// The mapping, if the file has been opened.
+	MappedFile m_mapping;
+	/// The data.
+	std::span<const uint8_t> m_data;
+	/// Offset and size of the known chunks.
+	std::array<std::pair<size_t, size_t>, eventFile::g_chunkCount> m_chunks{};
+	/// The save version.
+	uint16_t m_version = 0;
+	/// Number of rounds.
+	uint32_t m_roundCount = 0;
+	/// Number of sub-rounds.
+	uint32_t m_subRoundCount = 0;
+};
+
+}// namespace evl::core
@@ -0,0 +1,79 @@
+/**
+ * @file EventSaver.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "EventSaver.h"
+
+#include "BinaryIO.h"
+#include "Log.h"
+
+namespace evl::core {
+
+EventSaver::EventSaver() : m_saver{[this](const std::stop_token& iStop) { run(iStop); }} {}
+
+EventSaver::~EventSaver() {
+	m_saver.request_stop();
+	m_saver.join();
+}
+
+auto EventSaver::writeAtomic(const Event& iEvent, const std::filesystem::path& iFile) -> bool {
+	std::ostringstream stream(std::ios::out | std::ios::binary);
+	iEvent.write(stream);
+	return binary::writeAtomic(iFile, stream.view());
+}
+
+void EventSaver::save(Event iSnapshot, std::filesystem::path iFile) {
+	{
+		const std::scoped_lock lock(m_mutex);
+		if (const auto request = std::ranges::find(m_queue, iFile, &Request::file); request != m_queue.end())
+			request->snapshot = std::move(iSnapshot);
+		else
+			m_queue.push_back({.snapshot = std::move(iSnapshot), .file = std::move(iFile)});
+		m_status = Status::Running;
+	}
+	m_wakeUp.notify_one();
+}
+
+void EventSaver::wait() {
+	std::unique_lock lock(m_mutex);
+	m_done.wait(lock, [this] { return m_status != Status::Running; });
+}
+
+auto EventSaver::getStatus() const -> Status {
+	const std::scoped_lock lock(m_mutex);
+	return m_status;
+}
+
+auto EventSaver::getFile() const -> std::filesystem::path {
+	const std::scoped_lock lock(m_mutex);
+	return m_file;
+}
+
+void EventSaver::run(const std::stop_token& iStop) {
+	std::unique_lock lock(m_mutex);
+	while (true) {
+		m_wakeUp.wait(lock, iStop, [this] { return !m_queue.empty(); });
+		if (m_queue.empty())
+			return;
+		Request request = std::move(m_queue.front());
+		m_queue.erase(m_queue.begin());
+		lock.unlock();
+		const bool success = writeAtomic(request.snapshot, request.file);
+		if (success)
+			log_info("Fichier '{}' sauvegardé.", request.file.string());
+		lock.lock();
+		m_file = std::move(request.file);
+		// a newer request keeps the state running
+		if (m_queue.empty()) {
+			m_status = success ? Status::Succeeded : Status::Failed;
+			m_done.notify_all();
+		}
+	}
+}
+
+}// namespace evl::core
@@ -0,0 +1,111 @@
+/**
+ * @file EventSaver.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#pragma once
+
+#include "Event.h"
+
+#include <condition_variable>
+#include <filesystem>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace evl::core {
+
+/**
+ * @brief Class EventSaver: save of events on a background thread with atomic replacement of the file.
+ *
+ * The saved event is a copy taken by the caller: the game goes on while the copy is written. The copy is
+ * written in a temporary file beside the target, synced, then renamed over the target: a crash during the
+ * save leaves the previous file untouched. Saves of the same file requested while another one runs are merged,
+ * only the most recent copy is written.
+ */
+class EventSaver {
+public:
+	/// State of the last save.
+	enum struct Status : uint8_t {
+		Idle,///< Nothing saved yet.
+		Running,///< A save is in progress.
+		Succeeded,///< The last save succeeded.
+		Failed,///< The last save failed.
+	};
+
+	EventSaver();
+	/**
+	 * @brief Destructor: the requested saves are finished first.
+	 */
+	~EventSaver();
+	EventSaver(const EventSaver&) = delete;
+	EventSaver(EventSaver&&) = delete;
+	auto operator=(const EventSaver&) -> EventSaver& = delete;
+	auto operator=(EventSaver&&) -> EventSaver& = delete;
+
+	/**
+	 * @brief Write an event in a file, replacing it atomically.
+	 * @param iEvent The event.
+	 * @param iFile The file.
+	 * @return False if the file cannot be written.
+	 */
+	static auto writeAtomic(const Event& iEvent, const std::filesystem::path& iFile) -> bool;
+
+	/**
+	 * @brief Request the save of an event.
+	 * @param iSnapshot Copy of the event to save.
+	 * @param iFile The file.
+	 */
+	void save(Event iSnapshot, std::filesystem::path iFile);
+
+	/**
+	 * @brief Wait until the requested saves are done.
+	 */
+	void wait();
+
+	/**
+	 * @brief Get the state of the last save.
+	 * @return The state.
+	 */
+	[[nodiscard]] auto getStatus() const -> Status;
+
+	/**
+	 * @brief Get the file of the last save.
+	 * @return The file.
+	 */
+	[[nodiscard]] auto getFile() const -> std::filesystem::path;
+
+private:
+	/// A requested save.
+	struct Request {
+		/// The event copy.
+		Event snapshot;
+		/// The file.
+		std::filesystem::path file;
+	};
+
+	/**
+	 * @brief Saver thread loop.
+	 * @param iStop The stop token.
+	 */
+	void run(const std::stop_token& iStop);
+
+	/// Protection of the request and the state.
+	mutable std::mutex m_mutex;
+	/// Wakes up the saver.
+	std::condition_variable_any m_wakeUp;
+	/// Wakes up wait() when the saves are done.
+	std::condition_variable m_done;
+	/// The waiting saves, at most one per file.
+	std::vector<Request> m_queue;
+	/// State of the last save.
+	Status m_status = Status::Idle;
+	/// File of the last save.
+	std::filesystem::path m_file;
+	/// The saver (last member: joined first).
+	std::jthread m_saver;
+};
+
+}// namespace evl::core
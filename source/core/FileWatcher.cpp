@@ -0,0 +1,128 @@
+/**
+ * @file FileWatcher.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "FileWatcher.h"
+
+#include "Log.h"
+
+#ifdef EVL_PLATFORM_LINUX
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+namespace evl::core {
+
+namespace {
+auto normalize(const std::filesystem::path& iPath) -> std::filesystem::path {
+	auto path = std::filesystem::absolute(iPath).lexically_normal();
+	if (!path.has_filename())
+		path = path.parent_path();
+	return path;
+}
+}// namespace
+
+FileWatcher::FileWatcher(std::vector<std::filesystem::path> iPaths, const std::chrono::milliseconds iDelay)
+	: m_paths{std::move(iPaths)}, m_delay{iDelay} {
+	for (auto& path: m_paths) path = normalize(path);
+	m_watcher = std::jthread{[this](const std::stop_token& iStop) { run(iStop); }};
+}
+
+FileWatcher::~FileWatcher() {
+	m_watcher.request_stop();
+	m_watcher.join();
+}
+
+auto FileWatcher::takeChanges() -> std::vector<std::filesystem::path> {
+	const std::scoped_lock lock(m_mutex);
+	std::vector<std::filesystem::path> changes{m_changes.begin(), m_changes.end()};
+	m_changes.clear();
+	return changes;
+}
+
+void FileWatcher::notify(const std::filesystem::path& iFile) {
+	// a file is watched by itself or by its folder
+	if (!std::ranges::any_of(m_paths, [&iFile](const auto& iPath) {
+			return iPath == iFile || iPath == iFile.parent_path();
+		}))
+		return;
+	const std::scoped_lock lock(m_mutex);
+	m_changes.insert(iFile);
+}
+
+#ifdef EVL_PLATFORM_LINUX
+void FileWatcher::run(const std::stop_token& iStop) {
+	const int notifier = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if (notifier < 0) {
+		log_warn("Impossible de surveiller les fichiers: {}", std::strerror(errno));
+		return;
+	}
+	// the folders are watched: the files written beside then renamed are seen
+	std::map<int, std::filesystem::path> folders;
+	for (const auto& path: m_paths) {
+		const auto folder = std::filesystem::is_directory(path) ? path : path.parent_path();
+		if (const int watch = inotify_add_watch(notifier, folder.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO); watch >= 0)
+			folders.emplace(watch, folder);
+		else
+			log_debug("Dossier '{}' non surveillé: {}", folder.string(), std::strerror(errno));
+	}
+	alignas(inotify_event) std::array<char, 4096> buffer{};
+	pollfd request{.fd = notifier, .events = POLLIN, .revents = 0};
+	while (!iStop.stop_requested()) {
+		if (poll(&request, 1, static_cast<int>(m_delay.count())) <= 0)
+			continue;
+		ssize_t length = 0;
+		while ((length = read(notifier, buffer.data(), buffer.size())) > 0) {
+			for (ssize_t offset = 0; offset < length;) {
+				const auto* event = reinterpret_cast<const inotify_event*>(buffer.data() + offset);
+				if (const auto folder = folders.find(event->wd); event->len > 0 && folder != folders.end())
+					notify(folder->second / event->name);
+				offset += static_cast<ssize_t>(sizeof(inotify_event) + event->len);
+			}
+		}
+	}
+	close(notifier);
+}
+#else
+void FileWatcher::run(const std::stop_token& iStop) {
+	std::map<std::filesystem::path, std::filesystem::file_time_type> times;
+	const auto scan = [this, &times](const bool iNotify) {
+		const auto check = [&](const std::filesystem::path& iFile) {
+			std::error_code error;
+			const auto time = std::filesystem::last_write_time(iFile, error);
+			if (error)
+				return;
+			if (const auto [known, inserted] = times.try_emplace(iFile, time); !inserted && known->second != time) {
+				known->second = time;
+				if (iNotify)
+					notify(iFile);
+			} else if (inserted && iNotify) {
+				notify(iFile);
+			}
+		};
+		for (const auto& path: m_paths) {
+			std::error_code error;
+			if (std::filesystem::is_directory(path, error)) {
+				for (const auto& entry: std::filesystem::directory_iterator(path, error))
+					if (entry.is_regular_file(error))
+						check(entry.path());
+			} else {
+				check(path);
+			}
+		}
+	};
+	scan(false);
+	while (!iStop.stop_requested()) {
+		std::this_thread::sleep_for(m_delay);
+		scan(true);
+	}
+}
+#endif
+
+}// namespace evl::core
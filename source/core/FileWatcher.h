@@ -0,0 +1,77 @@
+/**
+ * @file FileWatcher.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#pragma once
+
+#include <chrono>
+#include <filesystem>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+namespace evl::core {
+
+/**
+ * @brief Class FileWatcher: detection of the changes of files on a background thread.
+ *
+ * Each watched path is a file or a folder (its files, not recursive). On Linux the changes are notified by inotify
+ * on the parent folders, so a file replaced by a rename is still seen; elsewhere the write times are polled.
+ */
+class FileWatcher {
+public:
+	/// Default delay between two checks.
+	static constexpr std::chrono::milliseconds g_defaultDelay{200};
+
+	/**
+	 * @brief Constructor, start the watch.
+	 * @param iPaths The watched files and folders.
+	 * @param iDelay Delay between two checks (also the stop latency).
+	 */
+	explicit FileWatcher(std::vector<std::filesystem::path> iPaths,
+						 std::chrono::milliseconds iDelay = g_defaultDelay);
+	/**
+	 * @brief Destructor, stop the watch.
+	 */
+	~FileWatcher();
+	FileWatcher(const FileWatcher&) = delete;
+	FileWatcher(FileWatcher&&) = delete;
+	auto operator=(const FileWatcher&) -> FileWatcher& = delete;
+	auto operator=(FileWatcher&&) -> FileWatcher& = delete;
+
+	/**
+	 * @brief Get the files changed since the last call, and forget them.
+	 * @return The changed files, sorted.
+	 */
+	auto takeChanges() -> std::vector<std::filesystem::path>;
+
+private:
+	/**
+	 * @brief Watcher thread loop.
+	 * @param iStop The stop token.
+	 */
+	void run(const std::stop_token& iStop);
+
+	/**
+	 * @brief Record a change if the file is watched.
+	 * @param iFile The changed file.
+	 */
+	void notify(const std::filesystem::path& iFile);
+
+	/// The watched files and folders.
+	std::vector<std::filesystem::path> m_paths;
+	/// Delay between two checks.
+	std::chrono::milliseconds m_delay;
+	/// Protection of the changes.
+	std::mutex m_mutex;
+	/// The changed files.
+	std::set<std::filesystem::path> m_changes;
+	/// The watcher (last member: joined first).
+	std::jthread m_watcher;
+};
+
+}// namespace evl::core
@@ -0,0 +1,134 @@
+/**
+ * @file Forecast.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "Forecast.h"
+
+namespace evl::core {
+
+namespace {
+/// Weight of the last interval in the draw pace.
+constexpr double g_paceWeight = 0.2;
+/// Intervals longer than this factor times the pace are interruptions, not draws.
+constexpr double g_paceOutlier = 10.0;
+/// Overhead of a sub-round before any history.
+constexpr duration g_defaultOverhead{120.0};
+
+auto index(const SubGameRound::Type iKind) -> size_t { return static_cast<size_t>(iKind); }
+}// namespace
+
+Forecast::Forecast() {
+	m_kinds[index(SubGameRound::Type::OneQuine)].prior = 12.0;
+	m_kinds[index(SubGameRound::Type::TwoQuines)].prior = 8.0;
+	m_kinds[index(SubGameRound::Type::FullCard)].prior = 30.0;
+	m_kinds[index(SubGameRound::Type::Inverse)].prior = 30.0;
+}
+
+void Forecast::reset(const std::vector<GameRound>& iRounds) {
+	for (auto& kind: m_kinds) {
+		kind.samples = 0;
+		kind.draws = 0;
+	}
+	m_remaining.fill(0);
+	m_remainingPauses = 0;
+	m_pauses = 0;
+	m_currentKind = SubGameRound::Type::Invalid;
+	m_currentDraws = 0;
+	m_history = {};
+	for (const auto& round: iRounds) {
+		if (round.getType() == GameRound::Type::Pause) {
+			if (round.getStatus() == GameRound::Status::PostScreen || round.isFinished())
+				closePause(round.getEnding() - round.getStarting());
+			else
+				++m_remainingPauses;
+			continue;
+		}
+		for (auto sub = round.beginSubRound(); sub != round.endSubRound(); ++sub) {
+			const auto kind = kindOf(round, *sub);
+			if (sub->isFinished()) {
+				++m_kinds[index(kind)].samples;
+				m_kinds[index(kind)].draws += static_cast<uint32_t>(sub->getDraws().size());
+				continue;
+			}
+			++m_remaining[index(kind)];
+			if (sub->getStatus() != SubGameRound::Status::Ready) {
+				m_currentKind = kind;
+				m_currentDraws = static_cast<uint32_t>(sub->getDraws().size());
+			}
+		}
+		if (round.isFinished())
+			m_history.pushRound(round);
+	}
+}
+
+void Forecast::pushDraw(const SubGameRound::Type iKind, const time_point& iTime) {
+	if (m_currentKind == iKind && m_currentDraws > 0) {
+		const duration interval = iTime - m_lastDraw;
+		if (interval > duration::zero() && interval < m_pace * g_paceOutlier)
+			m_pace = m_pace * (1.0 - g_paceWeight) + interval * g_paceWeight;
+	}
+	if (m_currentKind != iKind)
+		m_currentDraws = 0;
+	m_currentKind = iKind;
+	++m_currentDraws;
+	m_lastDraw = iTime;
+}
+
+void Forecast::popDraw() {
+	if (m_currentDraws > 0)
+		--m_currentDraws;
+}
+
+void Forecast::closeSubRound(const SubGameRound::Type iKind, const size_t iDraws) {
+	auto& kind = m_kinds[index(iKind)];
+	++kind.samples;
+	kind.draws += static_cast<uint32_t>(iDraws);
+	if (m_remaining[index(iKind)] > 0)
+		--m_remaining[index(iKind)];
+	m_currentKind = SubGameRound::Type::Invalid;
+	m_currentDraws = 0;
+}
+
+void Forecast::closePause(const duration& iDuration) {
+	m_pauseDuration = (m_pauseDuration * m_pauses + iDuration) / (m_pauses + 1);
+	++m_pauses;
+	if (m_remainingPauses > 0)
+		--m_remainingPauses;
+}
+
+void Forecast::setExpectedDraws(const SubGameRound::Type iKind, const double iDraws) {
+	m_kinds[index(iKind)].prior = iDraws;
+}
+
+auto Forecast::getExpectedDraws(const SubGameRound::Type iKind) const -> double {
+	// the prior counts as one sample
+	const auto& kind = m_kinds[index(iKind)];
+	return (kind.prior + static_cast<double>(kind.draws)) / static_cast<double>(kind.samples + 1);
+}
+
+auto Forecast::getOverhead() const -> duration {
+	if (m_history.subRoundAverage == duration::zero())
+		return g_defaultOverhead;
+	return std::max(duration::zero(), m_history.subRoundAverage - m_pace * m_history.subRoundAverageNb);
+}
+
+auto Forecast::getRemaining() const -> duration {
+	const duration overhead = getOverhead();
+	duration remaining = m_pauseDuration * m_remainingPauses;
+	for (size_t kind = 0; kind < g_kinds; ++kind) {
+		if (m_remaining[kind] == 0)
+			continue;
+		const double expected = getExpectedDraws(static_cast<SubGameRound::Type>(kind));
+		remaining += (m_pace * expected + overhead) * m_remaining[kind];
+	}
+	if (m_currentKind != SubGameRound::Type::Invalid && m_remaining[index(m_currentKind)] > 0)
+		remaining -= m_pace * std::min(static_cast<double>(m_currentDraws), getExpectedDraws(m_currentKind));
+	return remaining;
+}
+
+}// namespace evl::core
@@ -0,0 +1,163 @@
+/**
+ * @file Forecast.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#pragma once
+
+#include "GameRound.h"
+#include "Statistics.h"
+#include "timeFunctions.h"
+
+#include <array>
+
+namespace evl::core {
+
+/**
+ * @brief Class Forecast: live estimation of the remaining duration of an event.
+ *
+ * The remaining time is the sum, over the sub-rounds still to play, of the expected number of draws times
+ * the draw pace plus a fixed overhead per sub-round, plus the expected duration of the remaining pauses.
+ * The pace is a moving average of the time between two draws; the overhead comes from the history of the
+ * finished sub-rounds (Statistics). Every update is O(1); only reset() walks the rounds.
+ */
+class Forecast {
+public:
+	/// Number of sub-round kinds (indexed by SubGameRound::Type).
+	static constexpr size_t g_kinds = static_cast<size_t>(SubGameRound::Type::Inverse) + 1;
+
+	/**
+	 * @brief Constructor: default expected draws per kind of sub-round.
+	 */
+	Forecast();
+
+	/**
+	 * @brief Get the kind of sub-round used for the forecast (the sub-round of an inverse round is Inverse).
+	 * @param iRound The round.
+	 * @param iSub The sub-round.
+	 * @return The kind.
+	 */
+	[[nodiscard]] static auto kindOf(const GameRound& iRound, const SubGameRound& iSub) -> SubGameRound::Type {
+		return iRound.getType() == GameRound::Type::Inverse ? SubGameRound::Type::Inverse : iSub.getType();
+	}
+
+	/**
+	 * @brief Rebuild the counters and the history from the rounds.
+	 * @param iRounds The rounds of the event.
+	 */
+	void reset(const std::vector<GameRound>& iRounds);
+
+	/**
+	 * @brief Register a draw of the current sub-round.
+	 * @param iKind The kind of the current sub-round.
+	 * @param iTime The time of the draw.
+	 */
+	void pushDraw(SubGameRound::Type iKind, const time_point& iTime);
+
+	/**
+	 * @brief Cancel the last draw of the current sub-round.
+	 */
+	void popDraw();
+
+	/**
+	 * @brief Register the end of a sub-round.
+	 * @param iKind The kind of the sub-round.
+	 * @param iDraws The number of draws of the sub-round.
+	 */
+	void closeSubRound(SubGameRound::Type iKind, size_t iDraws);
+
+	/**
+	 * @brief Register the end of a pause.
+	 * @param iDuration The duration of the pause.
+	 */
+	void closePause(const duration& iDuration);
+
+	/**
+	 * @brief Register the end of a round in the history.
+	 * @param iRound The finished round.
+	 */
+	void closeRound(const GameRound& iRound) { m_history.pushRound(iRound); }
+
+	/**
+	 * @brief Force the expected number of draws of a kind of sub-round (for example from a simulation).
+	 * @param iKind The kind of sub-round.
+	 * @param iDraws The expected number of draws.
+	 */
+	void setExpectedDraws(SubGameRound::Type iKind, double iDraws);
+
+	/**
+	 * @brief Get the expected number of draws of a kind of sub-round.
+	 * @param iKind The kind of sub-round.
+	 * @return The expected number of draws.
+	 */
+	[[nodiscard]] auto getExpectedDraws(SubGameRound::Type iKind) const -> double;
+
+	/**
+	 * @brief Get the current time between two draws.
+	 * @return The draw pace.
+	 */
+	[[nodiscard]] auto getPace() const -> const duration& { return m_pace; }
+
+	/**
+	 * @brief Get the time spent in a sub-round outside the draws.
+	 * @return The overhead.
+	 */
+	[[nodiscard]] auto getOverhead() const -> duration;
+
+	/**
+	 * @brief Get the number of sub-rounds still to finish.
+	 * @param iKind The kind of sub-round.
+	 * @return The number of sub-rounds.
+	 */
+	[[nodiscard]] auto getRemainingCount(const SubGameRound::Type iKind) const -> uint32_t {
+		return m_remaining[static_cast<size_t>(iKind)];
+	}
+
+	/**
+	 * @brief Get the estimated remaining duration.
+	 * @return The remaining duration.
+	 */
+	[[nodiscard]] auto getRemaining() const -> duration;
+
+	/**
+	 * @brief Get the history of the finished rounds.
+	 * @return The statistics.
+	 */
+	[[nodiscard]] auto getHistory() const -> const Statistics& { return m_history; }
+
+private:
+	/// Counters of a kind of sub-round.
+	struct KindStats {
+		/// Number of finished sub-rounds.
+		uint32_t samples = 0;
+		/// Total number of draws of the finished sub-rounds.
+		uint32_t draws = 0;
+		/// Expected number of draws before any sample.
+		double prior = 0.0;
+	};
+
+	/// Counters per kind of sub-round.
+	std::array<KindStats, g_kinds> m_kinds{};
+	/// Sub-rounds not yet finished per kind (including the current one).
+	std::array<uint32_t, g_kinds> m_remaining{};
+	/// Pauses not yet finished.
+	uint32_t m_remainingPauses = 0;
+	/// Number of finished pauses.
+	uint32_t m_pauses = 0;
+	/// Mean duration of a pause.
+	duration m_pauseDuration{900.0};
+	/// Time between two draws (moving average).
+	duration m_pace{15.0};
+	/// Kind of the current sub-round.
+	SubGameRound::Type m_currentKind = SubGameRound::Type::Invalid;
+	/// Number of draws in the current sub-round.
+	uint32_t m_currentDraws = 0;
+	/// Time of the last draw.
+	time_point m_lastDraw;
+	/// History of the finished rounds.
+	Statistics m_history;
+};
+
+}// namespace evl::core
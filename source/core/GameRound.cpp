@@ -9,8 +9,11 @@
 
 #include "GameRound.h"
 
+#include "EventFile.h"
 #include "Log.h"
+#include "Migration.h"
 #include "StringUtils.h"
+#include "TextStream.h"
 #include "utilities.h"
 
 namespace evl::core {
@@ -84,6 +87,8 @@ void GameRound::setType(const Type& iType) {
 			log_warn("GameRound set to invalid type!");
 			break;
 	}
+	rewindCurrentSubRound();
+	m_drawLog.clear();
 }
 
 // ---- manipulation du statut ----
@@ -96,20 +101,22 @@ auto GameRound::getStatusStr() const -> std::string {
 
 // ---- flux du jeu ----
 
-void GameRound::nextStatus() {
+void GameRound::nextStatus(const time_point& iTime) {
 	const auto sub = getCurrentSubRound();
 	switch (m_status) {
 		case Status::Ready:
-			m_start = clock::now();
+			m_start = iTime;
 			m_status = Status::Running;
-			sub->nextStatus();
+			sub->nextStatus(iTime);
+			advanceCurrentSubRound();
 			break;
 		case Status::Running:
 			if (sub == m_subGames.end()) {
-				m_end = clock::now();
+				m_end = iTime;
 				m_status = Status::PostScreen;
 			} else {
-				sub->nextStatus();
+				sub->nextStatus(iTime);
+				advanceCurrentSubRound();
 			}
 			break;
 		case Status::PostScreen:
@@ -135,75 +142,91 @@ auto GameRound::getStateString() const -> std::string {
 	return result;
 }
 
-void GameRound::addPickedNumber(const uint8_t& iNumber) {
-	if (m_status == Status::Running)
-		getCurrentSubRound()->addPickedNumber(iNumber);
+void GameRound::addPickedNumber(const uint8_t& iNumber, const time_point& iTime) {
+	if (m_status != Status::Running || m_currentSub >= m_subGames.size())
+		return;
+	if (!NumberMask::isValid(iNumber) || m_drawLog.size() == DrawLog::g_capacity) {
+		log_warn("Tirage du numéro {} refusé", iNumber);
+		return;
+	}
+	auto& sub = m_subGames[m_currentSub];
+	const auto count = sub.getDraws().size();
+	sub.addPickedNumber(iNumber, iTime);
+	if (sub.getDraws().size() != count)
+		m_drawLog.push(iNumber, static_cast<uint8_t>(m_currentSub));
 }
 
 void GameRound::removeLastPick() {
-	if (m_status == Status::Running)
-		getCurrentSubRound()->removeLastPick();
+	if (m_status != Status::Running || m_currentSub >= m_subGames.size())
+		return;
+	auto& sub = m_subGames[m_currentSub];
+	const auto count = sub.getDraws().size();
+	sub.removeLastPick();
+	if (sub.getDraws().size() != count)
+		m_drawLog.pop();
 }
 
-void GameRound::addWinner(const std::string& iWinner) {
+void GameRound::addWinner(const std::string& iWinner, const time_point& iTime) {
 	if (m_status != Status::Running)
 		return;
 	const auto sub = getCurrentSubRound();
-	sub->setWinner(iWinner);
-	if (sub->isFinished())
-		nextStatus();
+	sub->setWinner(iWinner, iTime);
+	if (sub->isFinished()) {
+		advanceCurrentSubRound();
+		nextStatus(iTime);
+	}
 }
 
 // ---- Serialisation ----
 void GameRound::read(std::istream& iBs, const int iFileVersion) {
-	if (std::cmp_greater(iFileVersion, getSaveVersion()))
+	if (std::cmp_greater(iFileVersion, getSaveVersion())) {
+		iBs.setstate(std::ios::failbit);
 		return;
-	if (iFileVersion < 3)//----UNCOVER----
-		m_id = 0;//----UNCOVER----
-	else//----UNCOVER----
+	}
+	const auto version = static_cast<uint16_t>(iFileVersion);
+	LegacyRound legacy;
+	if (hasFormatChange(version, FormatChange::RoundIds))
 		iBs.read(reinterpret_cast<char*>(&m_id), sizeof(m_id));
 	iBs.read(reinterpret_cast<char*>(&m_type), sizeof(m_type));
 	iBs.read(reinterpret_cast<char*>(&m_status), sizeof(m_status));
+	if (m_type > Type::Pause || m_status > Status::Done) {
+		m_type = Type::Invalid;
+		m_status = Status::Invalid;
+		iBs.setstate(std::ios::failbit);
+	}
 	iBs.read(reinterpret_cast<char*>(&m_start), sizeof(m_start));
 	iBs.read(reinterpret_cast<char*>(&m_end), sizeof(m_end));
-	draws_type::size_type l = 0;
-	draws_type draws;
-	if (iFileVersion < 4) {//----UNCOVER----
-		iBs.read(reinterpret_cast<char*>(&l), sizeof(draws_type::size_type));//----UNCOVER----
-		draws.resize(l);//----UNCOVER----
-		for (draws_type::size_type i = 0; i < l; ++i)//----UNCOVER----
-			iBs.read(reinterpret_cast<char*>(&draws[i]), sizeof(draws_type::value_type));//----UNCOVER----
-	}//----UNCOVER----
+	if (!hasFormatChange(version, FormatChange::SubRoundResults)) {
+		draws_type::size_type l = 0;
+		iBs.read(reinterpret_cast<char*>(&l), sizeof(draws_type::size_type));
+		if (!iBs || l > NumberMask::g_maxNumber) {
+			iBs.setstate(std::ios::failbit);
+			return;
+		}
+		legacy.draws.resize(l);
+		iBs.read(reinterpret_cast<char*>(legacy.draws.data()), static_cast<std::streamsize>(l));
+	}
 	sub_rounds_type::size_type l2 = 0;
 	iBs.read(reinterpret_cast<char*>(&l2), sizeof(sub_rounds_type::size_type));
+	if (!iBs || l2 > eventFile::g_maxSubRounds) {
+		iBs.setstate(std::ios::failbit);
+		return;
+	}
 	m_subGames.resize(l2);
 	for (sub_rounds_type::size_type i = 0; i < l2; ++i) m_subGames[i].read(iBs, iFileVersion);
-	if (iFileVersion < 4) {//----UNCOVER----
-		// faking sub game picking
-		const auto part = static_cast<uint32_t>(l / l2);//----UNCOVER----
-		for (draws_type::size_type i = 0; i < l; ++i) {//----UNCOVER----
-			if (part == 0)
-				break;//----UNCOVER----
-			m_subGames[i % part].addPickedNumber(draws[i]);//----UNCOVER----
-		}//----UNCOVER----
-	}//----UNCOVER----
 	m_diapoPath = std::filesystem::path{};
 	m_diapoDelay = 0;
-	if (m_type == Type::Pause && iFileVersion > 4) {
-		std::string::size_type len = 0;
-		iBs.read(reinterpret_cast<char*>(&len), sizeof(std::string::size_type));
-		if (len == 0) {
-			m_diapoPath.clear();
-			m_diapoDelay = 0.0;
-		} else {
-			std::string tmp;
-			tmp.resize(len);
-			for (std::string::size_type i = 0; i < len; i++)
-				iBs.read(reinterpret_cast<char*>(&tmp[i]), sizeof(std::string::value_type));
+	if (m_type == Type::Pause && hasFormatChange(version, FormatChange::PauseDiaporama)) {
+		std::string tmp;
+		eventFile::readLegacyString(iBs, tmp);
+		if (!tmp.empty()) {
 			m_diapoPath = tmp;
 			iBs.read(reinterpret_cast<char*>(&m_diapoDelay), sizeof(double));
 		}
 	}
+	upgradeRound(*this, legacy, version);
+	rewindCurrentSubRound();
+	rebuildDrawLog();
 }
 
 void GameRound::write(std::ostream& iBs) const {
@@ -216,14 +239,103 @@ void GameRound::write(std::ostream& iBs) const {
 	iBs.write(reinterpret_cast<const char*>(&l2), sizeof(sub_rounds_type::size_type));
 	for (sub_rounds_type::size_type i = 0; i < l2; ++i) m_subGames[i].write(iBs);
 	if (m_type == Type::Pause) {
-		const std::string::size_type l3 = m_diapoPath.string().size();
-		iBs.write(reinterpret_cast<const char*>(&l3), sizeof(l3));
-		if (l3 > 0) {
-			for (std::string::size_type i = 0; i < l3; ++i)
-				iBs.write(&m_diapoPath.string()[i], sizeof(std::string::value_type));
+		const auto diapo = m_diapoPath.string();
+		eventFile::writeLegacyString(iBs, diapo);
+		if (!diapo.empty())
 			iBs.write(reinterpret_cast<const char*>(&m_diapoDelay), sizeof(double));
+	}
+}
+
+void GameRound::readChunk(const EventFileView& iView, const uint32_t iIndex) {
+	const auto round = iView.round(iIndex);
+	m_id = round.id;
+	m_type = static_cast<Type>(round.type);
+	m_status = static_cast<Status>(round.status);
+	m_start = round.start;
+	m_end = round.end;
+	m_subGames.resize(round.subRoundCount);
+	for (uint32_t i = 0; i < round.subRoundCount; ++i) m_subGames[i].readChunk(iView, round.firstSubRound + i);
+	m_diapoPath = round.diapoPath;
+	m_diapoDelay = round.diapoDelay;
+	rewindCurrentSubRound();
+	rebuildDrawLog();
+}
+
+void GameRound::writeChunk(EventFileWriter& ioWriter) const {
+	constexpr auto record = eventFile::Chunk::Rounds;
+	ioWriter.put(record, static_cast<int32_t>(m_id));
+	ioWriter.put(record, static_cast<uint8_t>(m_type));
+	ioWriter.put(record, static_cast<uint8_t>(m_status));
+	ioWriter.putTime(record, m_start);
+	ioWriter.putTime(record, m_end);
+	ioWriter.put(record,
+				 static_cast<uint32_t>(ioWriter.size(eventFile::Chunk::SubRounds) / eventFile::g_subRoundRecordSize));
+	ioWriter.put(record, static_cast<uint32_t>(m_subGames.size()));
+	ioWriter.putString(record, m_diapoPath.string());
+	ioWriter.putDouble(record, m_diapoDelay);
+	for (const auto& sub: m_subGames) sub.writeChunk(ioWriter);
+}
+
+auto GameRound::readText(TextReader& ioReader) -> bool {
+	if (!ioReader.enterMap())
+		return false;
+	std::string key;
+	std::string text;
+	while (ioReader.nextKey(key)) {
+		if (key == "type" || key == "status") {
+			if (!ioReader.readString(text))
+				break;
+			if (key == "type") {
+				if (const auto result = std::ranges::find_if(
+							g_typeConvert, [&text](const auto& iItem) -> auto { return iItem.second == text; });
+					result != g_typeConvert.end())
+					m_type = result->first;
+			} else if (const auto result = std::ranges::find_if(
+							   g_statusConvert, [&text](const auto& iItem) -> auto { return iItem.second == text; });
+					   result != g_statusConvert.end()) {
+				m_status = result->first;
+			}
+		} else if (key == "Id") {
+			ioReader.readInteger(m_id);
+		} else if (key == "start") {
+			ioReader.readTime(m_start);
+		} else if (key == "end") {
+			ioReader.readTime(m_end);
+		} else if (key == "diapoPath") {
+			if (ioReader.readString(text))
+				m_diapoPath = text;
+		} else if (key == "diapoDelay") {
+			ioReader.readDouble(m_diapoDelay);
+		} else if (key == "subGames") {
+			m_subGames.clear();
+			if (!ioReader.enterSeq())
+				break;
+			while (ioReader.nextItem())
+				if (!m_subGames.emplace_back().readText(ioReader))
+					break;
+		} else {
+			ioReader.skip();
 		}
 	}
+	rewindCurrentSubRound();
+	rebuildDrawLog();
+	return !ioReader.hasFailed();
+}
+
+void GameRound::writeText(TextWriter& ioWriter) const {
+	ioWriter.beginMap();
+	ioWriter.putString("type", getTypeStr());
+	ioWriter.putInteger("Id", m_id);
+	ioWriter.putString("status", getStatusStr());
+	ioWriter.putTime("start", m_start);
+	ioWriter.putTime("end", m_end);
+	ioWriter.putString("diapoPath", m_diapoPath.string());
+	ioWriter.putDouble("diapoDelay", m_diapoDelay);
+	ioWriter.key("subGames");
+	ioWriter.beginSeq();
+	for (const auto& sub: m_subGames) sub.writeText(ioWriter);
+	ioWriter.endSeq();
+	ioWriter.endMap();
 }
 
 auto GameRound::toJson() const -> Json::Value {
@@ -245,6 +357,8 @@ void GameRound::fromJson(const Json::Value& iJson) {
 	m_id = iJson.get("Id", 0).asInt();
 	m_subGames.clear();
 	for (auto& jj: iJson.get("subGames", Json::Value::null)) { m_subGames.emplace_back().fromJson(jj); }
+	rewindCurrentSubRound();
+	rebuildDrawLog();
 }
 
 auto GameRound::toYaml() const -> YAML::Node {
@@ -270,6 +384,8 @@ void GameRound::fromYaml(const YAML::Node& iNode) {
 		sgr.fromYaml(jj);
 		m_subGames.push_back(sgr);
 	}
+	rewindCurrentSubRound();
+	rebuildDrawLog();
 }
 
 auto GameRound::isEditable() const -> bool { return m_status == Status::Ready; }
@@ -285,13 +401,11 @@ auto GameRound::isCurrentSubRoundLast() const -> bool {
 }
 
 auto GameRound::getCurrentSubRound() -> std::vector<SubGameRound>::iterator {
-	return std::ranges::find_if(m_subGames,
-								[](const SubGameRound& iSubGameRound) -> bool { return !iSubGameRound.isFinished(); });
+	return std::next(m_subGames.begin(), static_cast<std::ptrdiff_t>(m_currentSub));
 }
 
 auto GameRound::getCurrentSubRound() const -> std::vector<SubGameRound>::const_iterator {
-	return std::ranges::find_if(m_subGames,
-								[](const SubGameRound& iSubGameRound) -> bool { return !iSubGameRound.isFinished(); });
+	return std::next(m_subGames.cbegin(), static_cast<std::ptrdiff_t>(m_currentSub));
 }
 
 auto GameRound::getSubRound(const uint32_t iIndex) -> std::vector<SubGameRound>::iterator {
@@ -312,11 +426,14 @@ auto GameRound::getName() const -> std::string {
 }
 
 auto GameRound::getAllDraws() const -> draws_type {
-	draws_type displayDraws;
-	for (const auto& sub: m_subGames) {
-		displayDraws.insert(displayDraws.end(), sub.getDraws().begin(), sub.getDraws().end());
-	}
-	return displayDraws;
+	const auto draws = m_drawLog.draws();
+	return {draws.begin(), draws.end()};
+}
+
+void GameRound::rebuildDrawLog() {
+	m_drawLog.clear();
+	for (size_t index = 0; index < m_subGames.size(); ++index)
+		for (const auto draw: m_subGames[index].getDraws()) m_drawLog.push(draw, static_cast<uint8_t>(index));
 }
 
 auto GameRound::getDrawStr() const -> std::string {
@@ -7,6 +7,7 @@
  */
 #pragma once
 
+#include "DrawLog.h"
 #include "Log.h"
 #include "Serializable.h"
 #include "SubGameRound.h"
@@ -115,8 +116,9 @@ public:
 	// ---- flux du jeu ----
 	/**
 	 * @brief Advance to the next status if possible
+	 * @param iTime Date et heure du changement.
 	 */
-	void nextStatus();
+	void nextStatus(const time_point& iTime = clock::now());
 
 	/**
 	 * @brief Renvoie une chaine de caractère décrivant l'état courant
@@ -127,8 +129,9 @@ public:
 	/**
 	 * @brief Ajoute le numéro dans la liste des numéros tirés
 	 * @param iNumber Numéro à ajouter
+	 * @param iTime Date et heure du tirage.
 	 */
-	void addPickedNumber(const uint8_t& iNumber);
+	void addPickedNumber(const uint8_t& iNumber, const time_point& iTime = clock::now());
 
 	/**
 	 * @brief Supprime le dernier tirage.
@@ -138,8 +141,9 @@ public:
 	/**
 	 * @brief donne un gagnant
 	 * @param iWinner Le nom du gagnant
+	 * @param iTime Date et heure de la fin de la sous-partie.
 	 */
-	void addWinner(const std::string& iWinner);
+	void addWinner(const std::string& iWinner, const time_point& iTime = clock::now());
 
 	/**
 	 * @brief Renvoie la liste des gagnants de sous-partie
@@ -161,6 +165,32 @@ public:
 	 */
 	void write(std::ostream& iBs) const override;
 
+	/**
+	 * @brief Lecture depuis un fichier par blocs.
+	 * @param iView Le fichier.
+	 * @param iIndex L’index de la partie dans le fichier.
+	 */
+	void readChunk(const EventFileView& iView, uint32_t iIndex);
+
+	/**
+	 * @brief Écriture dans un fichier par blocs.
+	 * @param ioWriter Le fichier en construction.
+	 */
+	void writeChunk(EventFileWriter& ioWriter) const;
+
+	/**
+	 * @brief Lecture en flux depuis un document JSON ou YAML.
+	 * @param ioReader Le lecteur du document.
+	 * @return Faux si le document est invalide.
+	 */
+	auto readText(TextReader& ioReader) -> bool;
+
+	/**
+	 * @brief Écriture en flux dans un document JSON ou YAML.
+	 * @param ioWriter Le rédacteur du document.
+	 */
+	void writeText(TextWriter& ioWriter) const;
+
 	/**
 	 * @brief Écriture dans un json.
 	 * @return Le json à remplir
@@ -272,13 +302,17 @@ public:
 	 */
 	[[nodiscard]] auto getAllDraws() const -> draws_type;
 
+	/**
+	 * @brief Accès au journal des tirages de la partie (tiré, récence, dernier tirage en temps constant).
+	 * @return Le journal des tirages
+	 */
+	[[nodiscard]] auto getDrawLog() const -> const DrawLog& { return m_drawLog; }
+
 	/**
 	 * @brief Renvoie si des tirages sont présents
 	 * @return true si aucun tirage
 	 */
-	[[nodiscard]] auto emptyDraws() const -> bool {
-		return m_subGames.empty() || m_subGames.front().getDraws().empty();
-	}
+	[[nodiscard]] auto emptyDraws() const -> bool { return m_drawLog.empty(); }
 
 	/**
 	 * @brief Renvoie le dernier numéro tiré qui est annulable (255 sinon)
@@ -298,11 +332,7 @@ public:
 	 * @brief Renvoie le nombre total de tirages.
 	 * @return Le nombre de tirages.
 	 */
-	[[nodiscard]] auto drawsCount() const -> draws_type::size_type {
-		return std::accumulate(
-				m_subGames.begin(), m_subGames.end(), 0ULL,
-				[](draws_type::size_type iAccu, const auto& iItem) -> auto { return iAccu + iItem.getDraws().size(); });
-	}
+	[[nodiscard]] auto drawsCount() const -> draws_type::size_type { return m_drawLog.size(); }
 
 	/**
 	 * @brief Défini le diaporama pour la pause
@@ -360,7 +390,30 @@ private:
 
 	/// Diaporama delay (only in pause)
 	double m_diapoDelay = 0;
+
+	/// Index de la sous-partie courante (la première non terminée).
+	sub_rounds_type::size_type m_currentSub = 0;
+
+	/// Journal des tirages de toutes les sous-parties.
+	DrawLog m_drawLog;
 	// ---------------- private functions ----------------
+	/**
+	 * @brief Avance l’index de la sous-partie courante après les sous-parties terminées.
+	 */
+	void advanceCurrentSubRound() {
+		while (m_currentSub < m_subGames.size() && m_subGames[m_currentSub].isFinished()) ++m_currentSub;
+	}
+	/**
+	 * @brief Recalcule l’index de la sous-partie courante depuis le début.
+	 */
+	void rewindCurrentSubRound() {
+		m_currentSub = 0;
+		advanceCurrentSubRound();
+	}
+	/**
+	 * @brief Reconstruit le journal des tirages depuis les sous-parties.
+	 */
+	void rebuildDrawLog();
 };
 
 }// namespace evl::core
@@ -0,0 +1,224 @@
+/**
+ * @file Journal.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "Journal.h"
+
+#include "Log.h"
+#include "utilities.h"
+
+namespace evl::core {
+
+namespace {
+/// Position of an event in its flow, to find the operations that changed nothing.
+struct FlowState {
+	/// Status of the event.
+	Event::Status status = Event::Status::Invalid;
+	/// Index of the current round.
+	int round = -1;
+	/// Status of the current round.
+	GameRound::Status roundStatus = GameRound::Status::Invalid;
+	/// Index of the current sub-round.
+	std::ptrdiff_t subRound = -1;
+	/// Status of the current sub-round.
+	SubGameRound::Status subRoundStatus = SubGameRound::Status::Invalid;
+
+	auto operator==(const FlowState&) const -> bool = default;
+};
+
+auto flowState(const Event& iEvent) -> FlowState {
+	FlowState state{.status = iEvent.getStatus(), .round = iEvent.getCurrentGameRoundIndex()};
+	if (state.round < 0)
+		return state;
+	const auto round = iEvent.getCurrentCGameRound();
+	state.roundStatus = round->getStatus();
+	const auto sub = round->getCurrentSubRound();
+	state.subRound = std::distance(round->beginSubRound(), sub);
+	if (sub != round->endSubRound())
+		state.subRoundStatus = sub->getStatus();
+	return state;
+}
+}// namespace
+
+Journal::Journal(Event& ioEvent) : m_event{ioEvent} { reset(); }
+
+void Journal::reset() {
+	m_records.clear();
+	m_winners.clear();
+	m_snapshots.clear();
+	m_position = 0;
+	takeSnapshot();
+	notify(Change::Reset);
+}
+
+void Journal::draw(const uint8_t iNumber, const time_point& iTime) {
+	refreshBase();
+	const auto count = m_event.canDraw() ? m_event.getCurrentCGameRound()->drawsCount() : 0;
+	m_event.addPickedNumber(iNumber, iTime);
+	if (m_event.canDraw() && m_event.getCurrentCGameRound()->drawsCount() != count)
+		append({.operation = Operation::Draw, .number = iNumber, .time = iTime});
+}
+
+void Journal::cancelPick() {
+	refreshBase();
+	if (!m_event.canDraw())
+		return;
+	const auto round = m_event.getCurrentCGameRound();
+	const auto count = round->drawsCount();
+	const uint8_t last = round->getLastCancelableDraw();
+	const auto sub = round->getCurrentSubRound();
+	const auto drawTime = sub->emptyDraws() ? time_point{} : sub->getDrawTime(sub->getDraws().size() - 1);
+	m_event.removeLastPick();
+	if (m_event.getCurrentCGameRound()->drawsCount() != count)
+		append({.operation = Operation::CancelPick, .number = last, .time = drawTime});
+}
+
+void Journal::addWinner(const std::string& iWinner, const time_point& iTime) {
+	refreshBase();
+	const auto before = flowState(m_event);
+	m_event.addWinnerToCurrentRound(iWinner, iTime);
+	if (flowState(m_event) == before)
+		return;
+	dropRedo();
+	m_winners.push_back(iWinner);
+	append({.operation = Operation::Winner, .winner = static_cast<uint32_t>(m_winners.size() - 1), .time = iTime});
+}
+
+void Journal::nextState(const time_point& iTime) {
+	refreshBase();
+	const auto before = flowState(m_event);
+	m_event.nextState(iTime);
+	if (flowState(m_event) != before)
+		append({.operation = Operation::NextState, .time = iTime});
+}
+
+void Journal::displayRules() {
+	refreshBase();
+	const auto status = m_event.getStatus();
+	m_event.displayRules();
+	if (m_event.getStatus() != status)
+		append({.operation = Operation::DisplayRules});
+}
+
+auto Journal::undo() -> bool {
+	if (!canUndo())
+		return false;
+	const Record& record = m_records[m_position - 1];
+	switch (record.operation) {
+		case Operation::Draw:
+			m_event.removeLastPick();
+			--m_position;
+			break;
+		case Operation::CancelPick:
+			m_event.addPickedNumber(record.number, record.time);
+			--m_position;
+			break;
+		case Operation::Winner:
+		case Operation::NextState:
+		case Operation::DisplayRules:
+			rebuild(m_position - 1);
+			break;
+	}
+	notify(Change::Undo);
+	return true;
+}
+
+auto Journal::redo() -> bool {
+	if (!canRedo())
+		return false;
+	apply(m_records[m_position]);
+	++m_position;
+	notify(Change::Redo);
+	return true;
+}
+
+auto Journal::seek(const size_t iPosition) -> bool {
+	if (iPosition > m_records.size())
+		return false;
+	if (iPosition == m_position)
+		return true;
+	if (iPosition > m_position && iPosition - m_position <= g_snapshotInterval) {
+		for (; m_position < iPosition; ++m_position) apply(m_records[m_position]);
+	} else {
+		rebuild(iPosition);
+	}
+	notify(Change::Seek);
+	return true;
+}
+
+void Journal::refreshBase() {
+	// the event may have been edited (settings, rounds) since the last operation
+	if (m_position == 0)
+		reset();
+}
+
+void Journal::dropRedo() {
+	if (m_position == m_records.size())
+		return;
+	for (auto record = m_records.begin() + static_cast<std::ptrdiff_t>(m_position); record != m_records.end();
+		 ++record) {
+		if (record->operation == Operation::Winner) {
+			m_winners.resize(record->winner);
+			break;
+		}
+	}
+	m_records.resize(m_position);
+	while (m_snapshots.size() > 1 && m_snapshots.back().position > m_position) m_snapshots.pop_back();
+}
+
+void Journal::append(const Record& iRecord) {
+	dropRedo();
+	m_records.push_back(iRecord);
+	++m_position;
+	// no snapshot while the rules are displayed: the status to restore is not serialized
+	if (m_position - m_snapshots.back().position >= g_snapshotInterval &&
+		m_event.getStatus() != Event::Status::DisplayRules)
+		takeSnapshot();
+	notify(Change::Append);
+}
+
+void Journal::apply(const Record& iRecord) {
+	switch (iRecord.operation) {
+		case Operation::Draw:
+			m_event.addPickedNumber(iRecord.number, iRecord.time);
+			break;
+		case Operation::CancelPick:
+			m_event.removeLastPick();
+			break;
+		case Operation::Winner:
+			m_event.addWinnerToCurrentRound(m_winners[iRecord.winner], iRecord.time);
+			break;
+		case Operation::NextState:
+			m_event.nextState(iRecord.time);
+			break;
+		case Operation::DisplayRules:
+			m_event.displayRules();
+			break;
+	}
+}
+
+void Journal::takeSnapshot() {
+	std::ostringstream stream(std::ios::out | std::ios::binary);
+	m_event.write(stream);
+	m_snapshots.push_back({.position = m_position, .data = stream.str()});
+}
+
+void Journal::rebuild(const size_t iPosition) {
+	const auto snapshot = std::ranges::find_if(m_snapshots.rbegin(), m_snapshots.rend(),
+											   [iPosition](const Snapshot& iSnap) { return iSnap.position <= iPosition; });
+	std::istringstream stream(snapshot->data, std::ios::in | std::ios::binary);
+	m_event.read(stream, getSaveVersion(), Event::CardLoading::Keep);
+	m_position = snapshot->position;
+	while (m_position < iPosition) {
+		apply(m_records[m_position]);
+		++m_position;
+	}
+	log_debug("Journal: événement reconstruit à la position {}", m_position);
+}
+
+}// namespace evl::core
@@ -0,0 +1,219 @@
+/**
+ * @file Journal.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#pragma once
+
+#include "Event.h"
+
+#include <functional>
+#include <span>
+
+namespace evl::core {
+
+/**
+ * @brief Class Journal: append-only log of the operations on an event, with undo, redo and replay.
+ *
+ * All the operations of the game flow go through the journal, which records them as small fixed-size
+ * records and forwards them to the event. A full snapshot of the event is taken every g_snapshotInterval
+ * records: any position is rebuilt by restoring the nearest snapshot (keeping the loaded cards) and replaying
+ * at most g_snapshotInterval records. Draws and cancellations are undone directly by their inverse operation.
+ *
+ * Each record keeps the time of its operation: a replayed operation gets its original time, so undo, redo and
+ * recovery leave the draw delays and the start and end times of the event unchanged.
+ * The operations rejected by the event (nothing changed) are not recorded.
+ */
+class Journal {
+public:
+	/// Kind of operation.
+	enum struct Operation : uint8_t {
+		Draw,///< Draw of a number.
+		CancelPick,///< Cancellation of the last draw.
+		Winner,///< Winner of the current sub-round.
+		NextState,///< Next step of the event.
+		DisplayRules,///< Display of the rules (or back from them).
+	};
+
+	/// A journal record.
+	struct Record {
+		/// The operation.
+		Operation operation = Operation::Draw;
+		/// The drawn or cancelled number.
+		uint8_t number = 0;
+		/// Index of the winner in the winner list.
+		uint32_t winner = 0;
+		/// Time of the operation (for a cancellation: time of the cancelled draw).
+		time_point time{};
+	};
+
+	/// Change of the journal, reported to the listener.
+	enum struct Change : uint8_t {
+		Reset,///< New base state, history forgotten.
+		Append,///< A record has been appended (the last applied one).
+		Undo,///< The last operation has been undone.
+		Redo,///< An undone operation has been redone.
+		Seek,///< Jump to another position.
+	};
+	/// Listener of the changes.
+	using listener_type = std::function<void(const Journal&, Change)>;
+
+	/// Number of records between two snapshots.
+	static constexpr size_t g_snapshotInterval = 32;
+
+	/**
+	 * @brief Constructor.
+	 * @param ioEvent The journaled event.
+	 */
+	explicit Journal(Event& ioEvent);
+
+	/**
+	 * @brief Define the function called after each change of the journal.
+	 * @param iListener The listener.
+	 */
+	void setListener(listener_type iListener) { m_listener = std::move(iListener); }
+
+	/**
+	 * @brief Forget the history and start from the current state of the event (after a load or a new event).
+	 */
+	void reset();
+
+	/**
+	 * @brief Draw a number.
+	 * @param iNumber The number.
+	 * @param iTime Time of the draw.
+	 */
+	void draw(uint8_t iNumber, const time_point& iTime = clock::now());
+	/**
+	 * @brief Cancel the last draw.
+	 */
+	void cancelPick();
+	/**
+	 * @brief Set the winner of the current sub-round.
+	 * @param iWinner The winner.
+	 * @param iTime Time of the end of the sub-round.
+	 */
+	void addWinner(const std::string& iWinner, const time_point& iTime = clock::now());
+	/**
+	 * @brief Go to the next step of the event.
+	 * @param iTime Time of the change.
+	 */
+	void nextState(const time_point& iTime = clock::now());
+	/**
+	 * @brief Display the rules or go back from them.
+	 */
+	void displayRules();
+
+	/**
+	 * @brief Check if an operation can be undone.
+	 * @return True if there is an operation to undo.
+	 */
+	[[nodiscard]] auto canUndo() const -> bool { return m_position > 0; }
+	/**
+	 * @brief Check if an operation can be redone.
+	 * @return True if there is an operation to redo.
+	 */
+	[[nodiscard]] auto canRedo() const -> bool { return m_position < m_records.size(); }
+	/**
+	 * @brief Undo the last operation.
+	 * @return False if there is nothing to undo.
+	 */
+	auto undo() -> bool;
+	/**
+	 * @brief Redo the last undone operation.
+	 * @return False if there is nothing to redo.
+	 */
+	auto redo() -> bool;
+	/**
+	 * @brief Rebuild the event as it was after a number of operations.
+	 * @param iPosition The number of operations.
+	 * @return False if the position is beyond the journal.
+	 */
+	auto seek(size_t iPosition) -> bool;
+
+	/**
+	 * @brief Get the number of applied operations.
+	 * @return The position in the journal.
+	 */
+	[[nodiscard]] auto getPosition() const -> size_t { return m_position; }
+	/**
+	 * @brief Access to the records (the ones after the position can be redone).
+	 * @return The records.
+	 */
+	[[nodiscard]] auto getRecords() const -> std::span<const Record> { return m_records; }
+	/**
+	 * @brief Get the winner of a record.
+	 * @param iRecord The record.
+	 * @return The winner.
+	 */
+	[[nodiscard]] auto getWinner(const Record& iRecord) const -> const std::string& {
+		return m_winners[iRecord.winner];
+	}
+	/**
+	 * @brief Access to the serialized state of the event at the last reset.
+	 * @return The base state.
+	 */
+	[[nodiscard]] auto getBase() const -> std::string_view { return m_snapshots.front().data; }
+
+private:
+	/// Full state of the event at a position.
+	struct Snapshot {
+		/// The position.
+		size_t position = 0;
+		/// The serialized event.
+		std::string data;
+	};
+
+	/**
+	 * @brief Report a change to the listener.
+	 * @param iChange The change.
+	 */
+	void notify(Change iChange) const {
+		if (m_listener)
+			m_listener(*this, iChange);
+	}
+	/**
+	 * @brief Take a new base snapshot if no operation is applied.
+	 */
+	void refreshBase();
+	/**
+	 * @brief Drop the records after the current position.
+	 */
+	void dropRedo();
+	/**
+	 * @brief Append a record after the current position (the redo history is dropped).
+	 * @param iRecord The record.
+	 */
+	void append(const Record& iRecord);
+	/**
+	 * @brief Apply a record to the event.
+	 * @param iRecord The record.
+	 */
+	void apply(const Record& iRecord);
+	/**
+	 * @brief Take a snapshot of the event at the current position.
+	 */
+	void takeSnapshot();
+	/**
+	 * @brief Restore the nearest snapshot and replay the records up to a position.
+	 * @param iPosition The position.
+	 */
+	void rebuild(size_t iPosition);
+
+	/// The event.
+	Event& m_event;
+	/// The records.
+	std::vector<Record> m_records;
+	/// The winners, referenced by the records.
+	std::vector<std::string> m_winners;
+	/// The snapshots, by increasing position.
+	std::vector<Snapshot> m_snapshots;
+	/// Number of applied records.
+	size_t m_position = 0;
+	/// The listener.
+	listener_type m_listener;
+};
+
+}// namespace evl::core
@@ -50,7 +50,8 @@ std::shared_ptr<spdlog::logger> g_logger;
 
 auto getLogPath() -> std::filesystem::path { return core::getExecPath() / "exec.log"; }
 
-Log::Level Log::m_verbosity = Level::Trace;
+std::atomic<Log::Level> Log::m_verbosity = Level::Trace;
+std::atomic<Log::Level> Log::m_threshold = Level::Off;
 
 
 void Log::init(const Level& iLevel) {
@@ -75,12 +76,14 @@ void Log::setVerbosityLevel(const Level& iLevel) {
 	if (!initiated())
 		return;
 	m_verbosity = iLevel;
-	g_logger->set_level(fromLevel(m_verbosity));
-	g_logger->flush_on(fromLevel(m_verbosity));
+	m_threshold = iLevel;
+	g_logger->set_level(fromLevel(iLevel));
+	g_logger->flush_on(fromLevel(iLevel));
 	setPattern();
 }
 
 void Log::invalidate() {
+	m_threshold = Level::Off;
 	spdlog::drop_all();
 	g_logger.reset();
 	spdlog::shutdown();
@@ -88,11 +91,11 @@ void Log::invalidate() {
 
 auto Log::initiated() -> bool { return g_logger != nullptr; }
 
-void Log::log(const Level& iLevel, const char* iFile, const int iLine, const std::string_view& iMsg) {
+void Log::log(const Level& iLevel, const char* iFile, const int iLine, std::string iMsg) {
 	if (!initiated())
 		return;
-	g_logger->log(spdlog::source_loc{iFile, iLine, SPDLOG_FUNCTION}, fromLevel(iLevel), iMsg);
-	logs::LogBuffer::get().addLog(std::string(iMsg), iLevel);
+	g_logger->log(spdlog::source_loc{iFile, iLine, SPDLOG_FUNCTION}, fromLevel(iLevel), std::string_view{iMsg});
+	logs::LogBuffer::get().addLog(std::move(iMsg), iLevel);
 }
 
 
@@ -104,7 +107,7 @@ void Log::setPattern() {
 	if (!initiated())
 		return;
 	const auto& sk = g_logger->sinks();
-	if (m_verbosity == Level::Debug || m_verbosity == Level::Trace) {
+	if (const auto verbosity = getVerbosityLevel(); verbosity == Level::Debug || verbosity == Level::Trace) {
 		sk[0]->set_pattern(console_pattern_dbg);
 		sk[1]->set_pattern(file_pattern_dbg);
 	} else {
@@ -114,9 +117,9 @@ void Log::setPattern() {
 }
 
 namespace logs {
-void LogBuffer::addLog(const std::string& iMessage, Log::Level iLevel) {
+void LogBuffer::addLog(std::string iMessage, Log::Level iLevel) {
 	const std::scoped_lock<std::mutex> lock(m_mutex);
-	m_logs.emplace_back(iMessage, iLevel, core::clock::now());
+	m_logs.emplace_back(std::move(iMessage), iLevel, core::clock::now());
 	if (m_logs.size() > 1000) {// Limit to 1000 entries
 		m_logs.erase(m_logs.begin());
 	}
@@ -9,9 +9,15 @@
 #pragma once
 #include "timeFunctions.h"
 
+#include <atomic>
 #include <filesystem>
 #include <mutex>
 
+/// Lowest level of the log calls compiled in (0: Trace ... 5: Critical), the lower calls are removed.
+#ifndef EVL_LOG_MIN_LEVEL
+#define EVL_LOG_MIN_LEVEL 0
+#endif
+
 namespace evl {
 /**
  * @brief Get the log file path.
@@ -36,6 +42,9 @@ public:
 		Critical,///< CRITICAL level
 		Off///< OFF level
 	};
+	/// Lowest level of the log calls compiled in.
+	static constexpr Level g_minLevel = static_cast<Level>(EVL_LOG_MIN_LEVEL);
+
 	/**
 	 * @brief initialize the logging system.
 	 * @param[in] iLevel Verbosity level of the logger.
@@ -46,7 +55,16 @@ public:
 	 * @brief Get the current Verbosity level.
 	 * @return The verbosity level.
 	 */
-	static auto getVerbosityLevel() -> const Level& { return m_verbosity; }
+	static auto getVerbosityLevel() -> Level { return m_verbosity.load(std::memory_order_relaxed); }
+
+	/**
+	 * @brief Check if a message of a level would be logged, before formatting it.
+	 * @param iLevel Verbosity level of the message.
+	 * @return True if the logger is initiated and the level is not filtered.
+	 */
+	static auto isEnabled(const Level iLevel) -> bool {
+		return iLevel >= m_threshold.load(std::memory_order_relaxed) && iLevel != Level::Off;
+	}
 
 	/**
 	 * @brief Defines the Verbosity level
@@ -66,7 +84,7 @@ public:
 	static auto initiated() -> bool;
 
 	/**
-	 * @brief Log a message for the core.
+	 * @brief Log a message for the core, formatted only if the level is enabled.
 	 * @tparam Args Template parameters for format arguments.
 	 * @param iLevel Verbosity level.
 	 * @param iFile The file name of the log call.
@@ -77,21 +95,24 @@ public:
 	template<typename... Args>
 	static void log(const Level& iLevel, const char* iFile, int iLine, std::format_string<Args...> iFmt,
 					Args&&... iArgs) {
-		log(iLevel, iFile, iLine, std::format(iFmt, std::forward<Args>(iArgs)...));
+		if (isEnabled(iLevel))
+			log(iLevel, iFile, iLine, std::format(iFmt, std::forward<Args>(iArgs)...));
 	}
 
 	/**
-	 * @brief Log a message for the core.
+	 * @brief Log a message for the core: the sinks and the log buffer share the same message.
 	 * @param iLevel Verbosity level.
 	 * @param iFile The file name of the log call.
 	 * @param iLine The line number of the log call.
-	 * @param iMsg Message to log.
+	 * @param iMsg Message to log, moved in the log buffer.
 	 */
-	static void log(const Level& iLevel, const char* iFile, int iLine, const std::string_view& iMsg);
+	static void log(const Level& iLevel, const char* iFile, int iLine, std::string iMsg);
 
 private:
 	/// The level of verbosity.
-	static Level m_verbosity;
+	static std::atomic<Level> m_verbosity;
+	/// The lowest logged level: Off while the logger is not initiated.
+	static std::atomic<Level> m_threshold;
 
 	/**
 	 * @brief Define the log pattern according to the verbosity.
@@ -101,13 +122,22 @@ private:
 
 }// namespace evl
 
-#define log_trace(...) ::evl::Log::log(::evl::Log::Level::Trace, __FILE__, __LINE__, __VA_ARGS__)
-#define log_debug(...) ::evl::Log::log(::evl::Log::Level::Debug, __FILE__, __LINE__, __VA_ARGS__)
-#define log_info(...) ::evl::Log::log(::evl::Log::Level::Info, __FILE__, __LINE__, __VA_ARGS__)
-#define log_warn(...) ::evl::Log::log(::evl::Log::Level::Warning, __FILE__, __LINE__, __VA_ARGS__)
-#define log_warning(...) ::evl::Log::log(::evl::Log::Level::Warning, __FILE__, __LINE__, __VA_ARGS__)
-#define log_error(...) ::evl::Log::log(::evl::Log::Level::Error, __FILE__, __LINE__, __VA_ARGS__)
-#define log_critical(...) ::evl::Log::log(::evl::Log::Level::Critical, __FILE__, __LINE__, __VA_ARGS__)
+/// Log call: the arguments are neither evaluated nor formatted if the level is filtered.
+#define EVL_LOG(iLevel, ...)                                                                                           \
+	do {                                                                                                               \
+		if constexpr ((iLevel) >= ::evl::Log::g_minLevel) {                                                            \
+			if (::evl::Log::isEnabled(iLevel))                                                                         \
+				::evl::Log::log(iLevel, __FILE__, __LINE__, __VA_ARGS__);                                              \
+		}                                                                                                              \
+	} while (false)
+
+#define log_trace(...) EVL_LOG(::evl::Log::Level::Trace, __VA_ARGS__)
+#define log_debug(...) EVL_LOG(::evl::Log::Level::Debug, __VA_ARGS__)
+#define log_info(...) EVL_LOG(::evl::Log::Level::Info, __VA_ARGS__)
+#define log_warn(...) EVL_LOG(::evl::Log::Level::Warning, __VA_ARGS__)
+#define log_warning(...) EVL_LOG(::evl::Log::Level::Warning, __VA_ARGS__)
+#define log_error(...) EVL_LOG(::evl::Log::Level::Error, __VA_ARGS__)
+#define log_critical(...) EVL_LOG(::evl::Log::Level::Critical, __VA_ARGS__)
 
 namespace evl::logs {
 
@@ -123,7 +153,7 @@ public:
 		static LogBuffer instance;
 		return instance;
 	}
-	void addLog(const std::string& iMessage, Log::Level iLevel);
+	void addLog(std::string iMessage, Log::Level iLevel);
 
 	auto getLogs() const -> const std::vector<LogEntry>&;
 
@@ -0,0 +1,109 @@
+/**
+ * @file MappedFile.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "MappedFile.h"
+
+#include "Log.h"
+
+#ifdef EVL_PLATFORM_WINDOWS
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace evl::core {
+
+MappedFile::MappedFile(const std::filesystem::path& iPath) { open(iPath); }
+
+MappedFile::~MappedFile() { close(); }
+
+MappedFile::MappedFile(MappedFile&& ioOther) noexcept
+	: m_data{std::exchange(ioOther.m_data, nullptr)}, m_size{std::exchange(ioOther.m_size, 0)} {
+#ifdef EVL_PLATFORM_WINDOWS
+	m_mapping = std::exchange(ioOther.m_mapping, nullptr);
+#endif
+}
+
+auto MappedFile::operator=(MappedFile&& ioOther) noexcept -> MappedFile& {
+	if (this == &ioOther)
+		return *this;
+	close();
+	m_data = std::exchange(ioOther.m_data, nullptr);
+	m_size = std::exchange(ioOther.m_size, 0);
+#ifdef EVL_PLATFORM_WINDOWS
+	m_mapping = std::exchange(ioOther.m_mapping, nullptr);
+#endif
+	return *this;
+}
+
+auto MappedFile::open(const std::filesystem::path& iPath) -> bool {
+	close();
+	std::error_code error;
+	const auto size = std::filesystem::file_size(iPath, error);
+	if (error || size == 0) {
+		log_warn("Impossible de mapper le fichier '{}'", iPath.string());
+		return false;
+	}
+#ifdef EVL_PLATFORM_WINDOWS
+	HANDLE file = CreateFileW(iPath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+							  FILE_ATTRIBUTE_NORMAL, nullptr);
+	if (file == INVALID_HANDLE_VALUE) {
+		log_warn("Impossible d'ouvrir le fichier '{}'", iPath.string());
+		return false;
+	}
+	HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+	CloseHandle(file);
+	if (mapping == nullptr) {
+		log_warn("Impossible de mapper le fichier '{}'", iPath.string());
+		return false;
+	}
+	void* view = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+	if (view == nullptr) {
+		CloseHandle(mapping);
+		log_warn("Impossible de mapper le fichier '{}'", iPath.string());
+		return false;
+	}
+	m_mapping = mapping;
+	m_data = static_cast<const uint8_t*>(view);
+#else
+	const int file = ::open(iPath.c_str(), O_RDONLY);
+	if (file < 0) {
+		log_warn("Impossible d'ouvrir le fichier '{}'", iPath.string());
+		return false;
+	}
+	void* view = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, file, 0);
+	::close(file);
+	if (view == MAP_FAILED) {
+		log_warn("Impossible de mapper le fichier '{}'", iPath.string());
+		return false;
+	}
+	m_data = static_cast<const uint8_t*>(view);
+#endif
+	m_size = static_cast<size_t>(size);
+	return true;
+}
+
+void MappedFile::close() {
+	if (m_data == nullptr)
+		return;
+#ifdef EVL_PLATFORM_WINDOWS
+	UnmapViewOfFile(m_data);
+	CloseHandle(m_mapping);
+	m_mapping = nullptr;
+#else
+	munmap(const_cast<uint8_t*>(m_data), m_size);
+#endif
+	m_data = nullptr;
+	m_size = 0;
+}
+
+}// namespace evl::core
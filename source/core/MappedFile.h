@@ -0,0 +1,77 @@
+/**
+ * @file MappedFile.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#pragma once
+
+#include <cstdint>
+#include <filesystem>
+#include <span>
+
+namespace evl::core {
+
+/**
+ * @brief Class MappedFile: read-only memory mapping of a whole file.
+ */
+class MappedFile {
+public:
+	MappedFile() = default;
+	/**
+	 * @brief Constructor mapping a file.
+	 * @param iPath The file to map.
+	 */
+	explicit MappedFile(const std::filesystem::path& iPath);
+	~MappedFile();
+	MappedFile(const MappedFile&) = delete;
+	/**
+	 * @brief Move constructor.
+	 * @param ioOther The mapping to take over.
+	 */
+	MappedFile(MappedFile&& ioOther) noexcept;
+	auto operator=(const MappedFile&) -> MappedFile& = delete;
+	/**
+	 * @brief Move assignment.
+	 * @param ioOther The mapping to take over.
+	 * @return this
+	 */
+	auto operator=(MappedFile&& ioOther) noexcept -> MappedFile&;
+
+	/**
+	 * @brief Map a file, closing the previous mapping.
+	 * @param iPath The file to map.
+	 * @return True if the file is mapped.
+	 */
+	auto open(const std::filesystem::path& iPath) -> bool;
+
+	/**
+	 * @brief Release the mapping.
+	 */
+	void close();
+
+	/**
+	 * @brief Check if a file is mapped.
+	 * @return True if mapped.
+	 */
+	[[nodiscard]] auto isOpen() const -> bool { return m_data != nullptr; }
+
+	/**
+	 * @brief Access to the mapped bytes.
+	 * @return The file content.
+	 */
+	[[nodiscard]] auto data() const -> std::span<const uint8_t> { return {m_data, m_size}; }
+
+private:
+	/// Start of the mapping.
+	const uint8_t* m_data = nullptr;
+	/// Size of the mapping.
+	size_t m_size = 0;
+#ifdef EVL_PLATFORM_WINDOWS
+	/// File mapping handle.
+	void* m_mapping = nullptr;
+#endif
+};
+
+}// namespace evl::core
@@ -0,0 +1,225 @@
+/**
+ * @file Migration.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "Migration.h"
+
+#include "BinaryIO.h"
+#include "Event.h"
+#include "EventSaver.h"
+#include "GameRound.h"
+#include "Log.h"
+#include "ThreadPool.h"
+#include "utilities.h"
+
+namespace evl::core {
+
+using namespace binary;
+
+namespace {
+/// Extension of the event files.
+constexpr std::string_view g_extension = ".lev";
+
+/**
+ * @brief Give the id 0 to the rounds of the files without ids.
+ * @param ioRound The round.
+ */
+void clearRoundId(GameRound& ioRound, const LegacyRound&) { ioRound.setId(0); }
+
+/**
+ * @brief Split the draws of a round between its sub-rounds and set their status from the winners.
+ *
+ * The split is not saved: the draws are shared evenly between the played sub-rounds (the ones with a winner,
+ * then the current one if the round is running), the rest going to the last one.
+ * @param ioRound The round.
+ * @param iLegacy The draws of the round.
+ */
+void splitRoundDraws(GameRound& ioRound, const LegacyRound& iLegacy) {
+	const auto count = static_cast<uint32_t>(ioRound.sizeSubRound());
+	uint32_t finished = 0;
+	while (finished < count && !ioRound.getSubRound(finished)->getWinner().empty()) ++finished;
+	const uint32_t played =
+			ioRound.getStatus() == GameRound::Status::Running && finished < count ? finished + 1 : finished;
+	const auto& draws = iLegacy.draws;
+	size_t first = 0;
+	for (uint32_t index = 0; index < count; ++index) {
+		size_t last = first;
+		if (index < played)
+			last = index + 1 == played ? draws.size() : first + draws.size() / played;
+		SubGameRound::Status status = SubGameRound::Status::Ready;
+		if (index < finished)
+			status = SubGameRound::Status::Done;
+		else if (index < played)
+			status = SubGameRound::Status::Running;
+		ioRound.getSubRound(index)->restore(
+				status, {std::next(draws.begin(), static_cast<std::ptrdiff_t>(first)),
+						 std::next(draws.begin(), static_cast<std::ptrdiff_t>(last))});
+		first = last;
+	}
+	if (first < draws.size())
+		log_warn("{} tirages sans sous-partie jouée perdus", draws.size() - first);
+}
+
+/// The changes of the format, from the oldest.
+constexpr std::array g_steps{
+		MigrationStep{.version = 2, .change = FormatChange::EventRules, .description = "règles de l'événement"},
+		MigrationStep{.version = 3,
+					  .change = FormatChange::RoundIds,
+					  .description = "numéros des parties",
+					  .upgradeRound = clearRoundId},
+		MigrationStep{.version = 4,
+					  .change = FormatChange::SubRoundResults,
+					  .description = "tirages et gagnants par sous-partie",
+					  .lossy = true,
+					  .upgradeRound = splitRoundDraws},
+		MigrationStep{.version = 5, .change = FormatChange::PauseDiaporama, .description = "diaporama des pauses"},
+		MigrationStep{.version = 6, .change = FormatChange::SubRoundTimes, .description = "dates des sous-parties"},
+		MigrationStep{.version = 7, .change = FormatChange::CardPack, .description = "paquet de cartons"},
+		MigrationStep{.version = 8, .change = FormatChange::DrawDelays, .description = "horodatage des tirages"},
+		MigrationStep{.version = 9, .change = FormatChange::Chunks, .description = "format par blocs"},
+};
+
+/**
+ * @brief Decode an event and write it in the current version.
+ * @param iFile The file of the event (for its relative paths).
+ * @param iContent The content to decode.
+ * @param oEvent The decoded event.
+ * @param oContent The content in the current version.
+ * @return False if the content cannot be decoded.
+ */
+auto rewrite(const std::filesystem::path& iFile, const std::string& iContent, Event& oEvent, std::string& oContent)
+		-> bool {
+	oEvent.setBasePath(iFile);
+	std::istringstream input(iContent, std::ios::in | std::ios::binary);
+	try {
+		oEvent.read(input, 0, Event::CardLoading::Skip);
+	} catch (const std::exception& except) {
+		log_warn("Impossible de décoder '{}': {}", iFile.string(), except.what());
+		return false;
+	}
+	if (input.fail())
+		return false;
+	std::ostringstream output(std::ios::out | std::ios::binary);
+	oEvent.write(output);
+	oContent = std::move(output).str();
+	return true;
+}
+}// namespace
+
+auto getMigrationSteps() -> std::span<const MigrationStep> { return g_steps; }
+
+auto getMigrationSteps(const uint16_t iVersion) -> std::span<const MigrationStep> {
+	const auto first = std::ranges::upper_bound(g_steps, iVersion, {}, &MigrationStep::version);
+	return {first, g_steps.end()};
+}
+
+auto hasFormatChange(const uint16_t iVersion, const FormatChange iChange) -> bool {
+	const auto step = std::ranges::find(g_steps, iChange, &MigrationStep::change);
+	return step != g_steps.end() && iVersion >= step->version;
+}
+
+void upgradeRound(GameRound& ioRound, const LegacyRound& iLegacy, const uint16_t iVersion) {
+	for (const auto& step: getMigrationSteps(iVersion))
+		if (step.upgradeRound != nullptr)
+			step.upgradeRound(ioRound, iLegacy);
+}
+
+auto MigrationReport::count(const MigrationResult::Outcome iOutcome) const -> size_t {
+	return static_cast<size_t>(std::ranges::count(files, iOutcome, &MigrationResult::outcome));
+}
+
+auto MigrationReport::failed() const -> size_t {
+	return static_cast<size_t>(std::ranges::count_if(files, &MigrationResult::failed));
+}
+
+Migrator::Migrator(const Options& iOptions) : m_options{iOptions} {}
+
+auto Migrator::migrateFile(const std::filesystem::path& iFile) const -> MigrationResult {
+	using Outcome = MigrationResult::Outcome;
+	MigrationResult result{.file = iFile};
+	std::string content;
+	if (!readContent(iFile, content) || content.size() < sizeof(uint16_t)) {
+		log_warn("Impossible de lire '{}'", iFile.string());
+		return result;
+	}
+	std::memcpy(&result.version, content.data(), sizeof(uint16_t));
+	if (result.version == 0 || result.version > getSaveVersion()) {
+		log_warn("Version de '{}' inconnue: {}", iFile.string(), result.version);
+		result.outcome = Outcome::Unsupported;
+		return result;
+	}
+	const auto steps = getMigrationSteps(result.version);
+	result.lossy = std::ranges::any_of(steps, &MigrationStep::lossy);
+
+	// a valid event gives the same content when written, read back and written again
+	Event event;
+	Event reread;
+	std::string upgraded;
+	std::string check;
+	if (!rewrite(iFile, content, event, upgraded) || !rewrite(iFile, upgraded, reread, check) || check != upgraded) {
+		log_warn("Fichier '{}' corrompu", iFile.string());
+		result.outcome = Outcome::Corrupted;
+		return result;
+	}
+	if (steps.empty()) {
+		result.outcome = Outcome::Current;
+		return result;
+	}
+	if (m_options.checkOnly) {
+		result.outcome = Outcome::Outdated;
+		return result;
+	}
+
+	if (m_options.backup) {
+		auto backup = iFile;
+		backup += g_backupExtension;
+		if (std::error_code error;
+			!std::filesystem::copy_file(iFile, backup, std::filesystem::copy_options::overwrite_existing, error)) {
+			log_warn("Impossible de sauvegarder '{}': {}", iFile.string(), error.message());
+			result.outcome = Outcome::WriteFailed;
+			return result;
+		}
+	}
+	// the file is replaced only once the new version is on the disk
+	if (!EventSaver::writeAtomic(event, iFile)) {
+		result.outcome = Outcome::WriteFailed;
+		return result;
+	}
+	log_info("'{}' migré de la version {} à {}{}", iFile.string(), result.version, getSaveVersion(),
+			 result.lossy ? " (avec pertes)" : "");
+	result.outcome = Outcome::Upgraded;
+	return result;
+}
+
+auto Migrator::migrate(const std::filesystem::path& iDirectory) const -> MigrationReport {
+	MigrationReport report;
+	std::error_code error;
+	for (std::filesystem::recursive_directory_iterator
+				 item(iDirectory, std::filesystem::directory_options::skip_permission_denied, error),
+		 end;
+		 !error && item != end; item.increment(error)) {
+		if (item->is_regular_file(error) && item->path().extension() == g_extension)
+			report.files.push_back({.file = item->path()});
+	}
+	if (error)
+		log_warn("Erreur lors du parcours de '{}': {}", iDirectory.string(), error.message());
+	std::ranges::sort(report.files, {}, &MigrationResult::file);
+
+	{
+		ThreadPool pool(m_options.threads);
+		for (auto& result: report.files) pool.submit([this, &result] { result = migrateFile(result.file); });
+		pool.wait();
+	}
+	log_info("Migration de '{}': {} fichiers, {} à jour, {} migrés, {} à migrer, {} en échec", iDirectory.string(),
+			 report.files.size(), report.count(MigrationResult::Outcome::Current),
+			 report.count(MigrationResult::Outcome::Upgraded), report.count(MigrationResult::Outcome::Outdated),
+			 report.failed());
+	return report;
+}
+
+}// namespace evl::core
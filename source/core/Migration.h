@@ -0,0 +1,189 @@
+/**
+ * @file Migration.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#pragma once
+
+#include <filesystem>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace evl::core {
+
+class GameRound;
+
+/// Changes of the event file format.
+enum struct FormatChange : uint8_t {
+	EventRules,///< Rules of the event.
+	RoundIds,///< Ids of the rounds (and a string of the version 3 only).
+	SubRoundResults,///< Status, value, winner and draws by sub-round instead of draws by round.
+	PauseDiaporama,///< Diaporama of the pauses.
+	SubRoundTimes,///< Start and end of the sub-rounds.
+	CardPack,///< Card pack of the event.
+	DrawDelays,///< Delays of the draws.
+	Chunks,///< Chunked format.
+};
+
+/**
+ * @brief What a round of an old file holds that the current rounds cannot, kept by the reader for the upgrades.
+ */
+struct LegacyRound {
+	/// Draws of the round, before they were saved by sub-round.
+	std::vector<uint8_t> draws{};
+};
+
+/// Winner of the finished sub-rounds of the files where only a flag was saved.
+constexpr std::string_view g_legacyWinner = "inconnu";
+
+/**
+ * @brief A change of the event file format.
+ *
+ * The readers of the old formats ask the steps which fields a version holds (see hasFormatChange), then the
+ * upgrades of the steps after the version of the file convert what was read (see upgradeRound). A field
+ * missing from a file without upgrade keeps its default value.
+ */
+struct MigrationStep {
+	/// First save version with the change.
+	uint16_t version = 0;
+	/// The change.
+	FormatChange change = FormatChange::Chunks;
+	/// What older files get when read.
+	std::string_view description{};
+	/// True if older files cannot be upgraded without losing or guessing data.
+	bool lossy = false;
+	/// Conversion of a round read in an older version, nullptr if nothing to convert.
+	void (*upgradeRound)(GameRound& ioRound, const LegacyRound& iLegacy) = nullptr;
+};
+
+/**
+ * @brief Get the changes of the event file format, from the oldest.
+ * @return All the changes, the last one being the current save version.
+ */
+auto getMigrationSteps() -> std::span<const MigrationStep>;
+
+/**
+ * @brief Get the changes needed to upgrade a file to the current save version.
+ * @param iVersion Save version of the file.
+ * @return The changes, empty if the file is current (or newer).
+ */
+auto getMigrationSteps(uint16_t iVersion) -> std::span<const MigrationStep>;
+
+/**
+ * @brief Check if the files of a save version have a change of the format.
+ * @param iVersion Save version of the file.
+ * @param iChange The change.
+ * @return True if the file is in the format of the change or a later one.
+ */
+auto hasFormatChange(uint16_t iVersion, FormatChange iChange) -> bool;
+
+/**
+ * @brief Convert a round read in an old version: runs the round upgrades of the steps after the version.
+ * @param ioRound The round.
+ * @param iLegacy What the reader kept of the old format.
+ * @param iVersion Save version of the file.
+ */
+void upgradeRound(GameRound& ioRound, const LegacyRound& iLegacy, uint16_t iVersion);
+
+/**
+ * @brief Result of the migration of a file.
+ */
+struct MigrationResult {
+	/// Outcome of a migration.
+	enum struct Outcome : uint8_t {
+		Current,///< Already in the current version and valid.
+		Outdated,///< Valid but in an older version, left untouched (check only).
+		Upgraded,///< Rewritten in the current version.
+		Unsupported,///< Unknown save version.
+		Unreadable,///< The file cannot be read.
+		Corrupted,///< The content cannot be decoded or does not survive a rewrite.
+		WriteFailed,///< The upgraded file cannot be written.
+	};
+	/// The file.
+	std::filesystem::path file;
+	/// Save version of the file.
+	uint16_t version = 0;
+	/// The outcome.
+	Outcome outcome = Outcome::Unreadable;
+	/// True if the upgrade lost or guessed data.
+	bool lossy = false;
+
+	/**
+	 * @brief Check if the file is in error.
+	 * @return True if the file is unsupported, unreadable, corrupted or could not be written.
+	 */
+	[[nodiscard]] auto failed() const -> bool { return outcome >= Outcome::Unsupported; }
+};
+
+/**
+ * @brief Results of the migration of a directory.
+ */
+struct MigrationReport {
+	/// Results of the files, sorted by path.
+	std::vector<MigrationResult> files;
+
+	/**
+	 * @brief Count the files with an outcome.
+	 * @param iOutcome The outcome.
+	 * @return The number of files.
+	 */
+	[[nodiscard]] auto count(MigrationResult::Outcome iOutcome) const -> size_t;
+	/**
+	 * @brief Count the files in error.
+	 * @return The number of files.
+	 */
+	[[nodiscard]] auto failed() const -> size_t;
+};
+
+/**
+ * @brief Class Migrator: upgrade or check the event files (.lev) of a directory tree.
+ *
+ * A file is decoded whatever its version through the steps, then written in the current version and decoded
+ * again: the file is valid only if both writes are identical. The card packs are not loaded. Upgraded files are written as the saves: synced to the disk then
+ * renamed over the old ones, the old content being kept in a backup file. The files are processed in parallel on
+ * a thread pool.
+ */
+class Migrator {
+public:
+	/// Options of a migration.
+	struct Options {
+		/// Only check the files, write nothing.
+		bool checkOnly = false;
+		/// Keep the old content of the upgraded files (file.lev.bak).
+		bool backup = true;
+		/// Number of threads (0 for the number of hardware threads).
+		size_t threads = 0;
+	};
+	/// Extension of the backup files.
+	static constexpr std::string_view g_backupExtension = ".bak";
+
+	/**
+	 * @brief Constructor.
+	 * @param iOptions The options.
+	 */
+	explicit Migrator(const Options& iOptions);
+
+	/**
+	 * @brief Migrate a file.
+	 * @param iFile The file.
+	 * @return The result.
+	 */
+	[[nodiscard]] auto migrateFile(const std::filesystem::path& iFile) const -> MigrationResult;
+
+	/**
+	 * @brief Migrate all the event files of a directory and its subdirectories.
+	 * @param iDirectory The directory.
+	 * @return The results.
+	 */
+	[[nodiscard]] auto migrate(const std::filesystem::path& iDirectory) const -> MigrationReport;
+
+private:
+	/// The options.
+	Options m_options;
+};
+
+}// namespace evl::core
@@ -0,0 +1,161 @@
+/**
+ * @file NumberMask.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#pragma once
+
+#include <bit>
+#include <cstdint>
+
+namespace evl::core {
+
+/**
+ * @brief Set of loto numbers (1 to 90) packed in two 64-bit words.
+ *
+ * Number n is stored at bit (n - 1): numbers 1 to 64 live in the low word, 65 to 90 in the high word.
+ */
+class NumberMask {
+public:
+	/// Highest number of the loto.
+	static constexpr uint8_t g_maxNumber = 90;
+
+	constexpr NumberMask() = default;
+	/**
+	 * @brief Constructor from raw words.
+	 * @param iLow Bits for numbers 1 to 64.
+	 * @param iHigh Bits for numbers 65 to 90.
+	 */
+	constexpr NumberMask(const uint64_t iLow, const uint64_t iHigh) : m_low{iLow}, m_high{iHigh} {}
+
+	/**
+	 * @brief Check if a number is in the valid range.
+	 * @param iNumber The number to check.
+	 * @return True if the number is between 1 and 90.
+	 */
+	[[nodiscard]] static constexpr auto isValid(const uint8_t iNumber) -> bool {
+		return iNumber > 0 && iNumber <= g_maxNumber;
+	}
+
+	/**
+	 * @brief Add a number to the set.
+	 * @param iNumber The number to add (ignored if out of range).
+	 */
+	constexpr void set(const uint8_t iNumber) {
+		if (!isValid(iNumber))
+			return;
+		if (iNumber <= 64)
+			m_low |= bit(iNumber);
+		else
+			m_high |= bit(iNumber);
+	}
+
+	/**
+	 * @brief Remove a number from the set.
+	 * @param iNumber The number to remove (ignored if out of range).
+	 */
+	constexpr void reset(const uint8_t iNumber) {
+		if (!isValid(iNumber))
+			return;
+		if (iNumber <= 64)
+			m_low &= ~bit(iNumber);
+		else
+			m_high &= ~bit(iNumber);
+	}
+
+	/**
+	 * @brief Check if a number is in the set.
+	 * @param iNumber The number to check.
+	 * @return True if the number is present.
+	 */
+	[[nodiscard]] constexpr auto test(const uint8_t iNumber) const -> bool {
+		if (!isValid(iNumber))
+			return false;
+		if (iNumber <= 64)
+			return (m_low & bit(iNumber)) != 0;
+		return (m_high & bit(iNumber)) != 0;
+	}
+
+	/**
+	 * @brief Remove all numbers.
+	 */
+	constexpr void clear() {
+		m_low = 0;
+		m_high = 0;
+	}
+
+	/**
+	 * @brief Count the numbers in the set.
+	 * @return The number of elements.
+	 */
+	[[nodiscard]] constexpr auto count() const -> uint8_t {
+		return static_cast<uint8_t>(std::popcount(m_low) + std::popcount(m_high));
+	}
+
+	/**
+	 * @brief Check if the set is empty.
+	 * @return True if no number is set.
+	 */
+	[[nodiscard]] constexpr auto empty() const -> bool { return (m_low | m_high) == 0; }
+
+	/**
+	 * @brief Check if all the numbers of this set are in another.
+	 * @param iOther The other set.
+	 * @return True if this is a subset of iOther.
+	 */
+	[[nodiscard]] constexpr auto isSubsetOf(const NumberMask& iOther) const -> bool {
+		return ((m_low & ~iOther.m_low) | (m_high & ~iOther.m_high)) == 0;
+	}
+
+	/**
+	 * @brief Access to the low word.
+	 * @return Bits for numbers 1 to 64.
+	 */
+	[[nodiscard]] constexpr auto low() const -> uint64_t { return m_low; }
+	/**
+	 * @brief Access to the high word.
+	 * @return Bits for numbers 65 to 90.
+	 */
+	[[nodiscard]] constexpr auto high() const -> uint64_t { return m_high; }
+
+	/**
+	 * @brief Intersection of two sets.
+	 * @param iOther The other set.
+	 * @return The intersection.
+	 */
+	[[nodiscard]] constexpr auto operator&(const NumberMask& iOther) const -> NumberMask {
+		return {m_low & iOther.m_low, m_high & iOther.m_high};
+	}
+	/**
+	 * @brief Union of two sets.
+	 * @param iOther The other set.
+	 * @return The union.
+	 */
+	[[nodiscard]] constexpr auto operator|(const NumberMask& iOther) const -> NumberMask {
+		return {m_low | iOther.m_low, m_high | iOther.m_high};
+	}
+	/**
+	 * @brief Comparison operator.
+	 * @param iOther The other set.
+	 * @return True if both sets are equal.
+	 */
+	[[nodiscard]] constexpr auto operator==(const NumberMask& iOther) const -> bool = default;
+
+private:
+	/**
+	 * @brief Bit of a number inside its word.
+	 * @param iNumber The number.
+	 * @return The bit mask.
+	 */
+	[[nodiscard]] static constexpr auto bit(const uint8_t iNumber) -> uint64_t {
+		return uint64_t{1} << ((iNumber - 1U) & 63U);
+	}
+	/// Numbers 1 to 64.
+	uint64_t m_low = 0;
+	/// Numbers 65 to 90.
+	uint64_t m_high = 0;
+};
+
+}// namespace evl::core
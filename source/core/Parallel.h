@@ -0,0 +1,48 @@
+/**
+ * @file Parallel.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#pragma once
+
+#include <algorithm>
+#include <thread>
+#include <vector>
+
+namespace evl::core {
+
+/**
+ * @brief Compute the number of chunks to split a range for parallel processing.
+ * @param iCount Number of elements.
+ * @param iMinChunk Minimal number of elements per chunk.
+ * @return The number of chunks (at least 1).
+ */
+inline auto chunkCount(const size_t iCount, const size_t iMinChunk) -> size_t {
+	const size_t threads = std::max<size_t>(1, std::thread::hardware_concurrency());
+	return std::clamp<size_t>(iCount / std::max<size_t>(1, iMinChunk), 1, threads);
+}
+
+/**
+ * @brief Process contiguous chunks of a range, one thread per chunk.
+ *
+ * The chunk boundaries only depend on the element and chunk counts so the work done by each chunk is
+ * deterministic. The first chunk runs on the calling thread.
+ * @tparam Func Callable with signature (chunk index, first element, end element).
+ * @param iCount Number of elements.
+ * @param iChunks Number of chunks.
+ * @param iFunc The function to call for each chunk.
+ */
+template<typename Func>
+void parallelChunks(const size_t iCount, const size_t iChunks, const Func& iFunc) {
+	const size_t chunks = std::max<size_t>(1, iChunks);
+	const auto bound = [&](const size_t iChunk) -> size_t { return iCount * iChunk / chunks; };
+	std::vector<std::jthread> workers;
+	workers.reserve(chunks - 1);
+	for (size_t chunk = 1; chunk < chunks; ++chunk)
+		workers.emplace_back([&iFunc, chunk, begin = bound(chunk), end = bound(chunk + 1)] { iFunc(chunk, begin, end); });
+	iFunc(size_t{0}, size_t{0}, bound(1));
+}
+
+}// namespace evl::core
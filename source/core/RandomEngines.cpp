@@ -0,0 +1,53 @@
+/**
+ * @file RandomEngines.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "RandomEngines.h"
+
+namespace evl::core {
+
+namespace {
+/// Number of double rounds of ChaCha20.
+constexpr int g_doubleRounds = 10;
+
+constexpr void quarterRound(std::array<uint32_t, 16>& ioState, const size_t iA, const size_t iB, const size_t iC,
+							const size_t iD) {
+	ioState[iA] += ioState[iB];
+	ioState[iD] = std::rotl(ioState[iD] ^ ioState[iA], 16);
+	ioState[iC] += ioState[iD];
+	ioState[iB] = std::rotl(ioState[iB] ^ ioState[iC], 12);
+	ioState[iA] += ioState[iB];
+	ioState[iD] = std::rotl(ioState[iD] ^ ioState[iA], 8);
+	ioState[iC] += ioState[iD];
+	ioState[iB] = std::rotl(ioState[iB] ^ ioState[iC], 7);
+}
+}// namespace
+
+void ChaCha20::refill() {
+	// "expand 32-byte k", key, 64-bit block counter, null nonce
+	std::array<uint32_t, 16> input{0x61707865, 0x3320646E, 0x79622D32, 0x6B206574};
+	std::ranges::copy(m_key, input.begin() + 4);
+	input[12] = static_cast<uint32_t>(m_counter);
+	input[13] = static_cast<uint32_t>(m_counter >> 32U);
+	++m_counter;
+	m_block = input;
+	for (int round = 0; round < g_doubleRounds; ++round) {
+		quarterRound(m_block, 0, 4, 8, 12);
+		quarterRound(m_block, 1, 5, 9, 13);
+		quarterRound(m_block, 2, 6, 10, 14);
+		quarterRound(m_block, 3, 7, 11, 15);
+		quarterRound(m_block, 0, 5, 10, 15);
+		quarterRound(m_block, 1, 6, 11, 12);
+		quarterRound(m_block, 2, 7, 8, 13);
+		quarterRound(m_block, 3, 4, 9, 14);
+	}
+	for (size_t i = 0; i < m_block.size(); ++i) m_block[i] += input[i];
+	m_index = 0;
+}
+
+}// namespace evl::core
@@ -0,0 +1,197 @@
+/**
+ * @file RandomEngines.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#pragma once
+
+#include <array>
+#include <bit>
+#include <cstdint>
+#include <limits>
+
+namespace evl::core {
+
+/// Seed material of the engines (256 bits).
+using seed_key = std::array<uint32_t, 8>;
+
+/**
+ * @brief SplitMix64 step.
+ * @param ioState The generator state.
+ * @return The next random value.
+ */
+constexpr auto splitMix64(uint64_t& ioState) -> uint64_t {
+	ioState += 0x9E3779B97F4A7C15ULL;
+	uint64_t z = ioState;
+	z = (z ^ (z >> 30U)) * 0xBF58476D1CE4E5B9ULL;
+	z = (z ^ (z >> 27U)) * 0x94D049BB133111EBULL;
+	return z ^ (z >> 31U);
+}
+
+/**
+ * @brief Expand a 64-bit seed into a full key.
+ * @param iSeed The seed.
+ * @return The key.
+ */
+constexpr auto expandSeed(uint64_t iSeed) -> seed_key {
+	seed_key key{};
+	for (size_t i = 0; i < key.size(); i += 2) {
+		const uint64_t value = splitMix64(iSeed);
+		key[i] = static_cast<uint32_t>(value);
+		key[i + 1] = static_cast<uint32_t>(value >> 32U);
+	}
+	return key;
+}
+
+/**
+ * @brief Draw a value in [0, iBound) without modulo bias (Lemire's multiply-shift with rejection).
+ * @tparam Engine Generator of 32-bit values.
+ * @param ioEngine The generator.
+ * @param iBound The exclusive upper bound (not 0).
+ * @return The random value.
+ */
+template<typename Engine>
+constexpr auto boundedRandom(Engine& ioEngine, const uint32_t iBound) -> uint32_t {
+	uint64_t product = static_cast<uint64_t>(ioEngine()) * iBound;
+	if (auto low = static_cast<uint32_t>(product); low < iBound) {
+		const uint32_t threshold = (0U - iBound) % iBound;
+		while (low < threshold) {
+			product = static_cast<uint64_t>(ioEngine()) * iBound;
+			low = static_cast<uint32_t>(product);
+		}
+	}
+	return static_cast<uint32_t>(product >> 32U);
+}
+
+/**
+ * @brief Class Pcg32: PCG XSH-RR 64/32 generator, small and fast.
+ */
+class Pcg32 {
+public:
+	/// Type of the generated values.
+	using result_type = uint32_t;
+	static constexpr auto min() -> result_type { return 0; }
+	static constexpr auto max() -> result_type { return std::numeric_limits<result_type>::max(); }
+
+	/**
+	 * @brief Initialize the state (first 64 bits) and the stream (next 64 bits).
+	 * @param iKey The seed material.
+	 */
+	constexpr void seed(const seed_key& iKey) {
+		m_state = 0;
+		m_increment = ((static_cast<uint64_t>(iKey[3]) << 32U | iKey[2]) << 1U) | 1U;
+		(void) operator()();
+		m_state += static_cast<uint64_t>(iKey[1]) << 32U | iKey[0];
+		(void) operator()();
+	}
+
+	/**
+	 * @brief Generate the next value.
+	 * @return The value.
+	 */
+	constexpr auto operator()() -> result_type {
+		const uint64_t old = m_state;
+		m_state = old * 6364136223846793005ULL + m_increment;
+		const auto xorShifted = static_cast<uint32_t>(((old >> 18U) ^ old) >> 27U);
+		return std::rotr(xorShifted, static_cast<int>(old >> 59U));
+	}
+
+private:
+	/// Current state.
+	uint64_t m_state = 0x853C49E6748FEA9BULL;
+	/// Stream selector (odd).
+	uint64_t m_increment = 0xDA3E39CB94B95BDBULL;
+};
+
+/**
+ * @brief Class Xoshiro128: xoshiro128** generator, fast with a 128-bit state.
+ */
+class Xoshiro128 {
+public:
+	/// Type of the generated values.
+	using result_type = uint32_t;
+	static constexpr auto min() -> result_type { return 0; }
+	static constexpr auto max() -> result_type { return std::numeric_limits<result_type>::max(); }
+
+	/**
+	 * @brief Initialize the state with the first 128 bits of the key (a null state is replaced).
+	 * @param iKey The seed material.
+	 */
+	constexpr void seed(const seed_key& iKey) {
+		for (size_t i = 0; i < m_state.size(); ++i) m_state[i] = iKey[i];
+		if ((m_state[0] | m_state[1] | m_state[2] | m_state[3]) == 0)
+			m_state[0] = 1;
+	}
+
+	/**
+	 * @brief Generate the next value.
+	 * @return The value.
+	 */
+	constexpr auto operator()() -> result_type {
+		const uint32_t result = std::rotl(m_state[1] * 5U, 7) * 9U;
+		const uint32_t shifted = m_state[1] << 9U;
+		m_state[2] ^= m_state[0];
+		m_state[3] ^= m_state[1];
+		m_state[1] ^= m_state[2];
+		m_state[0] ^= m_state[3];
+		m_state[2] ^= shifted;
+		m_state[3] = std::rotl(m_state[3], 11);
+		return result;
+	}
+
+private:
+	/// Current state.
+	std::array<uint32_t, 4> m_state{1, 2, 3, 4};
+};
+
+/**
+ * @brief Class ChaCha20: cryptographically secure generator from the ChaCha20 keystream.
+ *
+ * The 256-bit key is the seed; the output is the keystream of a null nonce, block by block.
+ */
+class ChaCha20 {
+public:
+	/// Type of the generated values.
+	using result_type = uint32_t;
+	static constexpr auto min() -> result_type { return 0; }
+	static constexpr auto max() -> result_type { return std::numeric_limits<result_type>::max(); }
+
+	/**
+	 * @brief Initialize the key and restart the keystream.
+	 * @param iKey The key.
+	 */
+	void seed(const seed_key& iKey) {
+		m_key = iKey;
+		m_counter = 0;
+		m_index = m_block.size();
+	}
+
+	/**
+	 * @brief Generate the next value.
+	 * @return The value.
+	 */
+	auto operator()() -> result_type {
+		if (m_index == m_block.size())
+			refill();
+		return m_block[m_index++];
+	}
+
+private:
+	/**
+	 * @brief Compute the next keystream block.
+	 */
+	void refill();
+
+	/// The key.
+	seed_key m_key{};
+	/// Index of the next block.
+	uint64_t m_counter = 0;
+	/// Current keystream block.
+	std::array<uint32_t, 16> m_block{};
+	/// Next word to output in the block.
+	size_t m_index = 16;
+};
+
+}// namespace evl::core
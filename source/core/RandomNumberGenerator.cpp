@@ -12,34 +12,65 @@
 
 namespace evl::core {
 
-RandomNumberGenerator::RandomNumberGenerator(const bool iDebug) {
+RandomNumberGenerator::RandomNumberGenerator(const bool iDebug, const Engine iEngine) {
+	for (uint8_t number = 1; number <= NumberMask::g_maxNumber; ++number) {
+		m_urn[number - 1] = number;
+		m_slot[number] = number - 1;
+	}
 	if (iDebug) {
-		//NOLINTBEGIN
-		std::srand(1234);
-		//NOLINTEND
-	} else
-		std::srand(static_cast<uint32_t>(std::chrono::steady_clock::now().time_since_epoch().count()));
+		m_key = expandSeed(1234);
+	} else {
+		std::random_device device;
+		for (auto& word: m_key) word = device();
+	}
+	setEngine(iEngine);
+}
+
+void RandomNumberGenerator::seed(const seed_key& iKey) {
+	m_key = iKey;
+	std::visit([this](auto& ioEngine) { ioEngine.seed(m_key); }, m_engine);
+}
+
+void RandomNumberGenerator::setEngine(const Engine iEngine) {
+	switch (iEngine) {
+		case Engine::Pcg:
+			m_engine.emplace<Pcg32>();
+			break;
+		case Engine::Xoshiro:
+			m_engine.emplace<Xoshiro128>();
+			break;
+		case Engine::ChaCha20:
+			m_engine.emplace<ChaCha20>();
+			break;
+	}
+	seed(m_key);
 }
 
 auto RandomNumberGenerator::addPick(const uint8_t& iNumber) -> bool {
-	if (std::ranges::find(m_alreadyPicked, iNumber) != m_alreadyPicked.end())
+	if (!NumberMask::isValid(iNumber) || m_slot[iNumber] < m_count)
 		return false;
-	m_alreadyPicked.push_back(iNumber);
+	take(m_slot[iNumber]);
 	return true;
 }
 
 auto RandomNumberGenerator::pick() -> uint8_t {
-	if (m_alreadyPicked.size() >= 90)
+	if (m_count >= NumberMask::g_maxNumber)
 		return 255;
-	auto n = static_cast<uint8_t>(std::rand() % 90 + 1);
-	while (std::ranges::find(m_alreadyPicked, n) != m_alreadyPicked.end()) n = static_cast<uint8_t>(std::rand() % 90 + 1);
-	m_alreadyPicked.push_back(n);
-	return n;
+	const auto remaining = static_cast<uint32_t>(NumberMask::g_maxNumber - m_count);
+	const uint32_t offset =
+			std::visit([remaining](auto& ioEngine) { return boundedRandom(ioEngine, remaining); }, m_engine);
+	return take(m_count + offset);
 }
 
-void RandomNumberGenerator::popNum() {
-	if (!m_alreadyPicked.empty())
-		m_alreadyPicked.pop_back();
+auto RandomNumberGenerator::take(const size_t iSlot) -> uint8_t {
+	const uint8_t number = m_urn[iSlot];
+	const uint8_t displaced = m_urn[m_count];
+	m_urn[iSlot] = displaced;
+	m_slot[displaced] = static_cast<uint8_t>(iSlot);
+	m_urn[m_count] = number;
+	m_slot[number] = static_cast<uint8_t>(m_count);
+	++m_count;
+	return number;
 }
 
 }// namespace evl::core
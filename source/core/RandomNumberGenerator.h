@@ -7,8 +7,13 @@
  */
 #pragma once
 
+#include "NumberMask.h"
+#include "RandomEngines.h"
+
+#include <array>
 #include <cstdint>
-#include <vector>
+#include <span>
+#include <variant>
 
 /**
  * @brief Namespace pour les fonctions centrales du programme.
@@ -17,19 +22,57 @@ namespace evl::core {
 
 /**
  * @brief Class permettant de tirer aléatoirement des nombres entre 1 et 90 (inclus).
+ *
+ * Les numéros sont dans une urne de 90 cases : les numéros tirés occupent le début de l’urne, un tirage
+ * échange une case restante choisie au hasard avec la première case libre (Fisher–Yates partiel). Tirer,
+ * ajouter ou retirer un numéro est en O(1). L’état du générateur est propre à l’instance.
  */
 class RandomNumberGenerator {
 public:
+	/**
+	 * @brief Liste des générateurs disponibles.
+	 */
+	enum struct Engine : uint8_t {
+		Pcg,///< PCG32, rapide.
+		Xoshiro,///< xoshiro128**, rapide.
+		ChaCha20,///< Flux ChaCha20, cryptographiquement sûr.
+	};
+
 	/**
 	 * @brief Constructeur de base.
 	 * @param iDebug Si mis à vrai, utilise une seed déterministe.
+	 * @param iEngine Le générateur à utiliser.
+	 */
+	explicit RandomNumberGenerator(bool iDebug = false, Engine iEngine = Engine::Pcg);
+
+	/**
+	 * @brief Réinitialise le générateur avec une graine donnée (tirages reproductibles).
+	 * @param iSeed La graine.
+	 */
+	void seed(const uint64_t iSeed) { seed(expandSeed(iSeed)); }
+
+	/**
+	 * @brief Réinitialise le générateur avec une clé complète.
+	 * @param iKey La clé.
 	 */
-	explicit RandomNumberGenerator(bool iDebug = false);
+	void seed(const seed_key& iKey);
+
+	/**
+	 * @brief Change de générateur, initialisé avec la dernière clé.
+	 * @param iEngine Le nouveau générateur.
+	 */
+	void setEngine(Engine iEngine);
+
+	/**
+	 * @brief Renvoie le générateur utilisé.
+	 * @return Le générateur.
+	 */
+	[[nodiscard]] auto getEngine() const -> Engine { return static_cast<Engine>(m_engine.index()); }
 
 	/**
 	 * @brief Remet à zéro la liste des numéros déjà tiré.
 	 */
-	void resetPick() { m_alreadyPicked.clear(); }
+	void resetPick() { m_count = 0; }
 
 	/**
 	 * @brief Ajoute manuellement un numéro à la liste des numéros déjà tirés.
@@ -48,16 +91,34 @@ public:
 	 * @brief Renvoie la liste des numéros tirés.
 	 * @return La liste des numéros tirés.
 	 */
-	[[nodiscard]] auto getPicked() const -> const std::vector<uint8_t>& { return m_alreadyPicked; }
+	[[nodiscard]] auto getPicked() const -> std::span<const uint8_t> { return {m_urn.data(), m_count}; }
 
 	/**
 	 * @brief Retire le dernier numéro tiré de la liste.
 	 */
-	void popNum();
+	void popNum() {
+		if (m_count > 0)
+			--m_count;
+	}
 
 private:
-	/// Liste des numéros déjà tirer.
-	std::vector<uint8_t> m_alreadyPicked;
+	/**
+	 * @brief Place un numéro à la première case libre de l’urne.
+	 * @param iSlot La case du numéro.
+	 * @return Le numéro.
+	 */
+	auto take(size_t iSlot) -> uint8_t;
+
+	/// L’urne : les m_count premières cases sont les numéros tirés, dans l’ordre.
+	std::array<uint8_t, NumberMask::g_maxNumber> m_urn{};
+	/// Case de chaque numéro dans l’urne.
+	std::array<uint8_t, NumberMask::g_maxNumber + 1> m_slot{};
+	/// Nombre de numéros tirés.
+	size_t m_count = 0;
+	/// La dernière clé du générateur.
+	seed_key m_key{};
+	/// Le générateur propre à l’instance (utilisable en parallèle avec d’autres instances).
+	std::variant<Pcg32, Xoshiro128, ChaCha20> m_engine;
 };
 
 }// namespace evl::core
@@ -0,0 +1,353 @@
+/**
+ * @file SeasonAggregator.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "SeasonAggregator.h"
+
+#include "BinaryIO.h"
+#include "Forecast.h"
+#include "Log.h"
+#include "Parallel.h"
+#include "utilities.h"
+
+namespace evl::core {
+
+using namespace binary;
+
+namespace {
+/// Magic bytes at the start of an index.
+constexpr std::string_view g_magic = "EVLSEASN";
+/// Size of the index header: magic, version, summary size, entry count.
+constexpr size_t g_headerSize = g_magic.size() + sizeof(uint16_t) + 2 * sizeof(uint32_t);
+/// Size of a stored duration summary: count, total, shortest, longest.
+constexpr size_t g_durationSize = sizeof(uint32_t) + 3 * sizeof(uint64_t);
+/// Size of a stored draw summary: count, total, least, most.
+constexpr size_t g_drawSize = 3 * sizeof(uint32_t) + sizeof(uint64_t);
+/// Size of a stored event summary: picks, draws to win, round and sub-round durations, round draws.
+constexpr size_t g_summarySize =
+		std::tuple_size_v<decltype(EventSummary::picks)> * sizeof(uint32_t) + (Forecast::g_kinds + 1) * g_drawSize +
+		2 * g_durationSize;
+/// Size of an entry without its name: name length, mtime, size, hash, valid, summary.
+constexpr size_t g_entrySize = sizeof(uint16_t) + 3 * sizeof(uint64_t) + 1 + g_summarySize;
+/// Extension of the event files.
+constexpr std::string_view g_extension = ".lev";
+
+void putDuration(std::vector<char>& oBuffer, const DurationSummary& iSummary) {
+	putLittleEndian(oBuffer, iSummary.count);
+	putLittleEndian(oBuffer, std::bit_cast<uint64_t>(iSummary.total));
+	putLittleEndian(oBuffer, std::bit_cast<uint64_t>(iSummary.shortest));
+	putLittleEndian(oBuffer, std::bit_cast<uint64_t>(iSummary.longest));
+}
+
+auto getDuration(const std::span<const uint8_t> iData, const size_t iOffset) -> DurationSummary {
+	return {.count = getLittleEndian<uint32_t>(iData, iOffset),
+			.total = std::bit_cast<double>(getLittleEndian<uint64_t>(iData, iOffset + 4)),
+			.shortest = std::bit_cast<double>(getLittleEndian<uint64_t>(iData, iOffset + 12)),
+			.longest = std::bit_cast<double>(getLittleEndian<uint64_t>(iData, iOffset + 20))};
+}
+
+void putDraws(std::vector<char>& oBuffer, const DrawSummary& iSummary) {
+	putLittleEndian(oBuffer, iSummary.count);
+	putLittleEndian(oBuffer, iSummary.total);
+	putLittleEndian(oBuffer, iSummary.least);
+	putLittleEndian(oBuffer, iSummary.most);
+}
+
+auto getDraws(const std::span<const uint8_t> iData, const size_t iOffset) -> DrawSummary {
+	return {.count = getLittleEndian<uint32_t>(iData, iOffset),
+			.total = getLittleEndian<uint64_t>(iData, iOffset + 4),
+			.least = getLittleEndian<uint32_t>(iData, iOffset + 12),
+			.most = getLittleEndian<uint32_t>(iData, iOffset + 16)};
+}
+
+/**
+ * @brief Append a summary, field by field in little-endian (g_summarySize bytes).
+ * @param oBuffer The buffer.
+ * @param iSummary The summary.
+ */
+void putSummary(std::vector<char>& oBuffer, const EventSummary& iSummary) {
+	for (const auto pick: iSummary.picks) putLittleEndian(oBuffer, pick);
+	for (const auto& draws: iSummary.drawsToWin) putDraws(oBuffer, draws);
+	putDuration(oBuffer, iSummary.rounds);
+	putDuration(oBuffer, iSummary.subRounds);
+	putDraws(oBuffer, iSummary.roundDraws);
+}
+
+/**
+ * @brief Read a summary written by putSummary (bounds checked by the caller).
+ * @param iData The data.
+ * @param iOffset Offset of the summary.
+ * @return The summary.
+ */
+auto getSummary(const std::span<const uint8_t> iData, size_t iOffset) -> EventSummary {
+	EventSummary summary;
+	for (auto& pick: summary.picks) {
+		pick = getLittleEndian<uint32_t>(iData, iOffset);
+		iOffset += sizeof(uint32_t);
+	}
+	for (auto& draws: summary.drawsToWin) {
+		draws = getDraws(iData, iOffset);
+		iOffset += g_drawSize;
+	}
+	summary.rounds = getDuration(iData, iOffset);
+	summary.subRounds = getDuration(iData, iOffset + g_durationSize);
+	summary.roundDraws = getDraws(iData, iOffset + 2 * g_durationSize);
+	return summary;
+}
+
+auto pickList(const std::array<uint32_t, 90>& iPicks, const bool iMost) -> Statistics::pick_list {
+	const auto target = iMost ? std::ranges::max(iPicks) : std::ranges::min(iPicks);
+	Statistics::pick_list list;
+	for (size_t i = 0; i < iPicks.size(); ++i)
+		if (iPicks[i] == target)
+			list.push_back(static_cast<uint8_t>(i + 1));
+	return list;
+}
+
+/// A file to examine during a scan.
+struct Candidate {
+	/// Name of the file in the directory.
+	std::string name;
+	/// Modification time.
+	int64_t mtime = 0;
+	/// File size.
+	uint64_t size = 0;
+	/// True if the index entry is still up to date.
+	bool cached = false;
+};
+}// namespace
+
+void DurationSummary::add(const duration& iDuration) {
+	const double seconds = iDuration.count();
+	if (count == 0 || seconds < shortest)
+		shortest = seconds;
+	if (count == 0 || seconds > longest)
+		longest = seconds;
+	total += seconds;
+	++count;
+}
+
+void DurationSummary::merge(const DurationSummary& iOther) {
+	if (iOther.count == 0)
+		return;
+	if (count == 0 || iOther.shortest < shortest)
+		shortest = iOther.shortest;
+	if (count == 0 || iOther.longest > longest)
+		longest = iOther.longest;
+	total += iOther.total;
+	count += iOther.count;
+}
+
+void DrawSummary::add(const uint32_t iDraws) {
+	if (count == 0 || iDraws < least)
+		least = iDraws;
+	if (count == 0 || iDraws > most)
+		most = iDraws;
+	total += iDraws;
+	++count;
+}
+
+void DrawSummary::merge(const DrawSummary& iOther) {
+	if (iOther.count == 0)
+		return;
+	if (count == 0 || iOther.least < least)
+		least = iOther.least;
+	if (count == 0 || iOther.most > most)
+		most = iOther.most;
+	total += iOther.total;
+	count += iOther.count;
+}
+
+auto EventSummary::fromEvent(const Event& iEvent) -> EventSummary {
+	EventSummary summary;
+	for (auto round = iEvent.beginRounds(); round != iEvent.endRounds(); ++round) {
+		if (round->getType() == GameRound::Type::Pause)
+			continue;
+		if (round->getStatus() == GameRound::Status::Ready)
+			break;
+		if (round->getType() == GameRound::Type::Enfant)
+			continue;
+		if (round->isFinished()) {
+			summary.rounds.add(round->getEnding() - round->getStarting());
+			summary.roundDraws.add(static_cast<uint32_t>(round->drawsCount()));
+		}
+		for (auto sub = round->beginSubRound(); sub != round->endSubRound(); ++sub) {
+			if (!sub->isFinished())
+				break;
+			summary.subRounds.add(sub->getEnding() - sub->getStarting());
+			summary.drawsToWin[static_cast<size_t>(Forecast::kindOf(*round, *sub))].add(
+					static_cast<uint32_t>(sub->getDraws().size()));
+		}
+		for (const auto draw: round->getDrawLog().draws())
+			if (draw > 0 && draw <= summary.picks.size())
+				++summary.picks[draw - 1];
+	}
+	return summary;
+}
+
+void EventSummary::merge(const EventSummary& iOther) {
+	for (size_t i = 0; i < picks.size(); ++i) picks[i] += iOther.picks[i];
+	for (size_t i = 0; i < drawsToWin.size(); ++i) drawsToWin[i].merge(iOther.drawsToWin[i]);
+	rounds.merge(iOther.rounds);
+	subRounds.merge(iOther.subRounds);
+	roundDraws.merge(iOther.roundDraws);
+}
+
+auto EventSummary::leastPicked() const -> Statistics::pick_list { return pickList(picks, false); }
+
+auto EventSummary::mostPicked() const -> Statistics::pick_list { return pickList(picks, true); }
+
+SeasonAggregator::SeasonAggregator(std::filesystem::path iDirectory) : m_directory{std::move(iDirectory)} {}
+
+auto SeasonAggregator::scan() -> SeasonReport {
+	SeasonReport report;
+	loadIndex();
+	std::vector<Candidate> candidates;
+	std::error_code error;
+	for (const auto& item: std::filesystem::directory_iterator(m_directory, error)) {
+		if (!item.is_regular_file(error) || item.path().extension() != g_extension)
+			continue;
+		Candidate candidate;
+		candidate.name = item.path().filename().string();
+		candidate.mtime = static_cast<int64_t>(item.last_write_time(error).time_since_epoch().count());
+		candidate.size = static_cast<uint64_t>(item.file_size(error));
+		if (const auto entry = m_entries.find(candidate.name); entry != m_entries.end())
+			candidate.cached = entry->second.mtime == candidate.mtime && entry->second.size == candidate.size;
+		candidates.push_back(std::move(candidate));
+	}
+	if (error)
+		log_warn("Erreur lors du parcours de '{}': {}", m_directory.string(), error.message());
+	std::ranges::sort(candidates, {}, &Candidate::name);
+
+	// examine the new or touched files in parallel (a hash match avoids the decoding)
+	std::vector<Candidate*> pending;
+	for (auto& candidate: candidates)
+		if (!candidate.cached)
+			pending.push_back(&candidate);
+	std::vector<Entry> updated(pending.size());
+	std::vector<uint8_t> decoded(pending.size(), 0);
+	parallelChunks(pending.size(), chunkCount(pending.size(), 1),
+				   [&](const size_t, const size_t iBegin, const size_t iEnd) {
+					   for (size_t i = iBegin; i < iEnd; ++i) {
+						   Entry& entry = updated[i];
+						   entry.mtime = pending[i]->mtime;
+						   entry.size = pending[i]->size;
+						   std::string content;
+						   if (!readContent(m_directory / pending[i]->name, content))
+							   continue;
+						   entry.hash = contentHash(content);
+						   if (const auto old = m_entries.find(pending[i]->name);
+							   old != m_entries.end() && old->second.hash == entry.hash) {
+							   entry.valid = old->second.valid;
+							   entry.summary = old->second.summary;
+							   continue;
+						   }
+						   decoded[i] = 1;
+						   // Event::read silently ignores the streams of unknown versions
+						   uint16_t version = 0;
+						   std::memcpy(&version, content.data(), std::min(content.size(), sizeof(version)));
+						   if (version == 0 || version > getSaveVersion()) {
+							   log_warn("Version de '{}' inconnue: {}", pending[i]->name, version);
+							   continue;
+						   }
+						   try {
+							   std::istringstream stream(content, std::ios::in | std::ios::binary);
+							   Event event;
+							   event.read(stream, 0, Event::CardLoading::Skip);
+							   entry.valid = !stream.fail();
+							   if (entry.valid)
+								   entry.summary = EventSummary::fromEvent(event);
+						   } catch (const std::exception& except) {
+							   log_warn("Impossible de décoder '{}': {}", pending[i]->name, except.what());
+						   }
+					   }
+				   });
+
+	const bool changed = !pending.empty() || m_entries.size() != candidates.size();
+	std::map<std::string, Entry> entries;
+	for (size_t i = 0; i < pending.size(); ++i) {
+		entries.emplace(pending[i]->name, updated[i]);
+		report.decoded += decoded[i];
+	}
+	for (const auto& candidate: candidates)
+		if (candidate.cached)
+			entries.emplace(candidate.name, m_entries.at(candidate.name));
+	m_entries = std::move(entries);
+
+	for (const auto& [name, entry]: m_entries) {
+		if (!entry.valid) {
+			++report.failed;
+			continue;
+		}
+		++report.events;
+		report.total.merge(entry.summary);
+	}
+	if (changed)
+		saveIndex();
+	log_info("Saison '{}': {} événements, {} décodés, {} en échec", m_directory.string(), report.events,
+			 report.decoded, report.failed);
+	return report;
+}
+
+void SeasonAggregator::loadIndex() {
+	m_entries.clear();
+	std::string content;
+	if (!readContent(m_directory / g_indexName, content) || content.size() < g_headerSize)
+		return;
+	const std::span data(reinterpret_cast<const uint8_t*>(content.data()), content.size());
+	if (std::string_view(content).substr(0, g_magic.size()) != g_magic ||
+		getLittleEndian<uint16_t>(data, g_magic.size()) != g_version ||
+		getLittleEndian<uint32_t>(data, g_magic.size() + 2) != g_summarySize) {
+		log_warn("Index de saison '{}' incompatible, il sera reconstruit", m_directory.string());
+		return;
+	}
+	const auto count = getLittleEndian<uint32_t>(data, g_magic.size() + 6);
+	size_t offset = g_headerSize;
+	for (uint32_t i = 0; i < count; ++i) {
+		if (offset + sizeof(uint16_t) > data.size())
+			break;
+		const auto nameLength = getLittleEndian<uint16_t>(data, offset);
+		if (offset + g_entrySize + nameLength > data.size())
+			break;
+		offset += sizeof(uint16_t);
+		std::string name(content, offset, nameLength);
+		offset += nameLength;
+		Entry entry;
+		entry.mtime = getLittleEndian<int64_t>(data, offset);
+		entry.size = getLittleEndian<uint64_t>(data, offset + 8);
+		entry.hash = getLittleEndian<uint64_t>(data, offset + 16);
+		entry.valid = data[offset + 24] != 0;
+		offset += 25;
+		entry.summary = getSummary(data, offset);
+		offset += g_summarySize;
+		m_entries.emplace(std::move(name), entry);
+	}
+}
+
+void SeasonAggregator::saveIndex() const {
+	std::vector<char> buffer;
+	buffer.reserve(g_headerSize + m_entries.size() * (g_entrySize + 32));
+	buffer.insert(buffer.end(), g_magic.begin(), g_magic.end());
+	putLittleEndian(buffer, g_version);
+	putLittleEndian(buffer, static_cast<uint32_t>(g_summarySize));
+	putLittleEndian(buffer, static_cast<uint32_t>(m_entries.size()));
+	for (const auto& [name, entry]: m_entries) {
+		putLittleEndian(buffer, static_cast<uint16_t>(name.size()));
+		buffer.insert(buffer.end(), name.begin(), name.end());
+		putLittleEndian(buffer, entry.mtime);
+		putLittleEndian(buffer, entry.size);
+		putLittleEndian(buffer, entry.hash);
+		buffer.push_back(entry.valid ? 1 : 0);
+		putSummary(buffer, entry.summary);
+	}
+	// a crash while writing leaves the previous index, not a truncated one
+	if (!writeAtomic(m_directory / g_indexName, {buffer.data(), buffer.size()}))
+		log_warn("Impossible d'écrire l'index de saison de '{}'", m_directory.string());
+}
+
+}// namespace evl::core
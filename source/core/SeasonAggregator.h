@@ -0,0 +1,189 @@
+/**
+ * @file SeasonAggregator.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#pragma once
+
+#include "Event.h"
+
+#include <array>
+#include <filesystem>
+#include <map>
+
+namespace evl::core {
+
+/**
+ * @brief Summary of durations (in seconds).
+ */
+struct DurationSummary {
+	/// Number of samples.
+	uint32_t count = 0;
+	/// Sum of the durations.
+	double total = 0.0;
+	/// Shortest duration.
+	double shortest = 0.0;
+	/// Longest duration.
+	double longest = 0.0;
+
+	/**
+	 * @brief Add a duration.
+	 * @param iDuration The duration.
+	 */
+	void add(const duration& iDuration);
+	/**
+	 * @brief Add the samples of another summary.
+	 * @param iOther The other summary.
+	 */
+	void merge(const DurationSummary& iOther);
+	/**
+	 * @brief Get the mean duration.
+	 * @return The mean duration.
+	 */
+	[[nodiscard]] auto mean() const -> duration { return duration{count == 0 ? 0.0 : total / count}; }
+};
+
+/**
+ * @brief Summary of numbers of draws.
+ */
+struct DrawSummary {
+	/// Number of samples.
+	uint32_t count = 0;
+	/// Sum of the draws.
+	uint64_t total = 0;
+	/// Least draws.
+	uint32_t least = 0;
+	/// Most draws.
+	uint32_t most = 0;
+
+	/**
+	 * @brief Add a number of draws.
+	 * @param iDraws The number of draws.
+	 */
+	void add(uint32_t iDraws);
+	/**
+	 * @brief Add the samples of another summary.
+	 * @param iOther The other summary.
+	 */
+	void merge(const DrawSummary& iOther);
+	/**
+	 * @brief Get the mean number of draws.
+	 * @return The mean number of draws.
+	 */
+	[[nodiscard]] auto mean() const -> double {
+		return count == 0 ? 0.0 : static_cast<double>(total) / static_cast<double>(count);
+	}
+};
+
+/**
+ * @brief Statistics of one or many events, mergeable and stored field by field in the index.
+ *
+ * As in Event::getStats, pauses and child rounds are ignored and only the started rounds count.
+ */
+struct EventSummary {
+	/// Number of times each number has been drawn (index 0 for number 1).
+	std::array<uint32_t, 90> picks{};
+	/// Draws needed to find a winner, per kind of sub-round (see Forecast::kindOf).
+	std::array<DrawSummary, Forecast::g_kinds> drawsToWin{};
+	/// Durations of the finished rounds.
+	DurationSummary rounds;
+	/// Durations of the finished sub-rounds.
+	DurationSummary subRounds;
+	/// Draws of the finished rounds.
+	DrawSummary roundDraws;
+
+	/**
+	 * @brief Summarize an event.
+	 * @param iEvent The event.
+	 * @return The summary.
+	 */
+	static auto fromEvent(const Event& iEvent) -> EventSummary;
+	/**
+	 * @brief Add the statistics of another summary.
+	 * @param iOther The other summary.
+	 */
+	void merge(const EventSummary& iOther);
+	/**
+	 * @brief Get the least drawn numbers.
+	 * @return The numbers.
+	 */
+	[[nodiscard]] auto leastPicked() const -> Statistics::pick_list;
+	/**
+	 * @brief Get the most drawn numbers.
+	 * @return The numbers.
+	 */
+	[[nodiscard]] auto mostPicked() const -> Statistics::pick_list;
+};
+
+/**
+ * @brief Statistics of a season.
+ */
+struct SeasonReport {
+	/// Number of events.
+	size_t events = 0;
+	/// Number of files decoded by the last scan (the others came from the index).
+	size_t decoded = 0;
+	/// Number of files that could not be decoded.
+	size_t failed = 0;
+	/// Merged statistics.
+	EventSummary total;
+};
+
+/**
+ * @brief Class SeasonAggregator: statistics of all the events (.lev) of a directory.
+ *
+ * The summary of each file is cached in an index file in the directory, keyed by the file modification
+ * time and size, with a content hash as a fallback: a scan only decodes new or modified files, in parallel.
+ */
+class SeasonAggregator {
+public:
+	/// Name of the index file.
+	static constexpr std::string_view g_indexName = ".season.evi";
+	/// Current version of the index format.
+	static constexpr uint16_t g_version = 2;
+
+	/**
+	 * @brief Constructor.
+	 * @param iDirectory The directory of the events.
+	 */
+	explicit SeasonAggregator(std::filesystem::path iDirectory);
+
+	/**
+	 * @brief Scan the directory, decode the new files and update the index.
+	 * @return The statistics of the season.
+	 */
+	auto scan() -> SeasonReport;
+
+private:
+	/// Cached summary of a file.
+	struct Entry {
+		/// Modification time of the file.
+		int64_t mtime = 0;
+		/// Size of the file.
+		uint64_t size = 0;
+		/// Hash of the content.
+		uint64_t hash = 0;
+		/// True if the file could be decoded.
+		bool valid = false;
+		/// The summary.
+		EventSummary summary;
+	};
+
+	/**
+	 * @brief Read the index file.
+	 */
+	void loadIndex();
+	/**
+	 * @brief Write the index file.
+	 */
+	void saveIndex() const;
+
+	/// The directory.
+	std::filesystem::path m_directory;
+	/// Summaries by file name.
+	std::map<std::string, Entry> m_entries;
+};
+
+}// namespace evl::core
@@ -0,0 +1,204 @@
+/**
+ * @file SeasonArchive.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "SeasonArchive.h"
+
+#include "BinaryIO.h"
+#include "EventFile.h"
+#include "Log.h"
+
+namespace evl::core {
+
+using namespace binary;
+
+namespace {
+/// Magic bytes at the start of an archive.
+constexpr std::string_view g_magic = "EVLARCHV";
+/// Size of the header: magic, version, reserved, event count, index offset and size.
+constexpr size_t g_headerSize = g_magic.size() + 2 * sizeof(uint16_t) + sizeof(uint32_t) + 2 * sizeof(uint64_t);
+/// Size of an index entry without its strings: offset, size, hash, dates, status, round count, string sizes.
+constexpr size_t g_entrySize = 5 * sizeof(uint64_t) + 1 + 3 * sizeof(uint32_t);
+
+auto toNanoseconds(const time_point& iTime) -> int64_t {
+	return std::chrono::duration_cast<std::chrono::nanoseconds>(iTime.time_since_epoch()).count();
+}
+
+auto fromNanoseconds(const int64_t iTime) -> time_point {
+	return time_point{std::chrono::duration_cast<clock::duration>(std::chrono::nanoseconds{iTime})};
+}
+
+auto asBytes(const std::string_view iData) -> std::span<const uint8_t> {
+	return {reinterpret_cast<const uint8_t*>(iData.data()), iData.size()};
+}
+}// namespace
+
+// ---- SeasonArchive ----
+
+auto SeasonArchive::Header::fromEvent(const Event& iEvent) -> Header {
+	return {.name = iEvent.getName(),
+			.location = iEvent.getLocation(),
+			.start = iEvent.getStarting(),
+			.end = iEvent.getEnding(),
+			.status = iEvent.getStatus(),
+			.roundCount = static_cast<uint32_t>(iEvent.sizeRounds())};
+}
+
+SeasonArchive::SeasonArchive(const size_t iCacheSize) : m_cacheSize{std::max<size_t>(iCacheSize, 1)} {}
+
+auto SeasonArchive::open(const std::filesystem::path& iPath) -> bool {
+	close();
+	if (!m_file.open(iPath)) {
+		log_warn("Impossible d'ouvrir l'archive '{}'", iPath.string());
+		return false;
+	}
+	m_path = iPath;
+	if (!readIndex()) {
+		log_warn("Archive '{}' invalide", iPath.string());
+		close();
+		return false;
+	}
+	log_info("Archive '{}' ouverte: {} événements", iPath.string(), m_entries.size());
+	return true;
+}
+
+void SeasonArchive::close() {
+	m_cache.clear();
+	m_entries.clear();
+	m_file.close();
+	m_path.clear();
+	m_decodeCount = 0;
+}
+
+auto SeasonArchive::readIndex() -> bool {
+	const auto data = m_file.data();
+	if (data.size() < g_headerSize ||
+		std::string_view(reinterpret_cast<const char*>(data.data()), g_magic.size()) != g_magic)
+		return false;
+	size_t offset = g_magic.size();
+	const auto version = getLittleEndian<uint16_t>(data, offset);
+	if (version == 0 || version > g_version)
+		return false;
+	offset += 2 * sizeof(uint16_t);
+	const auto count = getLittleEndian<uint32_t>(data, offset);
+	offset += sizeof(uint32_t);
+	const auto indexOffset = getLittleEndian<uint64_t>(data, offset);
+	const auto indexSize = getLittleEndian<uint64_t>(data, offset + sizeof(uint64_t));
+	if (indexOffset < g_headerSize || indexOffset > data.size() || indexSize > data.size() - indexOffset ||
+		count > indexSize / g_entrySize)
+		return false;
+	// only the index is read: the data of the events stays untouched until asked for
+	const auto index = data.subspan(indexOffset, indexSize);
+	m_entries.resize(count);
+	offset = 0;
+	for (auto& entry: m_entries) {
+		if (index.size() - offset < g_entrySize)
+			return false;
+		entry.offset = getLittleEndian<uint64_t>(index, offset);
+		entry.size = getLittleEndian<uint64_t>(index, offset + 8);
+		entry.hash = getLittleEndian<uint64_t>(index, offset + 16);
+		entry.header.start = fromNanoseconds(getLittleEndian<int64_t>(index, offset + 24));
+		entry.header.end = fromNanoseconds(getLittleEndian<int64_t>(index, offset + 32));
+		entry.header.status = static_cast<Event::Status>(index[offset + 40]);
+		entry.header.roundCount = getLittleEndian<uint32_t>(index, offset + 41);
+		const auto nameSize = getLittleEndian<uint32_t>(index, offset + 45);
+		const auto locationSize = getLittleEndian<uint32_t>(index, offset + 49);
+		offset += g_entrySize;
+		if (entry.offset < g_headerSize || entry.offset > indexOffset || entry.size > indexOffset - entry.offset ||
+			index.size() - offset < uint64_t{nameSize} + locationSize)
+			return false;
+		entry.header.name.assign(reinterpret_cast<const char*>(index.data() + offset), nameSize);
+		offset += nameSize;
+		entry.header.location.assign(reinterpret_cast<const char*>(index.data() + offset), locationSize);
+		offset += locationSize;
+	}
+	return true;
+}
+
+auto SeasonArchive::getData(const size_t iIndex) const -> std::span<const uint8_t> {
+	const auto& entry = m_entries[iIndex];
+	return m_file.data().subspan(entry.offset, entry.size);
+}
+
+auto SeasonArchive::getEvent(const size_t iIndex) -> std::shared_ptr<const Event> {
+	if (iIndex >= m_entries.size())
+		return nullptr;
+	if (const auto cached = std::ranges::find(m_cache, iIndex, &decltype(m_cache)::value_type::first);
+		cached != m_cache.end()) {
+		m_cache.splice(m_cache.begin(), m_cache, cached);
+		return cached->second;
+	}
+	const auto data = getData(iIndex);
+	EventFileView view;
+	if (contentHash(data) != m_entries[iIndex].hash || !view.parse(data)) {
+		log_warn("Événement {} de l'archive '{}' corrompu", iIndex, m_path.string());
+		return nullptr;
+	}
+	auto event = std::make_shared<Event>();
+	event->setBasePath(m_path);
+	event->readChunks(view);
+	++m_decodeCount;
+	m_cache.emplace_front(iIndex, std::move(event));
+	if (m_cache.size() > m_cacheSize)
+		m_cache.pop_back();
+	return m_cache.front().second;
+}
+
+// ---- SeasonArchiveWriter ----
+
+void SeasonArchiveWriter::add(const Event& iEvent) {
+	std::ostringstream stream(std::ios::out | std::ios::binary);
+	iEvent.write(stream);
+	auto& item = m_items.emplace_back(SeasonArchive::Header::fromEvent(iEvent), std::move(stream).str());
+	item.hash = contentHash(asBytes(item.data));
+}
+
+void SeasonArchiveWriter::add(const SeasonArchive& iArchive, const size_t iIndex) {
+	const auto data = iArchive.getData(iIndex);
+	auto& item = m_items.emplace_back(iArchive.getHeader(iIndex),
+									  std::string(reinterpret_cast<const char*>(data.data()), data.size()));
+	item.hash = contentHash(data);
+}
+
+auto SeasonArchiveWriter::write(const std::filesystem::path& iPath) const -> bool {
+	std::vector<char> index;
+	uint64_t offset = g_headerSize;
+	for (const auto& item: m_items) {
+		putLittleEndian(index, offset);
+		putLittleEndian(index, static_cast<uint64_t>(item.data.size()));
+		putLittleEndian(index, item.hash);
+		putLittleEndian(index, toNanoseconds(item.header.start));
+		putLittleEndian(index, toNanoseconds(item.header.end));
+		putLittleEndian(index, static_cast<uint8_t>(item.header.status));
+		putLittleEndian(index, item.header.roundCount);
+		putLittleEndian(index, static_cast<uint32_t>(item.header.name.size()));
+		putLittleEndian(index, static_cast<uint32_t>(item.header.location.size()));
+		index.insert(index.end(), item.header.name.begin(), item.header.name.end());
+		index.insert(index.end(), item.header.location.begin(), item.header.location.end());
+		offset += item.data.size();
+	}
+	std::vector<char> header(g_magic.begin(), g_magic.end());
+	putLittleEndian(header, SeasonArchive::g_version);
+	putLittleEndian(header, uint16_t{0});
+	putLittleEndian(header, static_cast<uint32_t>(m_items.size()));
+	putLittleEndian(header, offset);
+	putLittleEndian(header, static_cast<uint64_t>(index.size()));
+
+	// the archive is replaced only once complete and on the disk
+	std::vector<std::string_view> parts{{header.data(), header.size()}};
+	for (const auto& item: m_items) parts.emplace_back(item.data);
+	parts.emplace_back(index.data(), index.size());
+	if (!writeAtomic(iPath, parts)) {
+		log_warn("Impossible d'écrire l'archive '{}'", iPath.string());
+		return false;
+	}
+	log_info("Archive '{}' écrite: {} événements", iPath.string(), m_items.size());
+	return true;
+}
+
+}// namespace evl::core
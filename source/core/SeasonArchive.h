@@ -0,0 +1,201 @@
+/**
+ * @file SeasonArchive.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#pragma once
+
+#include "Event.h"
+#include "MappedFile.h"
+
+#include <filesystem>
+#include <list>
+#include <memory>
+#include <vector>
+
+namespace evl::core {
+
+/**
+ * @brief Class SeasonArchive: many events packed in a single file, decoded on demand.
+ *
+ * The file starts with a header locating the index, written after the events. The index holds the header
+ * of each event (name, location, dates, status and number of rounds) and the position of its data, stored
+ * in the chunked event format. Opening an archive maps the file and reads only the index: an event is
+ * decoded when it is asked for, and the most recently asked events are kept decoded.
+ */
+class SeasonArchive {
+public:
+	/// Extension of the archive files.
+	static constexpr std::string_view g_extension = ".lsa";
+	/// Current version of the archive format.
+	static constexpr uint16_t g_version = 1;
+	/// Default number of decoded events kept.
+	static constexpr size_t g_defaultCacheSize = 8;
+
+	/// Header of an archived event.
+	struct Header {
+		/// Name of the event.
+		std::string name;
+		/// Location of the event.
+		std::string location;
+		/// Start date.
+		time_point start;
+		/// End date.
+		time_point end;
+		/// Status of the event.
+		Event::Status status = Event::Status::Invalid;
+		/// Number of rounds.
+		uint32_t roundCount = 0;
+
+		/**
+		 * @brief Get the header of an event.
+		 * @param iEvent The event.
+		 * @return The header.
+		 */
+		static auto fromEvent(const Event& iEvent) -> Header;
+	};
+
+	/**
+	 * @brief Constructor.
+	 * @param iCacheSize Number of decoded events kept.
+	 */
+	explicit SeasonArchive(size_t iCacheSize = g_defaultCacheSize);
+
+	/**
+	 * @brief Map an archive and read its index, closing the previous one.
+	 * @param iPath The archive.
+	 * @return False if the file cannot be mapped or is not a valid archive.
+	 */
+	auto open(const std::filesystem::path& iPath) -> bool;
+
+	/**
+	 * @brief Release the archive and the decoded events.
+	 */
+	void close();
+
+	/**
+	 * @brief Check if an archive is opened.
+	 * @return True if opened.
+	 */
+	[[nodiscard]] auto isOpen() const -> bool { return m_file.isOpen(); }
+
+	/**
+	 * @brief Get the path of the archive.
+	 * @return The path.
+	 */
+	[[nodiscard]] auto getPath() const -> const std::filesystem::path& { return m_path; }
+
+	/**
+	 * @brief Get the number of events.
+	 * @return The number of events.
+	 */
+	[[nodiscard]] auto size() const -> size_t { return m_entries.size(); }
+
+	/**
+	 * @brief Get the header of an event.
+	 * @param iIndex Index of the event.
+	 * @return The header.
+	 */
+	[[nodiscard]] auto getHeader(const size_t iIndex) const -> const Header& { return m_entries[iIndex].header; }
+
+	/**
+	 * @brief Get an event, decoded if it is not kept.
+	 * @param iIndex Index of the event.
+	 * @return The event, null if the index is out of range or the data is corrupted.
+	 */
+	auto getEvent(size_t iIndex) -> std::shared_ptr<const Event>;
+
+	/**
+	 * @brief Get the raw data of an event, in the chunked event format.
+	 * @param iIndex Index of the event.
+	 * @return The data.
+	 */
+	[[nodiscard]] auto getData(size_t iIndex) const -> std::span<const uint8_t>;
+
+	/**
+	 * @brief Get the number of events decoded since the opening.
+	 * @return The number of decodings.
+	 */
+	[[nodiscard]] auto getDecodeCount() const -> size_t { return m_decodeCount; }
+
+private:
+	/// An event of the index.
+	struct Entry {
+		/// The header.
+		Header header;
+		/// Offset of the data in the file.
+		uint64_t offset = 0;
+		/// Size of the data.
+		uint64_t size = 0;
+		/// Hash of the data.
+		uint64_t hash = 0;
+	};
+
+	/**
+	 * @brief Read the index.
+	 * @return False if the index is invalid.
+	 */
+	auto readIndex() -> bool;
+
+	/// The mapped archive.
+	MappedFile m_file;
+	/// Path of the archive.
+	std::filesystem::path m_path;
+	/// The index.
+	std::vector<Entry> m_entries;
+	/// The decoded events, most recently used first.
+	std::list<std::pair<size_t, std::shared_ptr<const Event>>> m_cache;
+	/// Number of decoded events kept.
+	size_t m_cacheSize;
+	/// Number of decodings.
+	size_t m_decodeCount = 0;
+};
+
+/**
+ * @brief Class SeasonArchiveWriter: builder of a season archive.
+ */
+class SeasonArchiveWriter {
+public:
+	/**
+	 * @brief Add an event.
+	 * @param iEvent The event.
+	 */
+	void add(const Event& iEvent);
+
+	/**
+	 * @brief Add an event of another archive, copied without decoding.
+	 * @param iArchive The archive.
+	 * @param iIndex Index of the event in the archive.
+	 */
+	void add(const SeasonArchive& iArchive, size_t iIndex);
+
+	/**
+	 * @brief Get the number of events.
+	 * @return The number of events.
+	 */
+	[[nodiscard]] auto size() const -> size_t { return m_items.size(); }
+
+	/**
+	 * @brief Write the archive, replacing the file only once complete and synced to the disk.
+	 * @param iPath The archive.
+	 * @return False if the file cannot be written.
+	 */
+	[[nodiscard]] auto write(const std::filesystem::path& iPath) const -> bool;
+
+private:
+	/// An event to write.
+	struct Item {
+		/// The header.
+		SeasonArchive::Header header;
+		/// The data.
+		std::string data;
+		/// Hash of the data.
+		uint64_t hash = 0;
+	};
+	/// The events.
+	std::vector<Item> m_items;
+};
+
+}// namespace evl::core
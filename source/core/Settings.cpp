@@ -20,188 +20,237 @@ Settings::Settings() = default;
 
 Settings::~Settings() = default;
 
-void Settings::fromFile(const std::filesystem::path& iPath) {
+void Settings::fromFile(const std::filesystem::path& iPath, const SettingsSchema& iSchema) {
+	YAML::Node root;
 	try {
-		const YAML::Node root = YAML::LoadFile(iPath.string());
-
-		std::function<void(const YAML::Node&, const std::string&)> flattenNode;
-		flattenNode = [&](const YAML::Node& iNode, const std::string& iPrefix) -> void {
-			if (iNode.IsMap()) {
-				for (const auto& pair: iNode) {
-					const std::string key = iPrefix.empty()
-													? pair.first.as<std::string>()
-													: std::format("{}/{}", iPrefix, pair.first.as<std::string>());
-					flattenNode(pair.second, key);
-				}
-			} else if (iNode.IsSequence()) {
-				// Handle vectors
-				if (const size_t size = iNode.size(); size >= 2 && size <= 4) {
-					try {
-						if (size == 2) {
-							m_data[iPrefix] = math::vec2{iNode[0].as<float>(), iNode[1].as<float>()};
-						} else if (size == 3) {
-							m_data[iPrefix] =
-									math::vec3{iNode[0].as<float>(), iNode[1].as<float>(), iNode[2].as<float>()};
-						} else if (size == 4) {
-							m_data[iPrefix] = math::vec4{iNode[0].as<float>(), iNode[1].as<float>(),
-														 iNode[2].as<float>(), iNode[3].as<float>()};
-						}
-					} catch (...) { log_warn("Failed to parse vector at key '{}'", iPrefix); }
-				}
-			} else if (iNode.IsScalar()) {
-				try {
-					m_data[iPrefix] = iNode.as<bool>();
-				} catch (...) {
-					try {
-						m_data[iPrefix] = iNode.as<int>();
-					} catch (...) {
-						try {
-							m_data[iPrefix] = iNode.as<float>();
-						} catch (...) {
-							try {
-								m_data[iPrefix] = iNode.as<double>();
-							} catch (...) { m_data[iPrefix] = iNode.as<std::string>(); }
-						}
-					}
-				}
+		root = YAML::LoadFile(iPath.string());
+	} catch (const YAML::Exception& e) {
+		log_error("Failed to load settings from '{}': {}", iPath.string(), e.what());
+		return;
+	}
+
+	// each value is parsed once, with the type of the schema when the key is known
+	std::vector<std::string_view> texts;
+	std::function<void(const YAML::Node&, const std::string&)> flattenNode;
+	flattenNode = [&](const YAML::Node& iNode, const std::string& iPrefix) -> void {
+		if (iNode.IsMap()) {
+			for (const auto& pair: iNode) {
+				const std::string& name = pair.first.Scalar();
+				flattenNode(pair.second, iPrefix.empty() ? name : std::format("{}/{}", iPrefix, name));
 			}
-		};
+			return;
+		}
+		const auto* definition = iSchema.find(iPrefix);
+		std::any value;
+		if (iNode.IsSequence()) {
+			texts.clear();
+			for (const auto& item: iNode) texts.emplace_back(item.Scalar());
+			value = definition != nullptr ? definition->parse(texts) : guessSettingValue(texts);
+		} else if (iNode.IsScalar()) {
+			value = definition != nullptr ? definition->parse(iNode.Scalar()) : guessSettingValue(iNode.Scalar());
+		} else {
+			return;
+		}
+		if (!value.has_value()) {
+			log_warn("Invalid value for the setting '{}'", iPrefix);
+			return;
+		}
+		if (definition != nullptr && !definition->clamp(value))
+			log_warn("Value of the setting '{}' out of range", iPrefix);
+		m_data.insert_or_assign(iPrefix, std::move(value));
+	};
+	flattenNode(root, "");
+	touchAll();
+}
 
-		flattenNode(root, "");
+namespace {
+template<typename... T>
+auto sameValueOf(const std::any& iLeft, const std::any& iRight) -> bool {
+	return ((iLeft.type() == typeid(T) && std::any_cast<T>(iLeft) == std::any_cast<T>(iRight)) || ...);
+}
 
-	} catch (const YAML::Exception& e) { log_error("Failed to load settings from '{}': {}", iPath.string(), e.what()); }
+/// Equality of two values: a path is equal to the same string (as read from the file).
+auto sameValue(const std::any& iLeft, const std::any& iRight) -> bool {
+	if (iLeft.type() == iRight.type())
+		return sameValueOf<bool, int, float, double, std::string, std::filesystem::path, math::vec2, math::vec3,
+						   math::vec4>(iLeft, iRight);
+	const auto text = [](const std::any& iValue) -> std::optional<std::string> {
+		if (const auto* value = std::any_cast<std::string>(&iValue))
+			return *value;
+		if (const auto* value = std::any_cast<std::filesystem::path>(&iValue))
+			return value->string();
+		return std::nullopt;
+	};
+	const auto left = text(iLeft);
+	return left.has_value() && left == text(iRight);
 }
 
-void Settings::toFile(const std::filesystem::path& iPath) const {
-	std::map<std::string, std::map<std::string, std::any>> hierarchy;
+void emitValue(YAML::Emitter& ioOut, const std::any& iValue) {
+	if (iValue.type() == typeid(bool)) {
+		ioOut << std::any_cast<bool>(iValue);
+	} else if (iValue.type() == typeid(int)) {
+		ioOut << std::any_cast<int>(iValue);
+	} else if (iValue.type() == typeid(float)) {
+		const auto fValue = std::any_cast<float>(iValue);
+		std::string formatted = std::format("{}", fValue);
+		if (!formatted.contains('.') && !formatted.contains('e')) {
+			formatted = std::format("{}.0", formatted);
+		}
+		ioOut << formatted;
+	} else if (iValue.type() == typeid(double)) {
+		const auto dValue = std::any_cast<double>(iValue);
+		std::string formatted = std::format("{}", dValue);
+		if (!formatted.contains('.') && !formatted.contains('e')) {
+			formatted = std::format("{}.0", formatted);
+		}
+		ioOut << formatted;
+	} else if (iValue.type() == typeid(std::string)) {
+		ioOut << std::any_cast<std::string>(iValue);
+	} else if (iValue.type() == typeid(math::vec2)) {
+		const auto vec = std::any_cast<math::vec2>(iValue);
+		ioOut << YAML::Flow << YAML::BeginSeq << vec.x() << vec.y() << YAML::EndSeq;
+	} else if (iValue.type() == typeid(math::vec3)) {
+		const auto vec = std::any_cast<math::vec3>(iValue);
+		ioOut << YAML::Flow << YAML::BeginSeq << vec.x() << vec.y() << vec.z() << YAML::EndSeq;
+	} else if (iValue.type() == typeid(math::vec4)) {
+		const auto vec = std::any_cast<math::vec4>(iValue);
+		ioOut << YAML::Flow << YAML::BeginSeq << vec.x() << vec.y() << vec.z() << vec.w() << YAML::EndSeq;
+	} else {
+		ioOut << "null";
+	}
+}
 
-	for (const auto& [key, value]: m_data) {
-		if (const size_t lastSlash = key.rfind('/'); lastSlash == std::string::npos) {
-			hierarchy[""][key] = value;
-		} else {
-			const std::string prefix = key.substr(0, lastSlash);
-			const std::string finalKey = key.substr(lastSlash + 1);
-			hierarchy[prefix][finalKey] = value;
-
-			std::string currentPrefix;
-			size_t pos = 0;
-			while ((pos = prefix.find('/', pos)) != std::string::npos) {
-				const std::string parentPrefix = currentPrefix;
-				const std::string levelKey =
-						prefix.substr(currentPrefix.empty() ? 0 : currentPrefix.length() + 1,
-									  pos - (currentPrefix.empty() ? 0 : currentPrefix.length() + 1));
-				if (!hierarchy[parentPrefix].contains(levelKey)) {
-					hierarchy[parentPrefix][levelKey] = std::any{};
-				}
-
-				currentPrefix = prefix.substr(0, pos);
-				++pos;
-			}
+/**
+ * @brief Check if a key is inside a group.
+ * @param iKey The key.
+ * @param iGroup The group.
+ * @return True if the key starts with the group followed by a '/'.
+ */
+auto isInGroup(const std::string_view iKey, const std::string_view iGroup) -> bool {
+	return iKey.size() > iGroup.size() && iKey[iGroup.size()] == '/' && iKey.starts_with(iGroup);
+}
+}// namespace
 
-			const std::string parentPrefix = currentPrefix;
-			if (const std::string levelKey = prefix.substr(currentPrefix.empty() ? 0 : currentPrefix.length() + 1);
-				!hierarchy[parentPrefix].contains(levelKey)) {
-				hierarchy[parentPrefix][levelKey] = std::any{};
-			}
-		}
+auto Settings::toFile(const std::filesystem::path& iPath) const -> bool {
+	const std::string yaml = toYaml();
+	try {
+		std::ofstream file(iPath);
+		file << yaml;
+		return file.good();
+	} catch (const std::exception& e) {
+		log_error("Failed to save settings to '{}': {}", iPath.string(), e.what());
+		return false;
 	}
+}
 
+auto Settings::toYaml() const -> std::string {
 	YAML::Emitter out;
 	out << YAML::BeginMap;
-
-	std::function<void(const std::string&)> emitLevel;
-	emitLevel = [&](const std::string& iPrefix) -> void {
-		for (const auto& [key, value]: hierarchy[iPrefix]) {
-			out << YAML::Key << key;
-
-			const std::string fullKey = iPrefix.empty() ? key : std::format("{}/{}", iPrefix, key);
-			const std::string childPrefix = std::format("{}/", fullKey);
-			const bool hasChildren = std::ranges::any_of(
-					m_data, [&childPrefix](const auto& iPair) -> bool { return iPair.first.starts_with(childPrefix); });
-
-			if (hasChildren) {
-				out << YAML::Value << YAML::BeginMap;
-				emitLevel(fullKey);
-				out << YAML::EndMap;
-			} else {
-				out << YAML::Value;
-				if (value.type() == typeid(bool)) {
-					out << std::any_cast<bool>(value);
-				} else if (value.type() == typeid(int)) {
-					out << std::any_cast<int>(value);
-				} else if (value.type() == typeid(float)) {
-					const auto fValue = std::any_cast<float>(value);
-					std::string formatted = std::format("{}", fValue);
-					if (!formatted.contains('.') && !formatted.contains('e')) {
-						formatted = std::format("{}.0", formatted);
-					}
-					out << formatted;
-				} else if (value.type() == typeid(double)) {
-					const auto dValue = std::any_cast<double>(value);
-					std::string formatted = std::format("{}", dValue);
-					if (!formatted.contains('.') && !formatted.contains('e')) {
-						formatted = std::format("{}.0", formatted);
-					}
-					out << formatted;
-				} else if (value.type() == typeid(std::string)) {
-					out << std::any_cast<std::string>(value);
-				} else if (value.type() == typeid(math::vec2)) {
-					const auto vec = std::any_cast<math::vec2>(value);
-					out << YAML::Flow << YAML::BeginSeq << vec.x() << vec.y() << YAML::EndSeq;
-				} else if (value.type() == typeid(math::vec3)) {
-					const auto vec = std::any_cast<math::vec3>(value);
-					out << YAML::Flow << YAML::BeginSeq << vec.x() << vec.y() << vec.z() << YAML::EndSeq;
-				} else if (value.type() == typeid(math::vec4)) {
-					const auto vec = std::any_cast<math::vec4>(value);
-					out << YAML::Flow << YAML::BeginSeq << vec.x() << vec.y() << vec.z() << vec.w() << YAML::EndSeq;
-				} else {
-					out << "null";
-				}
+	// the groups are contiguous: only the groups opened for the previous key need to be compared
+	std::vector<std::string_view> opened;
+	for (auto it = m_data.begin(); it != m_data.end(); ++it) {
+		const std::string_view key = it->first;
+		// a key with children is written as a group, its own value is dropped
+		if (const auto next = std::next(it); next != m_data.end() && isInGroup(next->first, key))
+			continue;
+		size_t depth = 0;
+		size_t start = 0;
+		for (size_t slash = key.find('/'); slash != std::string_view::npos; slash = key.find('/', start)) {
+			const auto part = key.substr(start, slash - start);
+			if (depth < opened.size() && opened[depth] != part) {
+				for (; opened.size() > depth; opened.pop_back()) out << YAML::EndMap;
+			}
+			if (depth == opened.size()) {
+				out << YAML::Key << std::string(part) << YAML::Value << YAML::BeginMap;
+				opened.push_back(part);
 			}
+			++depth;
+			start = slash + 1;
 		}
-	};
-
-	emitLevel("");
+		for (; opened.size() > depth; opened.pop_back()) out << YAML::EndMap;
+		out << YAML::Key << std::string(key.substr(start)) << YAML::Value;
+		emitValue(out, it->second);
+	}
+	for (; !opened.empty(); opened.pop_back()) out << YAML::EndMap;
 	out << YAML::EndMap;
-
-	try {
-		std::ofstream file(iPath);
-		file << out.c_str();
-	} catch (const std::exception& e) { log_error("Failed to save settings to '{}': {}", iPath.string(), e.what()); }
+	return out.c_str();
 }
 
-void Settings::setValue(const std::string& iKey, const std::any& iValue) { m_data[iKey] = iValue; }
+void Settings::setValue(const std::string& iKey, const std::any& iValue) {
+	m_data[iKey] = iValue;
+	touch(iKey);
+}
 
-void Settings::clear() { m_data.clear(); }
+void Settings::clear() {
+	m_data.clear();
+	touchAll();
+}
 
-void Settings::remove(const std::string& iKey) { m_data.erase(iKey); }
+void Settings::remove(const std::string& iKey) {
+	if (m_data.erase(iKey) > 0)
+		touch(iKey);
+}
 
 void Settings::include(const Settings& iOther, const std::string_view iPrefix) {
+	// the prefixed keys keep their order: each one is inserted next to the previous one
+	auto hint = m_data.end();
 	for (const auto& [key, value]: iOther.m_data) {
-		const std::string newKey = iPrefix.empty() ? key : std::format("{}/{}", iPrefix, key);
-		m_data[newKey] = value;
+		std::string newKey = iPrefix.empty() ? key : std::format("{}/{}", iPrefix, key);
+		touch(newKey);
+		hint = std::next(m_data.insert_or_assign(hint, std::move(newKey), value));
 	}
 }
 
 void Settings::includeMissing(const Settings& iOther, std::string_view iPrefix) {
+	auto hint = m_data.end();
 	for (const auto& [key, value]: iOther.m_data) {
-		if (const std::string newKey = iPrefix.empty() ? key : std::format("{}/{}", iPrefix, key);
-			!m_data.contains(newKey)) {
-			m_data[newKey] = value;
-		}
+		std::string newKey = iPrefix.empty() ? key : std::format("{}/{}", iPrefix, key);
+		const auto size = m_data.size();
+		const auto inserted = m_data.try_emplace(hint, std::move(newKey), value);
+		if (m_data.size() != size)
+			touch(inserted->first);
+		hint = std::next(inserted);
+	}
+}
+
+auto Settings::update(const Settings& iOther, const std::string_view iPrefix, const bool iExistingOnly)
+		-> std::vector<std::string> {
+	std::vector<std::string> modified;
+	for (const auto& [key, value]: iOther.m_data) {
+		std::string newKey = iPrefix.empty() ? key : std::format("{}/{}", iPrefix, key);
+		const auto current = m_data.find(newKey);
+		if (current == m_data.end() ? iExistingOnly : sameValue(current->second, value))
+			continue;
+		touch(newKey);
+		m_data.insert_or_assign(current, newKey, value);
+		modified.push_back(std::move(newKey));
 	}
+	return modified;
 }
 
 auto Settings::extract(const std::string_view& iPrefix) const -> Settings {
 	Settings result;
 	const std::string prefixWithSlash = std::format("{}/", iPrefix);
-	for (const auto& [key, value]: m_data) {
-		if (key.starts_with(prefixWithSlash)) {// key starts with prefixWithSlash
-			const std::string newKey = key.substr(prefixWithSlash.length());
-			result.setValue(newKey, value);
-		}
-	}
+	for (auto it = m_data.lower_bound(prefixWithSlash); it != m_data.end() && it->first.starts_with(prefixWithSlash);
+		 ++it)
+		result.m_data.emplace_hint(result.m_data.end(), it->first.substr(prefixWithSlash.length()), it->second);
+	result.touchAll();
 	return result;
 }
 
+auto Settings::getGeneration(const std::string_view iSection) const -> uint64_t {
+	if (const auto section = m_sections.find(iSection); section != m_sections.end())
+		return std::max(section->second, m_resetGeneration);
+	return m_resetGeneration;
+}
+
+void Settings::touch(const std::string_view iKey) {
+	const auto section = iKey.substr(0, iKey.find('/'));
+	++m_generation;
+	if (const auto found = m_sections.find(section); found != m_sections.end())
+		found->second = m_generation;
+	else
+		m_sections.emplace(section, m_generation);
+}
+
 }// namespace evl::core
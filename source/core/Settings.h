@@ -8,15 +8,22 @@
 
 #pragma once
 
+#include <algorithm>
 #include <any>
 #include <filesystem>
+#include <map>
+#include <optional>
 #include <string>
-#include <unordered_map>
+
+#include "SettingsSchema.h"
 
 namespace evl::core {
 
 /**
  * @brief Class Settings.
+ *
+ * The keys are paths ("section/group/name") kept sorted component by component: the keys of a group form a
+ * contiguous range, so a group is extracted without scanning the other keys and the file is written in one pass.
  */
 class Settings final {
 public:
@@ -36,15 +43,32 @@ public:
 
 	/**
 	 * @brief Load configuration from file.
+	 *
+	 * The values of the keys known by the schema are parsed with their type and brought in their range, the
+	 * invalid ones are ignored. The type of the other values is guessed.
 	 * @param iPath The file path.
+	 * @param iSchema The known settings.
 	 */
-	void fromFile(const std::filesystem::path& iPath);
+	void fromFile(const std::filesystem::path& iPath, const SettingsSchema& iSchema = getSettingsSchema());
 
 	/**
 	 * @brief Save configuration to file.
 	 * @param iPath The file path.
+	 * @return False if the file cannot be written.
+	 */
+	auto toFile(const std::filesystem::path& iPath) const -> bool;
+
+	/**
+	 * @brief Get the configuration as YAML.
+	 * @return The YAML text.
+	 */
+	[[nodiscard]] auto toYaml() const -> std::string;
+
+	/**
+	 * @brief Get the number of keys.
+	 * @return The number of keys.
 	 */
-	void toFile(const std::filesystem::path& iPath) const;
+	[[nodiscard]] auto size() const -> size_t { return m_data.size(); }
 
 	/**
 	 * @brief Get a value from configuration.
@@ -55,24 +79,30 @@ public:
 	 */
 	template<typename T>
 	auto getValue(const std::string& iKey, const T& iDefault = T{}) const -> T {
+		return tryGetValue<T>(iKey).value_or(iDefault);
+	}
+
+	/**
+	 * @brief Get a value from configuration, if it exists with a compatible type.
+	 * @tparam T Type of the value.
+	 * @param iKey The key.
+	 * @return The value or nothing.
+	 */
+	template<typename T>
+	auto tryGetValue(const std::string& iKey) const -> std::optional<T> {
 		if (const auto it = m_data.find(iKey); it != m_data.end()) {
-			try {
-				return std::any_cast<T>(it->second);
-			} catch (const std::bad_any_cast&) {
-				// Try conversion between float and double
-				if constexpr (std::is_same_v<T, float>) {
-					try {
-						return static_cast<float>(std::any_cast<double>(it->second));
-					} catch (const std::bad_any_cast&) { return iDefault; }
-				} else if constexpr (std::is_same_v<T, double>) {
-					try {
-						return static_cast<double>(std::any_cast<float>(it->second));
-					} catch (const std::bad_any_cast&) { return iDefault; }
-				}
-				return iDefault;
+			if (const auto* value = std::any_cast<T>(&it->second))
+				return *value;
+			// Try conversion between float and double
+			if constexpr (std::is_same_v<T, float>) {
+				if (const auto* value = std::any_cast<double>(&it->second))
+					return static_cast<float>(*value);
+			} else if constexpr (std::is_same_v<T, double>) {
+				if (const auto* value = std::any_cast<float>(&it->second))
+					return static_cast<double>(*value);
 			}
 		}
-		return iDefault;
+		return std::nullopt;
 	}
 
 	/**
@@ -118,6 +148,18 @@ public:
 	 */
 	void includeMissing(const Settings& iOther, std::string_view iPrefix = "");
 
+	/**
+	 * @brief Copy the values of another Settings object that differ from the current ones, with an optional prefix.
+	 * @param iOther The other Settings object.
+	 * @param iPrefix The prefix to add to each key.
+	 * @param iExistingOnly If true, only the keys that already exist are copied.
+	 * @return The modified keys, sorted.
+	 *
+	 * @note The keys missing in the other object are kept. Only the modified sections change of generation.
+	 */
+	auto update(const Settings& iOther, std::string_view iPrefix = "", bool iExistingOnly = false)
+			-> std::vector<std::string>;
+
 	/**
 	 * @brief Extract a subset of settings with a given prefix.
 	 * @param iPrefix The prefix to filter keys.
@@ -125,9 +167,43 @@ public:
 	 */
 	auto extract(const std::string_view& iPrefix) const -> Settings;
 
+	/**
+	 * @brief Get the generation of a section: it changes each time a key of the section is modified.
+	 * @param iSection The section (first part of the keys, before the first '/').
+	 * @return The generation of the section.
+	 */
+	[[nodiscard]] auto getGeneration(std::string_view iSection) const -> uint64_t;
+
 private:
+	/// Order of the keys: component by component ('/' before any other character).
+	struct KeyLess {
+		using is_transparent = void;
+		auto operator()(std::string_view iLeft, std::string_view iRight) const -> bool {
+			constexpr auto rank = [](const char iChar) -> int {
+				return iChar == '/' ? -1 : static_cast<unsigned char>(iChar);
+			};
+			return std::ranges::lexicographical_compare(iLeft, iRight, {}, rank, rank);
+		}
+	};
+
+	/**
+	 * @brief Mark the section of a key as modified.
+	 * @param iKey The modified key.
+	 */
+	void touch(std::string_view iKey);
+	/**
+	 * @brief Mark all the sections as modified.
+	 */
+	void touchAll() { m_resetGeneration = ++m_generation; }
+
 	/// Data storage.
-	std::unordered_map<std::string, std::any> m_data;
+	std::map<std::string, std::any, KeyLess> m_data;
+	/// Number of modifications.
+	uint64_t m_generation = 0;
+	/// Generation of the last modification of all the sections.
+	uint64_t m_resetGeneration = 0;
+	/// Generation of the last modification of each section.
+	std::map<std::string, uint64_t, std::less<>> m_sections;
 };
 
 }// namespace evl::core
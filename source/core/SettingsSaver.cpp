@@ -0,0 +1,83 @@
+/**
+ * @file SettingsSaver.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "SettingsSaver.h"
+
+#include "BinaryIO.h"
+#include "Log.h"
+
+namespace evl::core {
+
+SettingsSaver::SettingsSaver(std::filesystem::path iFile, const std::chrono::milliseconds iDelay)
+	: m_file{std::move(iFile)}, m_delay{iDelay}, m_saver{[this](const std::stop_token& iStop) { run(iStop); }} {}
+
+SettingsSaver::~SettingsSaver() {
+	flush();
+	m_saver.request_stop();
+	m_saver.join();
+}
+
+void SettingsSaver::save(Settings iSnapshot) {
+	{
+		const std::scoped_lock lock(m_mutex);
+		m_pending = std::move(iSnapshot);
+		m_deadline = std::chrono::steady_clock::now() + m_delay;
+	}
+	m_wakeUp.notify_one();
+}
+
+void SettingsSaver::flush() {
+	std::unique_lock lock(m_mutex);
+	if (m_pending.has_value())
+		m_flush = true;
+	m_wakeUp.notify_one();
+	m_done.wait(lock, [this] { return !m_pending.has_value() && !m_writing; });
+}
+
+auto SettingsSaver::getWriteCount() const -> size_t {
+	const std::scoped_lock lock(m_mutex);
+	return m_writeCount;
+}
+
+auto SettingsSaver::isPending() const -> bool {
+	const std::scoped_lock lock(m_mutex);
+	return m_pending.has_value() || m_writing;
+}
+
+void SettingsSaver::run(const std::stop_token& iStop) {
+	std::unique_lock lock(m_mutex);
+	while (true) {
+		m_wakeUp.wait(lock, iStop, [this] { return m_pending.has_value(); });
+		if (!m_pending.has_value())
+			return;// stopped
+		// each new request pushes the deadline back
+		while (!m_flush && !iStop.stop_requested() && std::chrono::steady_clock::now() < m_deadline)
+			m_wakeUp.wait_until(lock, iStop, m_deadline, [this] { return m_flush; });
+		const Settings settings = std::move(m_pending.value());
+		m_pending.reset();
+		m_flush = false;
+		m_writing = true;
+		lock.unlock();
+		write(settings);
+		lock.lock();
+		m_writing = false;
+		++m_writeCount;
+		m_done.notify_all();
+	}
+}
+
+void SettingsSaver::write(const Settings& iSettings) const {
+	if (!binary::writeAtomic(m_file, iSettings.toYaml())) {
+		log_warn("Impossible de sauvegarder la configuration '{}'", m_file.string());
+		return;
+	}
+	log_debug("Configuration '{}' sauvegardée", m_file.string());
+}
+
+}// namespace evl::core
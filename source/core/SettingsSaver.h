@@ -0,0 +1,107 @@
+/**
+ * @file SettingsSaver.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#pragma once
+
+#include "Settings.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <mutex>
+#include <optional>
+#include <thread>
+
+namespace evl::core {
+
+/**
+ * @brief Class SettingsSaver: write of the settings file on a background thread.
+ *
+ * A save waits for a short delay before writing: the saves requested during the delay are merged and only the
+ * most recent settings are written. The file is written beside the target then renamed over it.
+ */
+class SettingsSaver {
+public:
+	/// Default delay before writing.
+	static constexpr std::chrono::milliseconds g_defaultDelay{500};
+
+	/**
+	 * @brief Constructor.
+	 * @param iFile The settings file.
+	 * @param iDelay Delay before writing.
+	 */
+	explicit SettingsSaver(std::filesystem::path iFile, std::chrono::milliseconds iDelay = g_defaultDelay);
+	/**
+	 * @brief Destructor: the pending settings are written first.
+	 */
+	~SettingsSaver();
+	SettingsSaver(const SettingsSaver&) = delete;
+	SettingsSaver(SettingsSaver&&) = delete;
+	auto operator=(const SettingsSaver&) -> SettingsSaver& = delete;
+	auto operator=(SettingsSaver&&) -> SettingsSaver& = delete;
+
+	/**
+	 * @brief Request the save of the settings, after the delay.
+	 * @param iSnapshot Copy of the settings to save.
+	 */
+	void save(Settings iSnapshot);
+
+	/**
+	 * @brief Write the pending settings now and wait until written.
+	 */
+	void flush();
+
+	/**
+	 * @brief Get the number of writes of the file.
+	 * @return The number of writes.
+	 */
+	[[nodiscard]] auto getWriteCount() const -> size_t;
+
+	/**
+	 * @brief Check if settings are waiting to be written.
+	 * @return True if a write is pending or running.
+	 */
+	[[nodiscard]] auto isPending() const -> bool;
+
+private:
+	/**
+	 * @brief Saver thread loop.
+	 * @param iStop The stop token.
+	 */
+	void run(const std::stop_token& iStop);
+
+	/**
+	 * @brief Write settings in the file, replacing it once complete and synced to the disk.
+	 * @param iSettings The settings.
+	 */
+	void write(const Settings& iSettings) const;
+
+	/// The settings file.
+	std::filesystem::path m_file;
+	/// Delay before writing.
+	std::chrono::milliseconds m_delay;
+	/// Protection of the pending settings.
+	mutable std::mutex m_mutex;
+	/// Wakes up the saver.
+	std::condition_variable_any m_wakeUp;
+	/// Wakes up flush() when written.
+	std::condition_variable m_done;
+	/// The settings waiting to be written.
+	std::optional<Settings> m_pending;
+	/// Time of the write of the pending settings.
+	std::chrono::steady_clock::time_point m_deadline;
+	/// True if the pending settings are to be written without delay.
+	bool m_flush = false;
+	/// True while writing.
+	bool m_writing = false;
+	/// Number of writes.
+	size_t m_writeCount = 0;
+	/// The saver (last member: joined first).
+	std::jthread m_saver;
+};
+
+}// namespace evl::core
@@ -0,0 +1,221 @@
+/**
+ * @file SettingsSchema.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "SettingsSchema.h"
+
+#include "SettingsSection.h"
+#include "maths/vectors.h"
+
+#include <charconv>
+
+namespace evl::core {
+
+namespace {
+using Type = SettingDefinition::Type;
+
+auto parseBool(const std::string_view iText) -> std::optional<bool> {
+	// the words accepted by yaml-cpp
+	constexpr std::array<std::pair<std::string_view, bool>, 8> words{{{"y", true},
+																	  {"yes", true},
+																	  {"true", true},
+																	  {"on", true},
+																	  {"n", false},
+																	  {"no", false},
+																	  {"false", false},
+																	  {"off", false}}};
+	for (const auto& [word, value]: words) {
+		if (std::ranges::equal(iText, word, [](const char iLeft, const char iRight) {
+				return std::tolower(static_cast<unsigned char>(iLeft)) == iRight;
+			}))
+			return value;
+	}
+	return std::nullopt;
+}
+
+template<typename T>
+auto parseNumber(const std::string_view iText) -> std::optional<T> {
+	T value{};
+	const auto* const end = iText.data() + iText.size();
+	if (const auto [ptr, error] = std::from_chars(iText.data(), end, value); error != std::errc{} || ptr != end)
+		return std::nullopt;
+	return value;
+}
+
+template<typename Vector>
+auto parseVector(const std::vector<std::string_view>& iTexts) -> std::any {
+	Vector result;
+	for (size_t i = 0; i < iTexts.size(); ++i) {
+		const auto value = parseNumber<float>(iTexts[i]);
+		if (!value.has_value())
+			return {};
+		result[i] = value.value();
+	}
+	return result;
+}
+
+template<typename T>
+auto clampNumber(T& ioValue, const std::optional<double>& iMin, const std::optional<double>& iMax) -> bool {
+	const T value = ioValue;
+	if (iMin.has_value())
+		ioValue = std::max(ioValue, static_cast<T>(iMin.value()));
+	if (iMax.has_value())
+		ioValue = std::min(ioValue, static_cast<T>(iMax.value()));
+	return ioValue == value;
+}
+
+template<typename T, size_t Dim>
+auto clampVector(math::Vector<T, Dim>& ioValue, const std::optional<double>& iMin, const std::optional<double>& iMax)
+		-> bool {
+	bool inRange = true;
+	for (size_t i = 0; i < Dim; ++i) inRange = clampNumber(ioValue[i], iMin, iMax) && inRange;
+	return inRange;
+}
+
+auto makeSchema() -> SettingsSchema {
+	SettingsSchema schema;
+	schema.add({.key = "general/use_imgui", .type = Type::Bool, .defaultValue = true});
+	schema.add({.key = "general/log_level", .type = Type::String, .defaultValue = std::string("info")});
+	// name of a RandomNumberGenerator::Engine
+	schema.add({.key = "general/rng_engine", .type = Type::String, .defaultValue = std::string("Pcg")});
+	// depends on the executable path: filled by mergeDefaultSettings
+	schema.add({.key = "general/data_location", .type = Type::String});
+
+	// display: the defaults are the ones of GuiSettings
+	const GuiSettings gui;
+	const auto scale = [&schema](const std::string_view iName, const float iDefault) {
+		schema.add({.key = std::format("gui/{}", iName),
+					.type = Type::Float,
+					.defaultValue = iDefault,
+					.min = 0.0,
+					.max = 20.0});
+	};
+	scale("title_scale", gui.titleScale);
+	scale("time_scale", gui.timeScale);
+	scale("value_scale", gui.valueScale);
+	scale("prices_scale", gui.pricesScale);
+	scale("grid_text_scale", gui.gridTextScale);
+	schema.add({.key = "gui/grid_button_spacing",
+				.type = Type::Vec2,
+				.defaultValue = gui.gridSpacing,
+				.min = 0.0,
+				.max = 100.0});
+	const auto color = [&schema](const std::string_view iName, std::any iDefault) {
+		schema.add({.key = std::format("gui/{}", iName),
+					.type = Type::Vec4,
+					.defaultValue = std::move(iDefault),
+					.min = 0.0,
+					.max = 1.0});
+	};
+	color("grid_background_color", gui.gridBackgroundColor);
+	color("selected_number_color", gui.selectedNumberColor);
+	// no default: the colors of the style are kept
+	color("background_color", {});
+	color("text_color", {});
+	schema.add({.key = "gui/fade_numbers", .type = Type::Bool, .defaultValue = gui.fadeNumbers});
+	schema.add({.key = "gui/fade_amount", .type = Type::Int, .defaultValue = gui.fadeAmount, .min = 0.0, .max = 90.0});
+	schema.add({.key = "gui/fade_strength",
+				.type = Type::Float,
+				.defaultValue = gui.fadeStrength,
+				.min = 0.0,
+				.max = 1.0});
+	schema.add({.key = "gui/truncate_price", .type = Type::Bool, .defaultValue = gui.truncatePrice});
+	schema.add({.key = "gui/truncate_price_lines",
+				.type = Type::Int,
+				.defaultValue = gui.truncatePriceLines,
+				.min = 1.0,
+				.max = 100.0});
+	return schema;
+}
+}// namespace
+
+auto SettingDefinition::parse(const std::string_view iText) const -> std::any {
+	switch (type) {
+		case Type::Bool:
+			if (const auto value = parseBool(iText); value.has_value())
+				return value.value();
+			break;
+		case Type::Int:
+			if (const auto value = parseNumber<int>(iText); value.has_value())
+				return value.value();
+			break;
+		case Type::Float:
+			if (const auto value = parseNumber<float>(iText); value.has_value())
+				return value.value();
+			break;
+		case Type::String:
+			return std::string(iText);
+		case Type::Vec2:
+		case Type::Vec4:
+			break;
+	}
+	return {};
+}
+
+auto SettingDefinition::parse(const std::vector<std::string_view>& iTexts) const -> std::any {
+	if (type == Type::Vec2 && iTexts.size() == 2)
+		return parseVector<math::vec2>(iTexts);
+	if (type == Type::Vec4 && iTexts.size() == 4)
+		return parseVector<math::vec4>(iTexts);
+	return {};
+}
+
+auto SettingDefinition::clamp(std::any& ioValue) const -> bool {
+	if (auto* value = std::any_cast<int>(&ioValue))
+		return clampNumber(*value, min, max);
+	if (auto* value = std::any_cast<float>(&ioValue))
+		return clampNumber(*value, min, max);
+	if (auto* value = std::any_cast<math::vec2>(&ioValue))
+		return clampVector(*value, min, max);
+	if (auto* value = std::any_cast<math::vec4>(&ioValue))
+		return clampVector(*value, min, max);
+	return true;
+}
+
+void SettingsSchema::add(SettingDefinition iDefinition) {
+	auto key = iDefinition.key;
+	m_definitions.insert_or_assign(std::move(key), std::move(iDefinition));
+}
+
+auto SettingsSchema::find(const std::string_view iKey) const -> const SettingDefinition* {
+	if (const auto definition = m_definitions.find(iKey); definition != m_definitions.end())
+		return &definition->second;
+	return nullptr;
+}
+
+auto getSettingsSchema() -> const SettingsSchema& {
+	static const SettingsSchema schema = makeSchema();
+	return schema;
+}
+
+auto guessSettingValue(const std::string_view iText) -> std::any {
+	if (const auto value = parseBool(iText); value.has_value())
+		return value.value();
+	if (const auto value = parseNumber<int>(iText); value.has_value())
+		return value.value();
+	if (const auto value = parseNumber<float>(iText); value.has_value())
+		return value.value();
+	if (const auto value = parseNumber<double>(iText); value.has_value())
+		return value.value();
+	return std::string(iText);
+}
+
+auto guessSettingValue(const std::vector<std::string_view>& iTexts) -> std::any {
+	switch (iTexts.size()) {
+		case 2:
+			return parseVector<math::vec2>(iTexts);
+		case 3:
+			return parseVector<math::vec3>(iTexts);
+		case 4:
+			return parseVector<math::vec4>(iTexts);
+		default:
+			return {};
+	}
+}
+
+}// namespace evl::core
@@ -0,0 +1,121 @@
+/**
+ * @file SettingsSchema.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#pragma once
+
+#include <any>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace evl::core {
+
+/**
+ * @brief Description of a known setting.
+ */
+struct SettingDefinition {
+	/// Type of the value.
+	enum struct Type : uint8_t {
+		Bool,///< bool.
+		Int,///< int.
+		Float,///< float.
+		String,///< std::string.
+		Vec2,///< math::vec2.
+		Vec4,///< math::vec4.
+	};
+	/// The key.
+	std::string key{};
+	/// Type of the value.
+	Type type = Type::String;
+	/// Default value, empty if the setting has none.
+	std::any defaultValue{};
+	/// Lowest value (numbers and vector components).
+	std::optional<double> min{};
+	/// Highest value (numbers and vector components).
+	std::optional<double> max{};
+
+	/**
+	 * @brief Parse a scalar value of the setting, without exception.
+	 * @param iText The text of the value.
+	 * @return The value, empty if the text is not a value of the type.
+	 */
+	[[nodiscard]] auto parse(std::string_view iText) const -> std::any;
+
+	/**
+	 * @brief Parse a vector value of the setting, without exception.
+	 * @param iTexts The texts of the components.
+	 * @return The value, empty if the setting is not a vector of this size or a component is not a number.
+	 */
+	[[nodiscard]] auto parse(const std::vector<std::string_view>& iTexts) const -> std::any;
+
+	/**
+	 * @brief Bring a value in the range of the setting.
+	 * @param ioValue The value, of the type of the setting.
+	 * @return True if the value was in the range.
+	 */
+	auto clamp(std::any& ioValue) const -> bool;
+};
+
+/**
+ * @brief Class SettingsSchema: the known settings, their type, default value and range.
+ *
+ * The settings file is read with the schema: each value of a known key is parsed once with its type and
+ * brought in its range. The default values fill the missing settings.
+ */
+class SettingsSchema {
+public:
+	/**
+	 * @brief Register a setting, replacing the previous definition of the key.
+	 * @param iDefinition The definition.
+	 */
+	void add(SettingDefinition iDefinition);
+
+	/**
+	 * @brief Find the definition of a key.
+	 * @param iKey The key.
+	 * @return The definition, null if the key is unknown.
+	 */
+	[[nodiscard]] auto find(std::string_view iKey) const -> const SettingDefinition*;
+
+	/**
+	 * @brief Get the definitions, sorted by key.
+	 * @return The definitions.
+	 */
+	[[nodiscard]] auto getDefinitions() const -> const std::map<std::string, SettingDefinition, std::less<>>& {
+		return m_definitions;
+	}
+
+private:
+	/// The definitions by key.
+	std::map<std::string, SettingDefinition, std::less<>> m_definitions;
+};
+
+/**
+ * @brief Get the schema of the application settings.
+ * @return The schema.
+ */
+auto getSettingsSchema() -> const SettingsSchema&;
+
+/**
+ * @brief Guess the value of a scalar of unknown setting, without exception.
+ *
+ * As yaml-cpp would: a boolean, else an integer, else a float (a double if too large), else a string.
+ * @param iText The text of the value.
+ * @return The value.
+ */
+auto guessSettingValue(std::string_view iText) -> std::any;
+
+/**
+ * @brief Guess the value of a sequence of unknown setting, without exception.
+ * @param iTexts The texts of the components.
+ * @return A vector if there are 2 to 4 numbers, empty otherwise.
+ */
+auto guessSettingValue(const std::vector<std::string_view>& iTexts) -> std::any;
+
+}// namespace evl::core
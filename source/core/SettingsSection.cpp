@@ -0,0 +1,32 @@
+/**
+ * @file SettingsSection.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "SettingsSection.h"
+
+namespace evl::core {
+
+void GuiSettings::load(const Settings& iSettings) {
+	titleScale = iSettings.getValue("gui/title_scale", titleScale);
+	timeScale = iSettings.getValue("gui/time_scale", timeScale);
+	valueScale = iSettings.getValue("gui/value_scale", valueScale);
+	pricesScale = iSettings.getValue("gui/prices_scale", pricesScale);
+	gridTextScale = iSettings.getValue("gui/grid_text_scale", gridTextScale);
+	gridSpacing = iSettings.getValue("gui/grid_button_spacing", gridSpacing);
+	gridBackgroundColor = iSettings.getValue("gui/grid_background_color", gridBackgroundColor);
+	selectedNumberColor = iSettings.getValue("gui/selected_number_color", selectedNumberColor);
+	backgroundColor = iSettings.tryGetValue<math::vec4>("gui/background_color");
+	textColor = iSettings.tryGetValue<math::vec4>("gui/text_color");
+	fadeNumbers = iSettings.getValue("gui/fade_numbers", fadeNumbers);
+	fadeAmount = iSettings.getValue("gui/fade_amount", fadeAmount);
+	fadeStrength = iSettings.getValue("gui/fade_strength", fadeStrength);
+	truncatePrice = iSettings.getValue("gui/truncate_price", truncatePrice);
+	truncatePriceLines = iSettings.getValue("gui/truncate_price_lines", truncatePriceLines);
+}
+
+}// namespace evl::core
@@ -0,0 +1,108 @@
+/**
+ * @file SettingsSection.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#pragma once
+
+#include "Settings.h"
+#include "maths/vectors.h"
+
+#include <optional>
+
+namespace evl::core {
+
+/**
+ * @brief Typed copy of a section of the settings, reloaded only when the section changes.
+ *
+ * The section type provides its prefix as `g_section` and a `load(const Settings&)` function filling its fields.
+ * @tparam Section The section type.
+ */
+template<typename Section>
+class SettingsSnapshot {
+public:
+	/**
+	 * @brief Get the section, reloaded if one of its keys changed since the last call.
+	 * @param iSettings The settings.
+	 * @return The section.
+	 */
+	auto get(const Settings& iSettings) -> const Section& {
+		if (const auto generation = iSettings.getGeneration(Section::g_section);
+			!m_loaded || generation != m_generation || &iSettings != m_source) {
+			m_section = Section{};
+			m_section.load(iSettings);
+			m_generation = generation;
+			m_source = &iSettings;
+			m_loaded = true;
+			++m_loadCount;
+		}
+		return m_section;
+	}
+
+	/**
+	 * @brief Get the number of loads.
+	 * @return The number of loads.
+	 */
+	[[nodiscard]] auto getLoadCount() const -> size_t { return m_loadCount; }
+
+private:
+	/// The section.
+	Section m_section;
+	/// Settings the section comes from.
+	const Settings* m_source = nullptr;
+	/// Generation of the section when loaded.
+	uint64_t m_generation = 0;
+	/// Number of loads.
+	size_t m_loadCount = 0;
+	/// True once loaded.
+	bool m_loaded = false;
+};
+
+/**
+ * @brief Settings of the player display (section "gui").
+ */
+struct GuiSettings {
+	/// Prefix of the keys.
+	static constexpr std::string_view g_section = "gui";
+
+	/// Scale of the titles.
+	float titleScale = 4.0f;
+	/// Scale of the time.
+	float timeScale = 1.6f;
+	/// Scale of the prices value.
+	float valueScale = 3.0f;
+	/// Scale of the prices text.
+	float pricesScale = 2.5f;
+	/// Scale of the grid numbers.
+	float gridTextScale = 0.9f;
+	/// Spacing of the grid buttons.
+	math::vec2 gridSpacing{4.0f, 4.0f};
+	/// Background of the grid buttons.
+	math::vec4 gridBackgroundColor{0.1f, 0.1f, 0.1f, 1.0f};
+	/// Color of the last drawn number.
+	math::vec4 selectedNumberColor{1.0f, 0.44f, 0.0f, 1.0f};
+	/// Background color, none to keep the style one.
+	std::optional<math::vec4> backgroundColor;
+	/// Text color, none to keep the style one.
+	std::optional<math::vec4> textColor;
+	/// Fade the last drawn numbers.
+	bool fadeNumbers = true;
+	/// Number of faded numbers.
+	int fadeAmount = 3;
+	/// Strength of the fading.
+	float fadeStrength = 0.5f;
+	/// Truncate the long prices.
+	bool truncatePrice = false;
+	/// Lines kept of the truncated prices.
+	int truncatePriceLines = 3;
+
+	/**
+	 * @brief Read the section.
+	 * @param iSettings The settings.
+	 */
+	void load(const Settings& iSettings);
+};
+
+}// namespace evl::core
@@ -0,0 +1,156 @@
+/**
+ * @file Simulator.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "Simulator.h"
+
+#include "CardGenerator.h"
+#include "Log.h"
+#include "RandomNumberGenerator.h"
+#include "ThreadPool.h"
+
+namespace evl::core {
+
+namespace {
+/// Number of runs in a task of the pool.
+constexpr size_t g_runsPerTask = 32;
+/// Quantile used for the pessimistic durations.
+constexpr double g_highQuantile = 0.9;
+
+void record(std::map<SubGameRound::Type, Simulator::TypeStats>& ioTypes, const SubGameRound::Type iType,
+			const uint8_t iDraws) {
+	auto& stats = ioTypes[iType];
+	++stats.samples;
+	++stats.drawHistogram[iDraws];
+	stats.totalDraws += iDraws;
+	stats.minDraws = std::min(stats.minDraws, iDraws);
+	stats.maxDraws = std::max(stats.maxDraws, iDraws);
+}
+
+auto quantile(const std::vector<double>& iSorted, const double iQuantile) -> double {
+	if (iSorted.empty())
+		return 0.0;
+	const auto rank = static_cast<size_t>(iQuantile * static_cast<double>(iSorted.size() - 1));
+	return iSorted[rank];
+}
+}// namespace
+
+Simulator::Simulator(const Event& iEvent, const Options& iOptions) : m_options{iOptions} {
+	for (auto round = iEvent.beginRounds(); round != iEvent.endRounds(); ++round) {
+		if (round->getType() == GameRound::Type::Pause || round->getType() == GameRound::Type::Invalid ||
+			round->sizeSubRound() == 0)
+			continue;
+		Round& simulated = m_rounds.emplace_back();
+		simulated.inverse = round->getType() == GameRound::Type::Inverse;
+		for (auto sub = round->beginSubRound(); sub != round->endSubRound(); ++sub)
+			simulated.subRounds.push_back(sub->getType());
+	}
+	for (const auto& card: CardGenerator(m_options.seed).generate(m_options.cards)) m_cards.addCard(card);
+	m_cards.buildIndex();
+}
+
+auto Simulator::run() const -> Result {
+	Result result;
+	if (m_rounds.empty() || m_cards.empty() || m_options.runs == 0) {
+		log_warn("Simulation impossible: pas de partie ou pas de carton");
+		return result;
+	}
+	const auto start = std::chrono::steady_clock::now();
+	ThreadPool pool(m_options.threads);
+	std::vector<Accumulator> accumulators(pool.size());
+	std::vector<CardRegistry> cards(pool.size(), m_cards);
+	std::vector<std::pair<uint64_t, uint64_t>> runs(m_options.runs);
+	for (size_t first = 0; first < runs.size(); first += g_runsPerTask) {
+		pool.submit([&, first] {
+			const size_t worker = pool.currentWorker();
+			const size_t last = std::min(first + g_runsPerTask, runs.size());
+			for (size_t run = first; run < last; ++run) runs[run] = playRun(cards[worker], run, accumulators[worker]);
+		});
+	}
+	pool.wait();
+
+	// merge of the worker counters
+	for (const auto& accumulator: accumulators) {
+		result.totalDraws += accumulator.totalDraws;
+		for (const auto& [type, stats]: accumulator.types) {
+			auto& merged = result.types[type];
+			merged.samples += stats.samples;
+			merged.totalDraws += stats.totalDraws;
+			merged.minDraws = std::min(merged.minDraws, stats.minDraws);
+			merged.maxDraws = std::max(merged.maxDraws, stats.maxDraws);
+			for (size_t draws = 0; draws < stats.drawHistogram.size(); ++draws)
+				merged.drawHistogram[draws] += stats.drawHistogram[draws];
+		}
+	}
+	const auto duration = [this](const double iDraws, const double iSubRounds) {
+		return m_options.drawDuration * iDraws + m_options.subRoundOverhead * iSubRounds;
+	};
+	for (auto& [type, stats]: result.types) {
+		stats.meanDraws = static_cast<double>(stats.totalDraws) / static_cast<double>(stats.samples);
+		stats.meanDuration = duration(stats.meanDraws, 1.0);
+		const auto target = static_cast<uint64_t>(g_highQuantile * static_cast<double>(stats.samples));
+		uint64_t cumulated = 0;
+		for (size_t draws = 0; draws < stats.drawHistogram.size(); ++draws) {
+			cumulated += stats.drawHistogram[draws];
+			if (cumulated >= target) {
+				stats.p90Duration = duration(static_cast<double>(draws), 1.0);
+				break;
+			}
+		}
+	}
+	std::vector<double> durations;
+	durations.reserve(runs.size());
+	for (const auto& [draws, subRounds]: runs)
+		durations.push_back(duration(static_cast<double>(draws), static_cast<double>(subRounds)).count());
+	std::ranges::sort(durations);
+	result.runs = runs.size();
+	result.meanDuration = std::chrono::duration<double>(std::reduce(durations.begin(), durations.end()) /
+														static_cast<double>(durations.size()));
+	result.medianDuration = std::chrono::duration<double>(quantile(durations, 0.5));
+	result.p90Duration = std::chrono::duration<double>(quantile(durations, g_highQuantile));
+	result.elapsed = std::chrono::steady_clock::now() - start;
+	log_info("Simulation de {} événements: {} tirages en {:.3f}s", result.runs, result.totalDraws,
+			 result.elapsed.count());
+	return result;
+}
+
+auto Simulator::playRun(CardRegistry& ioCards, const uint64_t iRun, Accumulator& ioAccumulator) const
+		-> std::pair<uint64_t, uint64_t> {
+	RandomNumberGenerator rng(true);
+	rng.seed(m_options.seed + 0x9E3779B97F4A7C15ULL * (iRun + 1));
+	uint64_t draws = 0;
+	uint64_t subRounds = 0;
+	for (const auto& round: m_rounds) {
+		rng.resetPick();
+		if (round.inverse) {
+			// one card left, or ex æquo when the last draw eliminates everyone
+			ioCards.syncElimination({});
+			while (ioCards.getSurvivorCount() > 1 && rng.getPicked().size() < NumberMask::g_maxNumber)
+				ioCards.eliminate(rng.pick());
+			record(ioAccumulator.types, SubGameRound::Type::Inverse, static_cast<uint8_t>(rng.getPicked().size()));
+			draws += rng.getPicked().size();
+			++subRounds;
+			continue;
+		}
+		ioCards.syncTracking({});
+		for (const auto type: round.subRounds) {
+			const size_t before = rng.getPicked().size();
+			while (rng.getPicked().size() < NumberMask::g_maxNumber) {
+				if (!ioCards.applyDraw(rng.pick(), type).empty())
+					break;
+			}
+			record(ioAccumulator.types, type, static_cast<uint8_t>(rng.getPicked().size() - before));
+			++subRounds;
+		}
+		draws += rng.getPicked().size();
+	}
+	ioAccumulator.totalDraws += draws;
+	return {draws, subRounds};
+}
+
+}// namespace evl::core
@@ -0,0 +1,130 @@
+/**
+ * @file Simulator.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#pragma once
+
+#include "CardRegistry.h"
+#include "Event.h"
+
+#include <array>
+#include <chrono>
+#include <map>
+#include <vector>
+
+namespace evl::core {
+
+/**
+ * @brief Class Simulator: Monte Carlo replay of the rounds of an event.
+ *
+ * The rounds of the event are played many times with generated cards: each sub-round draws numbers until
+ * a card wins (or until one card survives in an inverse round). The runs are spread on a work-stealing
+ * thread pool; each run has its own seed, so the result does not depend on the number of threads.
+ */
+class Simulator {
+public:
+	/// Simulation parameters.
+	struct Options {
+		/// Number of cards in game.
+		size_t cards = 500;
+		/// Number of times the event is played.
+		size_t runs = 1000;
+		/// Seed of the cards and of the draws.
+		uint64_t seed = 0;
+		/// Number of worker threads (0 for the number of hardware threads).
+		size_t threads = 0;
+		/// Time spent per draw.
+		std::chrono::duration<double> drawDuration{10.0};
+		/// Time spent per sub-round outside the draws (winner check, prizes).
+		std::chrono::duration<double> subRoundOverhead{90.0};
+	};
+
+	/// Distribution of a sub-round type.
+	struct TypeStats {
+		/// Number of simulated sub-rounds.
+		size_t samples = 0;
+		/// Number of sub-rounds for each number of draws.
+		std::array<uint64_t, NumberMask::g_maxNumber + 1> drawHistogram{};
+		/// Total of the draws.
+		uint64_t totalDraws = 0;
+		/// Minimal number of draws.
+		uint8_t minDraws = NumberMask::g_maxNumber;
+		/// Maximal number of draws.
+		uint8_t maxDraws = 0;
+		/// Mean number of draws.
+		double meanDraws = 0.0;
+		/// Mean duration.
+		std::chrono::duration<double> meanDuration{0.0};
+		/// Duration not exceeded in 90% of the sub-rounds.
+		std::chrono::duration<double> p90Duration{0.0};
+	};
+
+	/// Result of a simulation.
+	struct Result {
+		/// Distribution per sub-round type.
+		std::map<SubGameRound::Type, TypeStats> types;
+		/// Mean duration of the event.
+		std::chrono::duration<double> meanDuration{0.0};
+		/// Median duration of the event.
+		std::chrono::duration<double> medianDuration{0.0};
+		/// Duration of the event not exceeded in 90% of the runs.
+		std::chrono::duration<double> p90Duration{0.0};
+		/// Number of simulated runs.
+		size_t runs = 0;
+		/// Total number of simulated draws.
+		uint64_t totalDraws = 0;
+		/// Computation time.
+		std::chrono::duration<double> elapsed{0.0};
+	};
+
+	/**
+	 * @brief Constructor.
+	 * @param iEvent The event whose rounds are simulated.
+	 * @param iOptions The simulation parameters.
+	 */
+	Simulator(const Event& iEvent, const Options& iOptions);
+
+	/**
+	 * @brief Run the simulation.
+	 * @return The distributions.
+	 */
+	[[nodiscard]] auto run() const -> Result;
+
+private:
+	/// Simulated round: the sub-round types in play order.
+	struct Round {
+		/// True for an inverse round.
+		bool inverse = false;
+		/// Sub-round types.
+		std::vector<SubGameRound::Type> subRounds;
+	};
+	/// Counters of a worker.
+	struct Accumulator {
+		/// Counters per sub-round type.
+		std::map<SubGameRound::Type, TypeStats> types;
+		/// Total number of draws.
+		uint64_t totalDraws = 0;
+	};
+
+	/**
+	 * @brief Play all the rounds once.
+	 * @param ioCards The cards of the worker.
+	 * @param iRun The run index.
+	 * @param ioAccumulator The counters of the worker.
+	 * @return The number of draws and of sub-rounds played.
+	 */
+	auto playRun(CardRegistry& ioCards, uint64_t iRun, Accumulator& ioAccumulator) const
+			-> std::pair<uint64_t, uint64_t>;
+
+	/// The rounds to play.
+	std::vector<Round> m_rounds;
+	/// The parameters.
+	Options m_options;
+	/// The cards, with their index built.
+	CardRegistry m_cards;
+};
+
+}// namespace evl::core
@@ -9,65 +9,169 @@
 
 #include "Statistics.h"
 
+#include <atomic>
+
 namespace evl::core {
 
+namespace {
+/// Dernière version attribuée à des statistiques.
+std::atomic<uint64_t> g_lastVersion = 0;
+
+/**
+ * @brief Liste croissante des numéros d’un ensemble.
+ * @param iNumbers L’ensemble.
+ * @return Les numéros.
+ */
+auto toPickList(const NumberMask& iNumbers) -> Statistics::pick_list {
+	Statistics::pick_list list;
+	list.reserve(iNumbers.count());
+	for (uint64_t low = iNumbers.low(); low != 0; low &= low - 1)
+		list.push_back(static_cast<uint8_t>(std::countr_zero(low) + 1));
+	for (uint64_t high = iNumbers.high(); high != 0; high &= high - 1)
+		list.push_back(static_cast<uint8_t>(std::countr_zero(high) + 65));
+	return list;
+}
+
+void insertSorted(Statistics::pick_list& ioList, const uint8_t iNumber) {
+	ioList.insert(std::ranges::upper_bound(ioList, iNumber), iNumber);
+}
+
+void eraseSorted(Statistics::pick_list& ioList, const uint8_t iNumber) {
+	if (const auto it = std::ranges::lower_bound(ioList, iNumber); it != ioList.end() && *it == iNumber)
+		ioList.erase(it);
+}
+}// namespace
+
 void Statistics::pushRound(const GameRound& iRound) {
 	// update round (only if done)
-	if (iRound.getStatus() == GameRound::Status::Done) {
-		const duration dur = iRound.getEnding() - iRound.getStarting();
-		if (dur > roundLongest)
-			roundLongest = dur;
-		if (dur < roundShortest)
-			roundShortest = dur;
-		roundAverage = (roundAverage * m_nbRounds + dur) / (m_nbRounds + 1);
-		const int nbDraw = static_cast<int>(iRound.drawsCount());
-		if (nbDraw > roundMostNb)
-			roundMostNb = nbDraw;
-		if (nbDraw < roundLessNb || roundLessNb == 0)
-			roundLessNb = nbDraw;
-		roundAverageNb = (roundAverageNb * m_nbRounds + nbDraw) / (m_nbRounds + 1);
-		++m_nbRounds;
-	}
-	if (roundShortest == duration::max())
-		roundShortest = duration::zero();
+	if (iRound.getStatus() == GameRound::Status::Done)
+		pushFinishedRound(iRound);
 	// update subrounds
 	for (auto sub = iRound.beginSubRound(); sub != iRound.endSubRound(); ++sub) {
 		if (sub->getStatus() != SubGameRound::Status::Done)
 			break;
-		const duration dur = sub->getEnding() - sub->getStarting();
-		if (dur > subRoundLongest)
-			subRoundLongest = dur;
-		if (dur < subRoundShortest)
-			subRoundShortest = dur;
-		subRoundAverage = (subRoundAverage * m_nbSubRounds + dur) / (m_nbSubRounds + 1);
-		const int nbDraw = static_cast<int>(sub->getDraws().size());
-		if (nbDraw > subRoundMostNb)
-			subRoundMostNb = nbDraw;
-		if (nbDraw < subRoundLessNb || subRoundLessNb == 0)
-			subRoundLessNb = nbDraw;
-		subRoundAverageNb = (subRoundAverageNb * m_nbSubRounds + nbDraw) / (m_nbSubRounds + 1);
-		++m_nbSubRounds;
+		pushSubRound(*sub);
 	}
-	if (subRoundShortest == duration::max())
-		subRoundShortest = duration::zero();
 	// update tirages
-	if (m_pickCounts.size() != 90)
-		m_pickCounts.resize(90);
-	for (const auto draw: iRound.getAllDraws()) m_pickCounts[draw - 1]++;
+	for (const auto draw: iRound.getDrawLog().draws())
+		if (draw > 0 && draw <= m_pickCounts.size())
+			m_pickCounts[draw - 1]++;
+	rebuildPickLists();
+	touch();
+}
+
+void Statistics::pushDraw(const uint8_t iNumber) {
+	if (iNumber == 0 || iNumber > m_pickCounts.size())
+		return;
+	addPick(iNumber);
+	touch();
+}
+
+void Statistics::popDraw(const uint8_t iNumber) {
+	if (iNumber == 0 || iNumber > m_pickCounts.size() || m_pickCounts[iNumber - 1] == 0)
+		return;
+	removePick(iNumber);
+	touch();
+}
+
+void Statistics::pushSubRound(const SubGameRound& iSubRound) {
+	const duration dur = iSubRound.getEnding() - iSubRound.getStarting();
+	if (dur > subRoundLongest)
+		subRoundLongest = dur;
+	if (dur < subRoundShortest || m_nbSubRounds == 0)
+		subRoundShortest = dur;
+	subRoundAverage = (subRoundAverage * m_nbSubRounds + dur) / (m_nbSubRounds + 1);
+	const int nbDraw = static_cast<int>(iSubRound.getDraws().size());
+	if (nbDraw > subRoundMostNb)
+		subRoundMostNb = nbDraw;
+	if (nbDraw < subRoundLessNb || subRoundLessNb == 0)
+		subRoundLessNb = nbDraw;
+	subRoundAverageNb = (subRoundAverageNb * m_nbSubRounds + nbDraw) / (m_nbSubRounds + 1);
+	++m_nbSubRounds;
+	touch();
+}
+
+void Statistics::pushFinishedRound(const GameRound& iRound) {
+	const duration dur = iRound.getEnding() - iRound.getStarting();
+	if (dur > roundLongest)
+		roundLongest = dur;
+	if (dur < roundShortest || m_nbRounds == 0)
+		roundShortest = dur;
+	roundAverage = (roundAverage * m_nbRounds + dur) / (m_nbRounds + 1);
+	const int nbDraw = static_cast<int>(iRound.drawsCount());
+	if (nbDraw > roundMostNb)
+		roundMostNb = nbDraw;
+	if (nbDraw < roundLessNb || roundLessNb == 0)
+		roundLessNb = nbDraw;
+	roundAverageNb = (roundAverageNb * m_nbRounds + nbDraw) / (m_nbRounds + 1);
+	++m_nbRounds;
+	touch();
+}
+
+void Statistics::clear() {
+	const uint64_t version = m_version;
+	*this = Statistics{};
+	m_version = version;
+	touch();
+}
+
+void Statistics::rebuildPickLists() {
 	lessPickNb = *std::ranges::min_element(m_pickCounts);
 	mostPickNb = *std::ranges::max_element(m_pickCounts);
-	lessPickList.clear();
-	mostPickList.clear();
+	m_pickBuckets.assign(static_cast<size_t>(mostPickNb) + 1, {});
 	uint8_t idx = 1;
-	for (const auto& p: m_pickCounts) {
-		if (std::cmp_equal(p, lessPickNb))
-			lessPickList.push_back(idx);
-		if (std::cmp_equal(p, mostPickNb))
-			mostPickList.push_back(idx);
-		++idx;
+	for (const auto& p: m_pickCounts) m_pickBuckets[static_cast<size_t>(p)].set(idx++);
+	lessPickList = toPickList(m_pickBuckets[static_cast<size_t>(lessPickNb)]);
+	mostPickList = toPickList(m_pickBuckets[static_cast<size_t>(mostPickNb)]);
+}
+
+void Statistics::addPick(const uint8_t iNumber) {
+	if (m_pickBuckets.empty())
+		rebuildPickLists();
+	const int count = m_pickCounts[iNumber - 1]++;
+	m_pickBuckets[static_cast<size_t>(count)].reset(iNumber);
+	if (static_cast<size_t>(count) + 1 == m_pickBuckets.size())
+		m_pickBuckets.emplace_back();
+	m_pickBuckets[static_cast<size_t>(count) + 1].set(iNumber);
+	if (count + 1 > mostPickNb) {
+		mostPickNb = count + 1;
+		mostPickList = {iNumber};
+	} else if (count + 1 == mostPickNb) {
+		insertSorted(mostPickList, iNumber);
+	}
+	// le minimum ne monte que quand son dernier numéro est tiré
+	if (count == lessPickNb) {
+		eraseSorted(lessPickList, iNumber);
+		if (lessPickList.empty()) {
+			lessPickNb = count + 1;
+			lessPickList = toPickList(m_pickBuckets[static_cast<size_t>(lessPickNb)]);
+		}
+	}
+}
+
+void Statistics::removePick(const uint8_t iNumber) {
+	if (m_pickBuckets.empty())
+		rebuildPickLists();
+	const int count = m_pickCounts[iNumber - 1]--;
+	m_pickBuckets[static_cast<size_t>(count)].reset(iNumber);
+	m_pickBuckets[static_cast<size_t>(count) - 1].set(iNumber);
+	if (count - 1 < lessPickNb) {
+		lessPickNb = count - 1;
+		lessPickList = {iNumber};
+	} else if (count - 1 == lessPickNb) {
+		insertSorted(lessPickList, iNumber);
+	}
+	// le maximum ne descend que quand son dernier numéro est annulé
+	if (count == mostPickNb) {
+		eraseSorted(mostPickList, iNumber);
+		if (mostPickList.empty()) {
+			mostPickNb = count - 1;
+			mostPickList = toPickList(m_pickBuckets[static_cast<size_t>(mostPickNb)]);
+		}
 	}
 }
 
+void Statistics::touch() { m_version = ++g_lastVersion; }
 
 auto Statistics::lessPickStr() const -> std::string {
 	if (lessPickList.empty())
@@ -8,8 +8,11 @@
 
 #pragma once
 #include "GameRound.h"
+#include "NumberMask.h"
 #include "timeFunctions.h"
 
+#include <array>
+
 namespace evl::core {
 
 /**
@@ -44,8 +47,47 @@ public:
 	 */
 	~Statistics() = default;
 
+	/**
+	 * @brief Ajoute une partie complète : ses tirages, ses manches finies et sa durée si elle est finie.
+	 * @param iRound La partie.
+	 */
 	void pushRound(const GameRound& iRound);
 
+	/**
+	 * @brief Ajoute un numéro tiré.
+	 * @param iNumber Le numéro.
+	 */
+	void pushDraw(uint8_t iNumber);
+
+	/**
+	 * @brief Retire un numéro tiré (annulation).
+	 * @param iNumber Le numéro.
+	 */
+	void popDraw(uint8_t iNumber);
+
+	/**
+	 * @brief Ajoute la durée et le nombre de tirages d’une manche finie.
+	 * @param iSubRound La manche.
+	 */
+	void pushSubRound(const SubGameRound& iSubRound);
+
+	/**
+	 * @brief Ajoute la durée et le nombre de tirages d’une partie finie.
+	 * @param iRound La partie.
+	 */
+	void pushFinishedRound(const GameRound& iRound);
+
+	/**
+	 * @brief Remet les statistiques à zéro.
+	 */
+	void clear();
+
+	/**
+	 * @brief Renvoie la version des statistiques, unique parmi toutes les instances et changée à chaque mise à jour.
+	 * @return La version.
+	 */
+	[[nodiscard]] auto getVersion() const -> uint64_t { return m_version; }
+
 	using pick_list = std::vector<uint8_t>;
 
 	int lessPickNb = 0;
@@ -65,16 +107,38 @@ public:
 	double subRoundAverageNb = 0.0;
 
 	duration roundLongest = duration::zero();
-	duration roundShortest = duration::max();
+	duration roundShortest = duration::zero();
 	duration roundAverage = duration::zero();
 	duration subRoundLongest = duration::zero();
-	duration subRoundShortest = duration::max();
+	duration subRoundShortest = duration::zero();
 	duration subRoundAverage = duration::zero();
 
 private:
+	/**
+	 * @brief Recalcule entièrement les listes des numéros les moins et les plus tirés.
+	 */
+	void rebuildPickLists();
+	/**
+	 * @brief Compte un tirage d’un numéro et met à jour les listes sans parcourir les compteurs.
+	 * @param iNumber Le numéro (valide).
+	 */
+	void addPick(uint8_t iNumber);
+	/**
+	 * @brief Décompte un tirage d’un numéro et met à jour les listes sans parcourir les compteurs.
+	 * @param iNumber Le numéro (valide et déjà tiré).
+	 */
+	void removePick(uint8_t iNumber);
+	/**
+	 * @brief Marque les statistiques comme modifiées.
+	 */
+	void touch();
+
 	int m_nbRounds = 0;
 	int m_nbSubRounds = 0;
-	pick_list m_pickCounts;
+	std::array<int, 90> m_pickCounts{};
+	/// Numéros par nombre de tirages (indice : le nombre), vide tant que les listes ne sont pas construites.
+	std::vector<NumberMask> m_pickBuckets;
+	uint64_t m_version = 0;
 };
 
 }// namespace evl::core
@@ -9,7 +9,10 @@
 
 #include "SubGameRound.h"
 
+#include "EventFile.h"
 #include "Log.h"
+#include "Migration.h"
+#include "TextStream.h"
 #include "utilities.h"
 
 #include <utility>
@@ -47,10 +50,13 @@ auto SubGameRound::getStatusStr() const -> std::string {
 	return "inconnu";
 }
 
-void SubGameRound::nextStatus() {
+void SubGameRound::nextStatus(const time_point& iTime) {
 	switch (m_status) {
 		case Status::Ready:
-			m_start = clock::now();
+			m_start = iTime;
+			// pas d’allocation pendant les tirages
+			m_draws.reserve(NumberMask::g_maxNumber);
+			m_drawDelays.reserve(NumberMask::g_maxNumber);
 			if (!m_prices.empty())
 				m_status = Status::PreScreen;
 			else
@@ -62,7 +68,7 @@ void SubGameRound::nextStatus() {
 		case Status::Running:
 			if (!m_winner.empty()) {
 				m_status = Status::Done;
-				m_end = clock::now();
+				m_end = iTime;
 			}
 			break;
 		case Status::Done:// the last status!
@@ -73,44 +79,100 @@ void SubGameRound::nextStatus() {
 	}
 }
 
+void SubGameRound::addPickedNumber(const uint8_t& iNumber, const time_point& iTime) {
+	if (m_status != Status::Running)
+		return;
+	const auto now = std::chrono::duration_cast<std::chrono::milliseconds>(iTime - m_start).count();
+	const uint64_t elapsed = static_cast<uint64_t>(std::max<int64_t>(now, 0));
+	const uint64_t delay = elapsed > m_elapsed ? elapsed - m_elapsed : 0;
+	m_draws.push_back(iNumber);
+	m_drawDelays.push_back(static_cast<uint32_t>(std::min<uint64_t>(delay, std::numeric_limits<uint32_t>::max())));
+	m_elapsed += m_drawDelays.back();
+}
+
+void SubGameRound::removeLastPick() {
+	if (m_status != Status::Running || m_draws.empty())
+		return;
+	m_draws.pop_back();
+	m_elapsed -= m_drawDelays.back();
+	m_drawDelays.pop_back();
+}
+
+void SubGameRound::restore(const Status iStatus, draws_type iDraws) {
+	m_status = iStatus;
+	m_draws = std::move(iDraws);
+	m_drawDelays.clear();
+	syncDrawDelays();
+}
+
+auto SubGameRound::getDrawTime(const draws_type::size_type iIndex) const -> time_point {
+	const auto count = std::min(iIndex + 1, m_drawDelays.size());
+	const auto end = std::next(m_drawDelays.begin(), static_cast<std::ptrdiff_t>(count));
+	return m_start + std::chrono::milliseconds(std::accumulate(m_drawDelays.begin(), end, uint64_t{0}));
+}
+
+void SubGameRound::syncDrawDelays() {
+	m_drawDelays.resize(m_draws.size(), 0);
+	m_elapsed = std::accumulate(m_drawDelays.begin(), m_drawDelays.end(), uint64_t{0});
+}
+
 void SubGameRound::read(std::istream& iBs, const int iFileVersion) {
-	if (std::cmp_greater(iFileVersion, getSaveVersion()))
+	if (std::cmp_greater(iFileVersion, getSaveVersion())) {
+		iBs.setstate(std::ios::failbit);
 		return;
+	}
+	const auto version = static_cast<uint16_t>(iFileVersion);
+	const bool results = hasFormatChange(version, FormatChange::SubRoundResults);
 	iBs.read(reinterpret_cast<char*>(&m_type), sizeof(Type));
-	if (iFileVersion >= 4) {
+	m_status = Status::Ready;
+	if (results) {
 		iBs.read(reinterpret_cast<char*>(&m_status), sizeof(Status));
 	}
-	if (iFileVersion < 4) {//----UNCOVER----
-		uint32_t readTmp = 0;//----UNCOVER----
-		iBs.read(reinterpret_cast<char*>(&readTmp), sizeof(uint32_t));//----UNCOVER----
-		if (readTmp != 0)//----UNCOVER----
-			m_winner = "toto";//----UNCOVER----
-		else//----UNCOVER----
-			m_winner = "";//----UNCOVER----
-	} else {//----UNCOVER----
+	if (m_type > Type::Inverse || m_status > Status::Done) {
+		m_type = Type::Invalid;
+		m_status = Status::Invalid;
+		iBs.setstate(std::ios::failbit);
+	}
+	m_draws.clear();
+	if (results) {
 		iBs.read(reinterpret_cast<char*>(&m_pricesValue), sizeof(double));
-		std::string::size_type l = 0;
-		iBs.read(reinterpret_cast<char*>(&l), sizeof(std::string::size_type));
-		m_winner.resize(l);
-		for (std::string::size_type i = 0; i < l; i++)
-			iBs.read(reinterpret_cast<char*>(&m_winner[i]), sizeof(std::string::value_type));
-	}
-	std::string::size_type l = 0;
-	iBs.read(reinterpret_cast<char*>(&l), sizeof(std::string::size_type));
-	m_prices.resize(l);
-	for (std::string::size_type i = 0; i < l; i++)
-		iBs.read(reinterpret_cast<char*>(&m_prices[i]), sizeof(std::string::value_type));
-	if (iFileVersion > 3) {
+		eventFile::readLegacyString(iBs, m_winner);
+	} else {
+		// seul un drapeau était enregistré, le statut et les tirages sont convertis par la partie
+		uint32_t hasWinner = 0;
+		iBs.read(reinterpret_cast<char*>(&hasWinner), sizeof(uint32_t));
+		m_pricesValue = 0;
+		m_winner = hasWinner != 0 ? std::string(g_legacyWinner) : std::string();
+	}
+	eventFile::readLegacyString(iBs, m_prices);
+	if (results) {
 		draws_type::size_type ld = 0;
 		iBs.read(reinterpret_cast<char*>(&ld), sizeof(draws_type::size_type));
+		if (!iBs || ld > NumberMask::g_maxNumber) {
+			iBs.setstate(std::ios::failbit);
+			ld = 0;
+		}
 		m_draws.resize(ld);
-		for (draws_type::size_type i = 0; i < ld; ++i)
-			iBs.read(reinterpret_cast<char*>(&(m_draws[i])), sizeof(draws_type::value_type));
+		iBs.read(reinterpret_cast<char*>(m_draws.data()),
+				 static_cast<std::streamsize>(ld * sizeof(draws_type::value_type)));
 	}
-	if (iFileVersion > 5) {
+	if (hasFormatChange(version, FormatChange::SubRoundTimes)) {
 		iBs.read(reinterpret_cast<char*>(&m_start), sizeof(m_start));
 		iBs.read(reinterpret_cast<char*>(&m_end), sizeof(m_end));
 	}
+	m_drawDelays.clear();
+	if (hasFormatChange(version, FormatChange::DrawDelays)) {
+		delays_type::size_type ld = 0;
+		iBs.read(reinterpret_cast<char*>(&ld), sizeof(delays_type::size_type));
+		if (ld == m_draws.size()) {
+			m_drawDelays.resize(ld);
+			iBs.read(reinterpret_cast<char*>(m_drawDelays.data()),
+					 static_cast<std::streamsize>(ld * sizeof(delays_type::value_type)));
+		} else {
+			iBs.setstate(std::ios::failbit);
+		}
+	}
+	syncDrawDelays();
 }
 
 void SubGameRound::write(std::ostream& iBs) const {
@@ -118,22 +180,126 @@ void SubGameRound::write(std::ostream& iBs) const {
 	iBs.write(reinterpret_cast<const char*>(&m_status), sizeof(Status));
 	iBs.write(reinterpret_cast<const char*>(&m_pricesValue), sizeof(double));
 	//---------------
-	std::string::size_type l0 = m_winner.size();
-	iBs.write(reinterpret_cast<char*>(&l0), sizeof(std::string::size_type));
-	for (std::string::size_type i = 0; i < l0; i++)
-		iBs.write(reinterpret_cast<const char*>(&m_winner[i]), sizeof(std::string::value_type));
-	//---------------
-	std::string::size_type l = m_prices.size();
-	iBs.write(reinterpret_cast<char*>(&l), sizeof(std::string::size_type));
-	for (std::string::size_type i = 0; i < l; i++)
-		iBs.write(reinterpret_cast<const char*>(&m_prices[i]), sizeof(std::string::value_type));
+	eventFile::writeLegacyString(iBs, m_winner);
+	eventFile::writeLegacyString(iBs, m_prices);
 	// --------------
-	draws_type::size_type ld = m_draws.size();
+	const draws_type::size_type ld = m_draws.size();
 	iBs.write(reinterpret_cast<const char*>(&ld), sizeof(draws_type::size_type));
-	for (draws_type::size_type i = 0; i < ld; ++i)
-		iBs.write(reinterpret_cast<const char*>(&(m_draws[i])), sizeof(draws_type::value_type));
+	iBs.write(reinterpret_cast<const char*>(m_draws.data()),
+			  static_cast<std::streamsize>(ld * sizeof(draws_type::value_type)));
 	iBs.write(reinterpret_cast<const char*>(&m_start), sizeof(m_start));
 	iBs.write(reinterpret_cast<const char*>(&m_end), sizeof(m_end));
+	// --------------
+	const delays_type::size_type lt = m_drawDelays.size();
+	iBs.write(reinterpret_cast<const char*>(&lt), sizeof(delays_type::size_type));
+	iBs.write(reinterpret_cast<const char*>(m_drawDelays.data()),
+			  static_cast<std::streamsize>(lt * sizeof(delays_type::value_type)));
+}
+
+void SubGameRound::readChunk(const EventFileView& iView, const uint32_t iIndex) {
+	const auto sub = iView.subRound(iIndex);
+	m_type = static_cast<Type>(sub.type);
+	m_status = static_cast<Status>(sub.status);
+	m_pricesValue = sub.value;
+	m_winner = sub.winner;
+	m_prices = sub.prices;
+	m_start = sub.start;
+	m_end = sub.end;
+	m_draws.assign(sub.draws.begin(), sub.draws.end());
+	m_drawDelays.resize(sub.draws.size());
+	for (size_t i = 0; i < m_drawDelays.size(); ++i) m_drawDelays[i] = sub.delay(i);
+	syncDrawDelays();
+}
+
+void SubGameRound::writeChunk(EventFileWriter& ioWriter) const {
+	constexpr auto record = eventFile::Chunk::SubRounds;
+	ioWriter.put(record, static_cast<uint8_t>(m_type));
+	ioWriter.put(record, static_cast<uint8_t>(m_status));
+	ioWriter.putDouble(record, m_pricesValue);
+	ioWriter.putString(record, m_winner);
+	ioWriter.putString(record, m_prices);
+	ioWriter.putTime(record, m_start);
+	ioWriter.putTime(record, m_end);
+	ioWriter.put(record, static_cast<uint32_t>(ioWriter.size(eventFile::Chunk::Draws)));
+	ioWriter.put(record, static_cast<uint32_t>(m_draws.size()));
+	ioWriter.putBytes(eventFile::Chunk::Draws, m_draws);
+	// the delays are kept in sync with the draws
+	for (size_t i = 0; i < m_draws.size(); ++i)
+		ioWriter.put(eventFile::Chunk::Delays, i < m_drawDelays.size() ? m_drawDelays[i] : uint32_t{0});
+}
+
+auto SubGameRound::readText(TextReader& ioReader) -> bool {
+	if (!ioReader.enterMap())
+		return false;
+	std::string key;
+	std::string text;
+	while (ioReader.nextKey(key)) {
+		if (key == "type" || key == "status") {
+			if (!ioReader.readString(text))
+				break;
+			if (key == "type") {
+				if (const auto result = std::ranges::find_if(
+							g_typeConvert, [&text](const auto& iItem) -> auto { return iItem.second == text; });
+					result != g_typeConvert.end())
+					m_type = result->first;
+			} else if (const auto result = std::ranges::find_if(
+							   g_statusConvert, [&text](const auto& iItem) -> auto { return iItem.second == text; });
+					   result != g_statusConvert.end()) {
+				m_status = result->first;
+			}
+		} else if (key == "prices") {
+			ioReader.readString(m_prices);
+		} else if (key == "value") {
+			ioReader.readDouble(m_pricesValue);
+		} else if (key == "winner") {
+			ioReader.readString(m_winner);
+		} else if (key == "start") {
+			ioReader.readTime(m_start);
+		} else if (key == "end") {
+			ioReader.readTime(m_end);
+		} else if (key == "draws") {
+			m_draws.clear();
+			if (!ioReader.enterSeq())
+				break;
+			while (ioReader.nextItem()) {
+				if (!ioReader.readInteger(m_draws.emplace_back()))
+					break;
+				if (!NumberMask::isValid(m_draws.back()))
+					ioReader.fail(std::format("tirage invalide: {}", m_draws.back()));
+			}
+		} else if (key == "delays") {
+			m_drawDelays.clear();
+			if (!ioReader.enterSeq())
+				break;
+			while (ioReader.nextItem())
+				if (!ioReader.readInteger(m_drawDelays.emplace_back()))
+					break;
+		} else {
+			ioReader.skip();
+		}
+	}
+	syncDrawDelays();
+	return !ioReader.hasFailed();
+}
+
+void SubGameRound::writeText(TextWriter& ioWriter) const {
+	ioWriter.beginMap();
+	ioWriter.putString("type", getTypeStr());
+	ioWriter.putString("status", getStatusStr());
+	ioWriter.putString("prices", m_prices);
+	ioWriter.putDouble("value", m_pricesValue);
+	ioWriter.putString("winner", m_winner);
+	ioWriter.putTime("start", m_start);
+	ioWriter.putTime("end", m_end);
+	ioWriter.key("draws");
+	ioWriter.beginSeq(true);
+	for (const auto& draw: m_draws) ioWriter.integer(draw);
+	ioWriter.endSeq();
+	ioWriter.key("delays");
+	ioWriter.beginSeq(true);
+	for (const auto& delay: m_drawDelays) ioWriter.integer(delay);
+	ioWriter.endSeq();
+	ioWriter.endMap();
 }
 
 auto SubGameRound::toJson() const -> Json::Value {
@@ -145,6 +311,9 @@ auto SubGameRound::toJson() const -> Json::Value {
 	Json::Value drawsArray(Json::arrayValue);
 	for (const auto& d: m_draws) { drawsArray.append(d); }
 	value["draws"] = drawsArray;
+	Json::Value delaysArray(Json::arrayValue);
+	for (const auto& d: m_drawDelays) { delaysArray.append(d); }
+	value["delays"] = delaysArray;
 	return value;
 }
 
@@ -174,6 +343,15 @@ void SubGameRound::fromJson(const Json::Value& iJson) {
 			}
 		}
 	}
+	m_drawDelays.clear();
+	if (const auto val = iJson.get("delays", ""); val.isArray()) {
+		for (const auto& item: val) {
+			if (item.isUInt()) {
+				m_drawDelays.push_back(item.asUInt());
+			}
+		}
+	}
+	syncDrawDelays();
 }
 
 auto SubGameRound::toYaml() const -> YAML::Node {
@@ -185,6 +363,9 @@ auto SubGameRound::toYaml() const -> YAML::Node {
 	YAML::Node drawsNode;
 	for (const auto& d: m_draws) { drawsNode.push_back(d); }
 	node["draws"] = drawsNode;
+	YAML::Node delaysNode;
+	for (const auto& d: m_drawDelays) { delaysNode.push_back(d); }
+	node["delays"] = delaysNode;
 	return node;
 }
 
@@ -199,6 +380,9 @@ void SubGameRound::fromYaml(const YAML::Node& iNode) {
 	m_winner = iNode["winner"].as<std::string>();
 	m_draws.clear();
 	for (const auto& item: iNode["draws"]) { m_draws.push_back(item.as<uint8_t>()); }
+	m_drawDelays.clear();
+	for (const auto& item: iNode["delays"]) { m_drawDelays.push_back(item.as<uint32_t>()); }
+	syncDrawDelays();
 }
 
 }// namespace evl::core
@@ -8,11 +8,17 @@
 #pragma once
 
 #include "Log.h"
+#include "NumberMask.h"
 #include "Serializable.h"
 #include "timeFunctions.h"
 
 namespace evl::core {
 
+class EventFileView;
+class EventFileWriter;
+class TextReader;
+class TextWriter;
+
 /**
  * @brief Classe définissant une sous partie.
  */
@@ -20,6 +26,8 @@ class SubGameRound final : public Serializable {
 public:
 	/// Le type utilisé pour représenter la liste des tirages.
 	using draws_type = std::vector<uint8_t>;
+	/// Le type utilisé pour représenter les délais des tirages (en millisecondes).
+	using delays_type = std::vector<uint32_t>;
 	/**
 	 * @brief Liste des types de sous-parties connus.
 	 */
@@ -107,25 +115,28 @@ public:
 
 	/**
 	 * @brief Advance to the next status if possible
+	 * @param iTime Date et heure du changement.
 	 */
-	void nextStatus();
+	void nextStatus(const time_point& iTime = clock::now());
 
 	/**
 	 * @brief Ajoute le numéro dans la liste des numéros tirés
 	 * @param iNumber Numéro à ajouter
+	 * @param iTime Date et heure du tirage.
 	 */
-	void addPickedNumber(const uint8_t& iNumber) {
-		if (m_status == Status::Running)
-			m_draws.push_back(iNumber);
-	}
+	void addPickedNumber(const uint8_t& iNumber, const time_point& iTime = clock::now());
 
 	/**
 	 * @brief Supprime le dernier tirage.
 	 */
-	void removeLastPick() {
-		if (m_status == Status::Running && !m_draws.empty())
-			m_draws.pop_back();
-	}
+	void removeLastPick();
+
+	/**
+	 * @brief Remplace le statut et les tirages (conversion d’un ancien format), les délais des tirages valent 0.
+	 * @param iStatus Le statut.
+	 * @param iDraws Les tirages.
+	 */
+	void restore(Status iStatus, draws_type iDraws);
 
 	/**
 	 * @brief Accès à la liste des tirages
@@ -133,6 +144,22 @@ public:
 	 */
 	[[nodiscard]] auto getDraws() const -> const draws_type& { return m_draws; }
 
+	/**
+	 * @brief Accès aux délais des tirages, alignés sur la liste des tirages.
+	 *
+	 * Chaque délai est en millisecondes depuis le tirage précédent, ou depuis le début de la sous-partie pour le
+	 * premier. Les fichiers antérieurs à la version 8 n’ont pas de délais : ils valent 0.
+	 * @return La liste des délais
+	 */
+	[[nodiscard]] auto getDrawDelays() const -> const delays_type& { return m_drawDelays; }
+
+	/**
+	 * @brief Renvoie la date et heure d’un tirage.
+	 * @param iIndex L’index du tirage
+	 * @return La date et heure du tirage
+	 */
+	[[nodiscard]] auto getDrawTime(draws_type::size_type iIndex) const -> time_point;
+
 	/**
 	 * @brief Renvoie si la liste des tirages est vide
 	 * @return True si pas de tirage
@@ -154,11 +181,12 @@ public:
 	/**
 	 * @brief Défini le numéro du gagnant
 	 * @param iWinner Le numéro de la grille gagnante
+	 * @param iTime Date et heure de la fin de la sous-partie.
 	 */
-	void setWinner(const std::string& iWinner) {
+	void setWinner(const std::string& iWinner, const time_point& iTime = clock::now()) {
 		if (m_status == Status::Running) {
 			m_winner = iWinner;
-			nextStatus();
+			nextStatus(iTime);
 		}
 	}
 
@@ -175,6 +203,32 @@ public:
 	 */
 	void write(std::ostream& iBs) const override;
 
+	/**
+	 * @brief Lecture depuis un fichier par blocs.
+	 * @param iView Le fichier.
+	 * @param iIndex L’index de la sous-partie dans le fichier.
+	 */
+	void readChunk(const EventFileView& iView, uint32_t iIndex);
+
+	/**
+	 * @brief Écriture dans un fichier par blocs.
+	 * @param ioWriter Le fichier en construction.
+	 */
+	void writeChunk(EventFileWriter& ioWriter) const;
+
+	/**
+	 * @brief Lecture en flux depuis un document JSON ou YAML.
+	 * @param ioReader Le lecteur du document.
+	 * @return Faux si le document est invalide.
+	 */
+	auto readText(TextReader& ioReader) -> bool;
+
+	/**
+	 * @brief Écriture en flux dans un document JSON ou YAML.
+	 * @param ioWriter Le rédacteur du document.
+	 */
+	void writeText(TextWriter& ioWriter) const;
+
 	/**
 	 * @brief Écriture dans un json.
 	 * @return Le json à remplir
@@ -246,6 +300,15 @@ private:
 	std::string m_winner;
 	/// La liste des numéros tirés.
 	draws_type m_draws;
+	/// Les délais entre les tirages (en millisecondes).
+	delays_type m_drawDelays;
+	/// Le temps écoulé entre le début de la sous-partie et le dernier tirage (en millisecondes).
+	uint64_t m_elapsed = 0;
+
+	/**
+	 * @brief Aligne les délais sur les tirages (0 pour les délais inconnus) et recalcule le temps écoulé.
+	 */
+	void syncDrawDelays();
 	/// La date et heure de début de partie
 	time_point m_start;
 
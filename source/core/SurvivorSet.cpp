@@ -0,0 +1,171 @@
+/**
+ * @file SurvivorSet.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "SurvivorSet.h"
+
+namespace evl::core {
+
+namespace {
+/// Number of words in a bitmap container.
+constexpr size_t g_bitmapWords = 1024;
+/// Number of values in a container.
+constexpr uint32_t g_containerRange = 65536;
+
+auto highBits(const SurvivorSet::value_type iValue) -> uint16_t { return static_cast<uint16_t>(iValue >> 16U); }
+auto lowBits(const SurvivorSet::value_type iValue) -> uint16_t { return static_cast<uint16_t>(iValue & 0xFFFFU); }
+auto bitOf(const uint16_t iLow) -> uint64_t { return uint64_t{1} << (iLow & 63U); }
+}// namespace
+
+void SurvivorSet::Container::toBitmap() {
+	bitmap.assign(g_bitmapWords, 0);
+	for (const auto low: array) bitmap[low >> 6U] |= bitOf(low);
+	array.clear();
+	array.shrink_to_fit();
+}
+
+void SurvivorSet::Container::toArray() {
+	array.clear();
+	array.reserve(cardinality);
+	for (size_t word = 0; word < g_bitmapWords; ++word) {
+		uint64_t bits = bitmap[word];
+		while (bits != 0) {
+			array.push_back(static_cast<uint16_t>(word * 64 + static_cast<size_t>(std::countr_zero(bits))));
+			bits &= bits - 1;
+		}
+	}
+	bitmap.clear();
+	bitmap.shrink_to_fit();
+}
+
+void SurvivorSet::fill(const value_type iCount) {
+	clear();
+	for (uint32_t start = 0; start < iCount; start += g_containerRange) {
+		Container& container = m_containers.emplace_back();
+		container.key = highBits(start);
+		container.cardinality = std::min(g_containerRange, iCount - start);
+		if (container.cardinality <= g_arrayMaxSize) {
+			container.array.resize(container.cardinality);
+			std::iota(container.array.begin(), container.array.end(), uint16_t{0});
+			continue;
+		}
+		container.bitmap.assign(g_bitmapWords, 0);
+		const size_t fullWords = container.cardinality / 64;
+		std::fill_n(container.bitmap.begin(), fullWords, ~uint64_t{0});
+		if (const uint32_t rest = container.cardinality % 64; rest != 0)
+			container.bitmap[fullWords] = (uint64_t{1} << rest) - 1;
+	}
+	m_size = iCount;
+}
+
+void SurvivorSet::clear() {
+	m_containers.clear();
+	m_size = 0;
+}
+
+auto SurvivorSet::findContainer(const uint16_t iKey) -> std::vector<Container>::iterator {
+	return std::ranges::lower_bound(m_containers, iKey, {}, &Container::key);
+}
+
+auto SurvivorSet::findContainer(const uint16_t iKey) const -> std::vector<Container>::const_iterator {
+	return std::ranges::lower_bound(m_containers, iKey, {}, &Container::key);
+}
+
+auto SurvivorSet::add(const value_type iValue) -> bool {
+	const uint16_t key = highBits(iValue);
+	const uint16_t low = lowBits(iValue);
+	auto container = findContainer(key);
+	if (container == m_containers.end() || container->key != key) {
+		container = m_containers.insert(container, Container{.key = key, .cardinality = 0, .array = {}, .bitmap = {}});
+	}
+	if (container->isBitmap()) {
+		uint64_t& word = container->bitmap[low >> 6U];
+		if ((word & bitOf(low)) != 0)
+			return false;
+		word |= bitOf(low);
+	} else {
+		const auto pos = std::ranges::lower_bound(container->array, low);
+		if (pos != container->array.end() && *pos == low)
+			return false;
+		container->array.insert(pos, low);
+	}
+	++container->cardinality;
+	++m_size;
+	if (!container->isBitmap() && container->cardinality > g_arrayMaxSize)
+		container->toBitmap();
+	return true;
+}
+
+auto SurvivorSet::remove(const value_type iValue) -> bool {
+	const uint16_t key = highBits(iValue);
+	const uint16_t low = lowBits(iValue);
+	const auto container = findContainer(key);
+	if (container == m_containers.end() || container->key != key)
+		return false;
+	if (container->isBitmap()) {
+		uint64_t& word = container->bitmap[low >> 6U];
+		if ((word & bitOf(low)) == 0)
+			return false;
+		word &= ~bitOf(low);
+	} else {
+		const auto pos = std::ranges::lower_bound(container->array, low);
+		if (pos == container->array.end() || *pos != low)
+			return false;
+		container->array.erase(pos);
+	}
+	--container->cardinality;
+	--m_size;
+	if (container->cardinality == 0)
+		m_containers.erase(container);
+	else if (container->isBitmap() && container->cardinality <= g_arrayMaxSize)
+		container->toArray();
+	return true;
+}
+
+auto SurvivorSet::contains(const value_type iValue) const -> bool {
+	const uint16_t key = highBits(iValue);
+	const uint16_t low = lowBits(iValue);
+	const auto container = findContainer(key);
+	if (container == m_containers.end() || container->key != key)
+		return false;
+	if (container->isBitmap())
+		return (container->bitmap[low >> 6U] & bitOf(low)) != 0;
+	return std::ranges::binary_search(container->array, low);
+}
+
+auto SurvivorSet::toVector(const size_t iLimit) const -> std::vector<value_type> {
+	std::vector<value_type> result;
+	result.reserve(std::min(iLimit, m_size));
+	for (const auto& container: m_containers) {
+		const value_type base = value_type{container.key} << 16U;
+		if (!container.isBitmap()) {
+			for (const auto low: container.array) {
+				if (result.size() >= iLimit)
+					return result;
+				result.push_back(base | low);
+			}
+			continue;
+		}
+		for (size_t word = 0; word < g_bitmapWords; ++word) {
+			uint64_t bits = container.bitmap[word];
+			while (bits != 0) {
+				if (result.size() >= iLimit)
+					return result;
+				result.push_back(base | static_cast<value_type>(word * 64 + static_cast<size_t>(std::countr_zero(bits))));
+				bits &= bits - 1;
+			}
+		}
+	}
+	return result;
+}
+
+auto SurvivorSet::bitmapContainerCount() const -> size_t {
+	return static_cast<size_t>(std::ranges::count_if(m_containers, &Container::isBitmap));
+}
+
+}// namespace evl::core
@@ -0,0 +1,138 @@
+/**
+ * @file SurvivorSet.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace evl::core {
+
+/**
+ * @brief Class SurvivorSet: compressed bitmap of card indexes.
+ *
+ * Roaring-style layout: the values are split by their high 16 bits into containers. A container holds
+ * either a sorted array of the low 16 bits (sparse) or a 65536-bit bitmap (dense), and switches form
+ * when its cardinality crosses 4096 values.
+ */
+class SurvivorSet {
+public:
+	/// Type of the stored values.
+	using value_type = uint32_t;
+	/// Maximal cardinality of an array container.
+	static constexpr uint32_t g_arrayMaxSize = 4096;
+
+	/**
+	 * @brief Fill the set with all the values from 0 to iCount - 1.
+	 * @param iCount The number of values.
+	 */
+	void fill(value_type iCount);
+
+	/**
+	 * @brief Remove all values.
+	 */
+	void clear();
+
+	/**
+	 * @brief Add a value.
+	 * @param iValue The value to add.
+	 * @return True if the value was not in the set.
+	 */
+	auto add(value_type iValue) -> bool;
+
+	/**
+	 * @brief Remove a value.
+	 * @param iValue The value to remove.
+	 * @return True if the value was in the set.
+	 */
+	auto remove(value_type iValue) -> bool;
+
+	/**
+	 * @brief Check if a value is in the set.
+	 * @param iValue The value to check.
+	 * @return True if the value is present.
+	 */
+	[[nodiscard]] auto contains(value_type iValue) const -> bool;
+
+	/**
+	 * @brief Get the number of values.
+	 * @return The cardinality of the set.
+	 */
+	[[nodiscard]] auto size() const -> size_t { return m_size; }
+
+	/**
+	 * @brief Check if the set is empty.
+	 * @return True if empty.
+	 */
+	[[nodiscard]] auto empty() const -> bool { return m_size == 0; }
+
+	/**
+	 * @brief Extract the values in increasing order.
+	 * @param iLimit The maximal number of values to extract.
+	 * @return The values.
+	 */
+	[[nodiscard]] auto toVector(size_t iLimit = std::numeric_limits<size_t>::max()) const -> std::vector<value_type>;
+
+	/**
+	 * @brief Get the number of containers.
+	 * @return The number of containers.
+	 */
+	[[nodiscard]] auto containerCount() const -> size_t { return m_containers.size(); }
+
+	/**
+	 * @brief Get the number of containers in bitmap form.
+	 * @return The number of bitmap containers.
+	 */
+	[[nodiscard]] auto bitmapContainerCount() const -> size_t;
+
+private:
+	/// Values sharing the same high 16 bits.
+	struct Container {
+		/// High 16 bits of the values.
+		uint16_t key = 0;
+		/// Number of values.
+		uint32_t cardinality = 0;
+		/// Sorted low bits (array form).
+		std::vector<uint16_t> array;
+		/// 1024 words of bits (bitmap form).
+		std::vector<uint64_t> bitmap;
+		/**
+		 * @brief Check the container form.
+		 * @return True if bitmap form.
+		 */
+		[[nodiscard]] auto isBitmap() const -> bool { return !bitmap.empty(); }
+		/**
+		 * @brief Convert an array container into bitmap form.
+		 */
+		void toBitmap();
+		/**
+		 * @brief Convert a bitmap container into array form.
+		 */
+		void toArray();
+	};
+
+	/**
+	 * @brief Find the container of a key.
+	 * @param iKey The high 16 bits.
+	 * @return Iterator on the container or on the insertion point.
+	 */
+	[[nodiscard]] auto findContainer(uint16_t iKey) -> std::vector<Container>::iterator;
+	/**
+	 * @brief Find the container of a key.
+	 * @param iKey The high 16 bits.
+	 * @return Iterator on the container or on the insertion point.
+	 */
+	[[nodiscard]] auto findContainer(uint16_t iKey) const -> std::vector<Container>::const_iterator;
+
+	/// Containers sorted by key.
+	std::vector<Container> m_containers;
+	/// Total number of values.
+	size_t m_size = 0;
+};
+
+}// namespace evl::core
@@ -0,0 +1,665 @@
+/**
+ * @file TextStream.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "TextStream.h"
+
+#include <charconv>
+#include <yaml-cpp/eventhandler.h>
+#include <yaml-cpp/exceptions.h>
+#include <yaml-cpp/parser.h>
+
+namespace evl::core {
+
+namespace {
+/// Size of the buffer of a number.
+constexpr size_t g_numberSize = 32;
+
+/**
+ * @brief Append a code point to a UTF-8 string.
+ * @param oText The string.
+ * @param iCode The code point.
+ */
+void appendUtf8(std::string& oText, const uint32_t iCode) {
+	if (iCode < 0x80U) {
+		oText.push_back(static_cast<char>(iCode));
+	} else if (iCode < 0x800U) {
+		oText.push_back(static_cast<char>(0xC0U | iCode >> 6U));
+		oText.push_back(static_cast<char>(0x80U | (iCode & 0x3FU)));
+	} else if (iCode < 0x10000U) {
+		oText.push_back(static_cast<char>(0xE0U | iCode >> 12U));
+		oText.push_back(static_cast<char>(0x80U | (iCode >> 6U & 0x3FU)));
+		oText.push_back(static_cast<char>(0x80U | (iCode & 0x3FU)));
+	} else {
+		oText.push_back(static_cast<char>(0xF0U | iCode >> 18U));
+		oText.push_back(static_cast<char>(0x80U | (iCode >> 12U & 0x3FU)));
+		oText.push_back(static_cast<char>(0x80U | (iCode >> 6U & 0x3FU)));
+		oText.push_back(static_cast<char>(0x80U | (iCode & 0x3FU)));
+	}
+}
+}// namespace
+
+// ---- TextWriter ----
+
+TextWriter::~TextWriter() = default;
+
+void TextWriter::integer(const int64_t iValue) {
+	std::array<char, g_numberSize> buffer{};
+	const auto result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), iValue);
+	scalar({buffer.data(), result.ptr}, false);
+}
+
+void TextWriter::number(const double iValue) {
+	std::array<char, g_numberSize> buffer{};
+	const auto result = std::to_chars(buffer.data(), buffer.data() + buffer.size(), iValue);
+	scalar({buffer.data(), result.ptr}, false);
+}
+
+void TextWriter::time(const time_point& iTime) {
+	integer(std::chrono::duration_cast<std::chrono::nanoseconds>(iTime.time_since_epoch()).count());
+}
+
+// ---- JsonWriter ----
+
+void JsonWriter::key(const std::string_view iKey) {
+	separate();
+	escaped(iKey);
+	m_stream.write(": ", 2);
+	m_afterKey = true;
+}
+
+auto JsonWriter::good() const -> bool { return m_stream.good(); }
+
+void JsonWriter::scalar(const std::string_view iValue, const bool iString) {
+	separate();
+	if (iString)
+		escaped(iValue);
+	else
+		m_stream.write(iValue.data(), static_cast<std::streamsize>(iValue.size()));
+}
+
+void JsonWriter::separate() {
+	if (m_afterKey) {
+		m_afterKey = false;
+		return;
+	}
+	if (m_levels.empty())
+		return;
+	auto& level = m_levels.back();
+	if (!level.empty)
+		m_stream.put(',');
+	if (!level.flow)
+		newLine();
+	else if (!level.empty)
+		m_stream.put(' ');
+	level.empty = false;
+}
+
+void JsonWriter::open(const char iBracket, const bool iFlow) {
+	separate();
+	m_stream.put(iBracket);
+	m_levels.push_back({.flow = iFlow || (!m_levels.empty() && m_levels.back().flow), .empty = true});
+}
+
+void JsonWriter::close(const char iBracket) {
+	if (m_levels.empty())
+		return;
+	const Level level = m_levels.back();
+	m_levels.pop_back();
+	if (!level.empty && !level.flow)
+		newLine();
+	m_stream.put(iBracket);
+	if (m_levels.empty())
+		m_stream.put('\n');
+}
+
+void JsonWriter::newLine() {
+	m_stream.put('\n');
+	for (size_t i = 0; i < m_levels.size(); ++i) m_stream.put('\t');
+}
+
+void JsonWriter::escaped(const std::string_view iValue) {
+	m_stream.put('"');
+	size_t done = 0;
+	for (size_t i = 0; i < iValue.size(); ++i) {
+		const auto chr = static_cast<unsigned char>(iValue[i]);
+		if (chr >= 0x20U && chr != '"' && chr != '\\')
+			continue;
+		// the safe characters are written by runs
+		m_stream.write(iValue.data() + done, static_cast<std::streamsize>(i - done));
+		done = i + 1;
+		switch (chr) {
+			case '"':
+				m_stream.write("\\\"", 2);
+				break;
+			case '\\':
+				m_stream.write("\\\\", 2);
+				break;
+			case '\n':
+				m_stream.write("\\n", 2);
+				break;
+			case '\r':
+				m_stream.write("\\r", 2);
+				break;
+			case '\t':
+				m_stream.write("\\t", 2);
+				break;
+			default:
+				m_stream << std::format("\\u{:04x}", chr);
+				break;
+		}
+	}
+	m_stream.write(iValue.data() + done, static_cast<std::streamsize>(iValue.size() - done));
+	m_stream.put('"');
+}
+
+// ---- YamlWriter ----
+
+YamlWriter::YamlWriter(std::ostream& oStream) : m_stream{oStream}, m_emitter{oStream} {}
+
+void YamlWriter::beginMap() {
+	m_emitter << YAML::BeginMap;
+	++m_depth;
+}
+
+void YamlWriter::endMap() {
+	m_emitter << YAML::EndMap;
+	if (--m_depth == 0)
+		m_stream.put('\n');
+}
+
+void YamlWriter::beginSeq(const bool iFlow) {
+	if (iFlow)
+		m_emitter << YAML::Flow;
+	m_emitter << YAML::BeginSeq;
+	++m_depth;
+}
+
+void YamlWriter::endSeq() {
+	m_emitter << YAML::EndSeq;
+	if (--m_depth == 0)
+		m_stream.put('\n');
+}
+
+void YamlWriter::key(const std::string_view iKey) {
+	m_emitter << YAML::Key << std::string(iKey) << YAML::Value;
+}
+
+auto YamlWriter::good() const -> bool { return m_emitter.good() && m_stream.good(); }
+
+void YamlWriter::scalar(const std::string_view iValue, bool) { m_emitter << std::string(iValue); }
+
+// ---- TextReader ----
+
+TextReader::~TextReader() = default;
+
+auto TextReader::next() -> Token {
+	if (m_failed)
+		return Token::Error;
+	Token token;
+	if (m_hasAhead) {
+		m_hasAhead = false;
+		token = m_ahead;
+		std::swap(m_text, m_aheadText);
+	} else {
+		token = read(m_text);
+	}
+	if (token == Token::Error)
+		fail("document invalide");
+	return token;
+}
+
+auto TextReader::peek() -> Token {
+	if (m_failed)
+		return Token::Error;
+	if (!m_hasAhead) {
+		m_ahead = read(m_aheadText);
+		m_hasAhead = true;
+		if (m_ahead == Token::Error)
+			fail("document invalide");
+	}
+	return m_ahead;
+}
+
+auto TextReader::nextKey(std::string& oKey) -> bool {
+	switch (next()) {
+		case Token::Scalar:
+			oKey = m_text;
+			return true;
+		case Token::EndMap:
+			return false;
+		case Token::BeginMap:
+		case Token::EndSeq:
+		case Token::BeginSeq:
+		case Token::End:
+		case Token::Error:
+			break;
+	}
+	return fail("clé attendue");
+}
+
+auto TextReader::nextItem() -> bool {
+	switch (peek()) {
+		case Token::EndSeq:
+			next();
+			return false;
+		case Token::BeginMap:
+		case Token::BeginSeq:
+		case Token::Scalar:
+			return true;
+		case Token::EndMap:
+		case Token::End:
+		case Token::Error:
+			break;
+	}
+	return fail("élément de liste attendu");
+}
+
+void TextReader::skip() {
+	size_t depth = 0;
+	do {
+		switch (next()) {
+			case Token::BeginMap:
+			case Token::BeginSeq:
+				++depth;
+				break;
+			case Token::EndMap:
+			case Token::EndSeq:
+				if (depth == 0) {
+					fail("valeur attendue");
+					return;
+				}
+				--depth;
+				break;
+			case Token::Scalar:
+				break;
+			case Token::End:
+			case Token::Error:
+				fail("fin inattendue du document");
+				return;
+		}
+	} while (depth > 0);
+}
+
+auto TextReader::readString(std::string& oValue) -> bool {
+	if (!expect(Token::Scalar, "une valeur"))
+		return false;
+	oValue = m_text;
+	return true;
+}
+
+auto TextReader::readInteger(int64_t& oValue) -> bool {
+	if (!expect(Token::Scalar, "un entier"))
+		return false;
+	const char* end = m_text.data() + m_text.size();
+	if (const auto result = std::from_chars(m_text.data(), end, oValue); result.ec != std::errc{} || result.ptr != end)
+		return fail(std::format("entier invalide: '{}'", m_text));
+	return true;
+}
+
+auto TextReader::readDouble(double& oValue) -> bool {
+	if (!expect(Token::Scalar, "un nombre"))
+		return false;
+	const char* end = m_text.data() + m_text.size();
+	if (const auto result = std::from_chars(m_text.data(), end, oValue); result.ec != std::errc{} || result.ptr != end)
+		return fail(std::format("nombre invalide: '{}'", m_text));
+	return true;
+}
+
+auto TextReader::readTime(time_point& oTime) -> bool {
+	int64_t value = 0;
+	if (!readInteger(value))
+		return false;
+	oTime = time_point{std::chrono::duration_cast<clock::duration>(std::chrono::nanoseconds{value})};
+	return true;
+}
+
+auto TextReader::fail(std::string iMessage) -> bool {
+	if (!m_failed) {
+		m_failed = true;
+		m_error = std::move(iMessage);
+	}
+	return false;
+}
+
+auto TextReader::expect(const Token iToken, const std::string_view iWhat) -> bool {
+	if (next() == iToken)
+		return true;
+	return fail(std::format("{} est attendu(e)", iWhat));
+}
+
+// ---- JsonReader ----
+
+JsonReader::JsonReader(std::istream& iStream) : m_buffer{iStream.rdbuf()} {}
+
+auto JsonReader::read(std::string& oText) -> Token {
+	constexpr auto eof = std::char_traits<char>::eof();
+	while (true) {
+		const int chr = skipSpaces();
+		if (m_rootDone) {
+			if (chr == eof)
+				return Token::End;
+			fail("données après la fin du document");
+			return Token::Error;
+		}
+		if (!m_levels.empty()) {
+			auto& level = m_levels.back();
+			const char closing = level.map ? '}' : ']';
+			if (level.expect == Expect::Colon) {
+				if (chr != ':') {
+					fail("':' attendu après une clé");
+					return Token::Error;
+				}
+				m_buffer->sbumpc();
+				level.expect = Expect::Value;
+				continue;
+			}
+			if (level.expect == Expect::Next) {
+				if (chr == ',') {
+					m_buffer->sbumpc();
+					level.expect = Expect::Value;
+					level.key = level.map;
+					continue;
+				}
+				if (chr != closing) {
+					fail(std::format("',' ou '{}' attendu", closing));
+					return Token::Error;
+				}
+			}
+			if (chr == closing && level.expect != Expect::Value) {
+				m_buffer->sbumpc();
+				const bool map = level.map;
+				m_levels.pop_back();
+				if (m_levels.empty())
+					m_rootDone = true;
+				else
+					m_levels.back().expect = Expect::Next;
+				return map ? Token::EndMap : Token::EndSeq;
+			}
+			if (level.map && level.key) {
+				if (chr != '"') {
+					fail("clé attendue");
+					return Token::Error;
+				}
+				m_buffer->sbumpc();
+				if (!readQuoted(oText))
+					return Token::Error;
+				level.key = false;
+				level.expect = Expect::Colon;
+				return Token::Scalar;
+			}
+		}
+		if (chr == eof) {
+			fail("fin inattendue du document");
+			return Token::Error;
+		}
+		// a value: the parent then waits for a separator
+		if (!m_levels.empty())
+			m_levels.back().expect = Expect::Next;
+		if (chr == '{' || chr == '[') {
+			if (m_levels.size() >= g_maxDepth) {
+				fail("imbrication trop profonde");
+				return Token::Error;
+			}
+			m_buffer->sbumpc();
+			const bool map = chr == '{';
+			m_levels.push_back({.map = map, .key = map, .expect = Expect::First});
+			return map ? Token::BeginMap : Token::BeginSeq;
+		}
+		if (m_levels.empty())
+			m_rootDone = true;
+		if (chr == '"') {
+			m_buffer->sbumpc();
+			return readQuoted(oText) ? Token::Scalar : Token::Error;
+		}
+		return readBare(oText) ? Token::Scalar : Token::Error;
+	}
+}
+
+auto JsonReader::skipSpaces() -> int {
+	int chr = m_buffer->sgetc();
+	while (chr == ' ' || chr == '\t' || chr == '\n' || chr == '\r') chr = m_buffer->snextc();
+	return chr;
+}
+
+auto JsonReader::readQuoted(std::string& oText) -> bool {
+	constexpr auto eof = std::char_traits<char>::eof();
+	oText.clear();
+	while (true) {
+		const int chr = m_buffer->sbumpc();
+		if (chr == eof)
+			return fail("chaîne non terminée");
+		if (chr == '"')
+			return true;
+		if (oText.size() >= g_maxScalarLength)
+			return fail("chaîne trop longue");
+		if (static_cast<unsigned char>(chr) < 0x20U)
+			return fail("caractère de contrôle dans une chaîne");
+		if (chr != '\\') {
+			oText.push_back(static_cast<char>(chr));
+			continue;
+		}
+		switch (m_buffer->sbumpc()) {
+			case '"':
+				oText.push_back('"');
+				break;
+			case '\\':
+				oText.push_back('\\');
+				break;
+			case '/':
+				oText.push_back('/');
+				break;
+			case 'b':
+				oText.push_back('\b');
+				break;
+			case 'f':
+				oText.push_back('\f');
+				break;
+			case 'n':
+				oText.push_back('\n');
+				break;
+			case 'r':
+				oText.push_back('\r');
+				break;
+			case 't':
+				oText.push_back('\t');
+				break;
+			case 'u': {
+				uint32_t code = 0;
+				if (!readHex(code))
+					return false;
+				if (code >= 0xD800U && code < 0xDC00U) {
+					// high surrogate: the low one must follow
+					uint32_t low = 0;
+					if (m_buffer->sbumpc() != '\\' || m_buffer->sbumpc() != 'u' || !readHex(low) || low < 0xDC00U ||
+						low >= 0xE000U)
+						return fail("paire de substitution invalide");
+					code = 0x10000U + ((code - 0xD800U) << 10U) + (low - 0xDC00U);
+				} else if (code >= 0xDC00U && code < 0xE000U) {
+					return fail("paire de substitution invalide");
+				}
+				appendUtf8(oText, code);
+				break;
+			}
+			default:
+				return fail("séquence d’échappement invalide");
+		}
+	}
+}
+
+auto JsonReader::readBare(std::string& oText) -> bool {
+	oText.clear();
+	for (int chr = m_buffer->sgetc(); std::isalnum(chr) != 0 || chr == '-' || chr == '+' || chr == '.';
+		 chr = m_buffer->snextc()) {
+		if (oText.size() >= g_numberSize)
+			return fail("valeur trop longue");
+		oText.push_back(static_cast<char>(chr));
+	}
+	if (oText == "true" || oText == "false")
+		return true;
+	if (oText == "null") {
+		oText.clear();
+		return true;
+	}
+	double value = 0;
+	const char* end = oText.data() + oText.size();
+	if (oText.empty() || (oText.front() != '-' && std::isdigit(static_cast<unsigned char>(oText.front())) == 0) ||
+		std::from_chars(oText.data(), end, value).ptr != end)
+		return fail(std::format("valeur invalide: '{}'", oText));
+	return true;
+}
+
+auto JsonReader::readHex(uint32_t& oCode) -> bool {
+	std::array<char, 4> digits{};
+	for (auto& digit: digits) {
+		const int chr = m_buffer->sbumpc();
+		if (std::isxdigit(chr) == 0)
+			return fail("séquence d’échappement invalide");
+		digit = static_cast<char>(chr);
+	}
+	std::from_chars(digits.data(), digits.data() + digits.size(), oCode, 16);
+	return true;
+}
+
+// ---- YamlReader ----
+
+/**
+ * @brief Receiver of the events of the yaml-cpp parser, grouping them in batches.
+ */
+class YamlReader::Handler final : public YAML::EventHandler {
+public:
+	/// Thrown to stop the parser when the reader is gone.
+	struct Stop {};
+
+	/**
+	 * @brief Constructor.
+	 * @param ioReader The reader.
+	 */
+	explicit Handler(YamlReader& ioReader) : m_reader{ioReader} {}
+
+	void OnDocumentStart(const YAML::Mark&) override {}
+	void OnDocumentEnd() override {}
+	void OnNull(const YAML::Mark&, YAML::anchor_t) override { push(Token::Scalar, {}); }
+	void OnAlias(const YAML::Mark& iMark, YAML::anchor_t) override {
+		throw YAML::ParserException(iMark, "alias non supporté");
+	}
+	void OnScalar(const YAML::Mark&, const std::string&, YAML::anchor_t, const std::string& iValue) override {
+		push(Token::Scalar, iValue);
+	}
+	void OnSequenceStart(const YAML::Mark& iMark, const std::string&, YAML::anchor_t,
+						 YAML::EmitterStyle::value) override {
+		enter(iMark);
+		push(Token::BeginSeq, {});
+	}
+	void OnSequenceEnd() override {
+		--m_depth;
+		push(Token::EndSeq, {});
+	}
+	void OnMapStart(const YAML::Mark& iMark, const std::string&, YAML::anchor_t, YAML::EmitterStyle::value) override {
+		enter(iMark);
+		push(Token::BeginMap, {});
+	}
+	void OnMapEnd() override {
+		--m_depth;
+		push(Token::EndMap, {});
+	}
+
+	/**
+	 * @brief Add a token to the batch, handed over when full.
+	 * @param iToken The token.
+	 * @param iText The text of a scalar.
+	 */
+	void push(const Token iToken, const std::string& iText) {
+		if (iText.size() > g_maxScalarLength)
+			throw YAML::Exception(YAML::Mark::null_mark(), "valeur trop longue");
+		m_batch.emplace_back(iToken, iText);
+		if (m_batch.size() >= g_batchSize && !m_reader.handOver(m_batch, false))
+			throw Stop{};
+	}
+
+	/**
+	 * @brief Get the batch.
+	 * @return The batch.
+	 */
+	auto batch() -> batch_type& { return m_batch; }
+
+private:
+	/**
+	 * @brief Check the nesting of a new container.
+	 * @param iMark Position in the document.
+	 */
+	void enter(const YAML::Mark& iMark) {
+		if (++m_depth > g_maxDepth)
+			throw YAML::ParserException(iMark, "imbrication trop profonde");
+	}
+
+	/// The reader.
+	YamlReader& m_reader;
+	/// The batch being filled.
+	batch_type m_batch;
+	/// Number of opened containers.
+	size_t m_depth = 0;
+};
+
+YamlReader::YamlReader(std::istream& iStream) : m_parser{[this, &iStream] { parse(iStream); }} {}
+
+YamlReader::~YamlReader() {
+	{
+		const std::scoped_lock lock(m_mutex);
+		m_cancelled = true;
+	}
+	m_free.notify_all();
+}
+
+auto YamlReader::read(std::string& oText) -> Token {
+	if (m_cursor == m_batch.size()) {
+		m_batch.clear();
+		m_cursor = 0;
+		std::unique_lock lock(m_mutex);
+		m_ready.wait(lock, [this] { return !m_shared.empty() || m_finished; });
+		if (m_shared.empty())
+			return Token::End;
+		m_batch.swap(m_shared);
+		lock.unlock();
+		m_free.notify_one();
+	}
+	auto& [token, text] = m_batch[m_cursor++];
+	if (token == Token::Error) {
+		fail(std::format("YAML invalide: {}", text));
+		return Token::Error;
+	}
+	oText = std::move(text);
+	return token;
+}
+
+void YamlReader::parse(std::istream& iStream) {
+	Handler handler(*this);
+	try {
+		YAML::Parser parser(iStream);
+		parser.HandleNextDocument(handler);
+		handler.batch().emplace_back(Token::End, std::string{});
+	} catch (const Handler::Stop&) {
+		return;
+	} catch (const YAML::Exception& e) { handler.batch().emplace_back(Token::Error, e.what()); }
+	handOver(handler.batch(), true);
+}
+
+auto YamlReader::handOver(batch_type& ioBatch, const bool iLast) -> bool {
+	std::unique_lock lock(m_mutex);
+	m_free.wait(lock, [this] { return m_shared.empty() || m_cancelled; });
+	if (m_cancelled)
+		return false;
+	m_shared.swap(ioBatch);
+	ioBatch.clear();
+	m_finished = iLast;
+	lock.unlock();
+	m_ready.notify_one();
+	return true;
+}
+
+}// namespace evl::core
@@ -0,0 +1,511 @@
+/**
+ * @file TextStream.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#pragma once
+
+#include "timeFunctions.h"
+
+#include <condition_variable>
+#include <format>
+#include <iosfwd>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <yaml-cpp/emitter.h>
+
+namespace evl::core {
+
+/**
+ * @brief Class TextWriter: streaming writer of a JSON or YAML document.
+ *
+ * The document is written to the stream as the values are given, no tree is built in memory.
+ */
+class TextWriter {
+public:
+	TextWriter() = default;
+	TextWriter(const TextWriter&) = delete;
+	TextWriter(TextWriter&&) = delete;
+	auto operator=(const TextWriter&) -> TextWriter& = delete;
+	auto operator=(TextWriter&&) -> TextWriter& = delete;
+	virtual ~TextWriter();
+
+	/**
+	 * @brief Begin a map.
+	 */
+	virtual void beginMap() = 0;
+	/**
+	 * @brief End the current map.
+	 */
+	virtual void endMap() = 0;
+	/**
+	 * @brief Begin a sequence.
+	 * @param iFlow Write the sequence on a single line.
+	 */
+	virtual void beginSeq(bool iFlow = false) = 0;
+	/**
+	 * @brief End the current sequence.
+	 */
+	virtual void endSeq() = 0;
+	/**
+	 * @brief Write the key of the next value of the current map.
+	 * @param iKey The key.
+	 */
+	virtual void key(std::string_view iKey) = 0;
+	/**
+	 * @brief Check the state of the writer.
+	 * @return False if the stream or the document is in error.
+	 */
+	[[nodiscard]] virtual auto good() const -> bool = 0;
+
+	/**
+	 * @brief Write a string value.
+	 * @param iValue The value.
+	 */
+	void string(std::string_view iValue) { scalar(iValue, true); }
+	/**
+	 * @brief Write an integer value.
+	 * @param iValue The value.
+	 */
+	void integer(int64_t iValue);
+	/**
+	 * @brief Write a floating point value, with the shortest exact representation.
+	 * @param iValue The value.
+	 */
+	void number(double iValue);
+	/**
+	 * @brief Write a date, as nanoseconds since the epoch.
+	 * @param iTime The date.
+	 */
+	void time(const time_point& iTime);
+
+	/**
+	 * @brief Write a string entry of the current map.
+	 * @param iKey The key.
+	 * @param iValue The value.
+	 */
+	void putString(const std::string_view iKey, const std::string_view iValue) {
+		key(iKey);
+		string(iValue);
+	}
+	/**
+	 * @brief Write an integer entry of the current map.
+	 * @param iKey The key.
+	 * @param iValue The value.
+	 */
+	void putInteger(const std::string_view iKey, const int64_t iValue) {
+		key(iKey);
+		integer(iValue);
+	}
+	/**
+	 * @brief Write a floating point entry of the current map.
+	 * @param iKey The key.
+	 * @param iValue The value.
+	 */
+	void putDouble(const std::string_view iKey, const double iValue) {
+		key(iKey);
+		number(iValue);
+	}
+	/**
+	 * @brief Write a date entry of the current map.
+	 * @param iKey The key.
+	 * @param iTime The date.
+	 */
+	void putTime(const std::string_view iKey, const time_point& iTime) {
+		key(iKey);
+		time(iTime);
+	}
+
+protected:
+	/**
+	 * @brief Write a scalar value.
+	 * @param iValue The text of the value.
+	 * @param iString If the value is a string (to be quoted and escaped when needed).
+	 */
+	virtual void scalar(std::string_view iValue, bool iString) = 0;
+};
+
+/**
+ * @brief Class JsonWriter: streaming JSON writer, indented with tabs.
+ */
+class JsonWriter final : public TextWriter {
+public:
+	/**
+	 * @brief Constructor.
+	 * @param oStream The stream where to write.
+	 */
+	explicit JsonWriter(std::ostream& oStream) : m_stream{oStream} {}
+
+	void beginMap() override { open('{', false); }
+	void endMap() override { close('}'); }
+	void beginSeq(const bool iFlow) override { open('[', iFlow); }
+	void endSeq() override { close(']'); }
+	void key(std::string_view iKey) override;
+	[[nodiscard]] auto good() const -> bool override;
+
+private:
+	void scalar(std::string_view iValue, bool iString) override;
+	/**
+	 * @brief Write the separator and the indentation before a value.
+	 */
+	void separate();
+	/**
+	 * @brief Open a container.
+	 * @param iBracket The opening bracket.
+	 * @param iFlow Write the container on a single line.
+	 */
+	void open(char iBracket, bool iFlow);
+	/**
+	 * @brief Close the current container.
+	 * @param iBracket The closing bracket.
+	 */
+	void close(char iBracket);
+	/**
+	 * @brief Write a new line and the indentation of the current level.
+	 */
+	void newLine();
+	/**
+	 * @brief Write an escaped string.
+	 * @param iValue The string.
+	 */
+	void escaped(std::string_view iValue);
+
+	/// An opened container.
+	struct Level {
+		/// If the container is written on a single line.
+		bool flow = false;
+		/// If the container is still empty.
+		bool empty = true;
+	};
+	/// The stream.
+	std::ostream& m_stream;
+	/// The opened containers.
+	std::vector<Level> m_levels;
+	/// If a key has just been written.
+	bool m_afterKey = false;
+};
+
+/**
+ * @brief Class YamlWriter: streaming YAML writer, based on the yaml-cpp emitter.
+ */
+class YamlWriter final : public TextWriter {
+public:
+	/**
+	 * @brief Constructor.
+	 * @param oStream The stream where to write.
+	 */
+	explicit YamlWriter(std::ostream& oStream);
+
+	void beginMap() override;
+	void endMap() override;
+	void beginSeq(bool iFlow) override;
+	void endSeq() override;
+	void key(std::string_view iKey) override;
+	[[nodiscard]] auto good() const -> bool override;
+
+private:
+	void scalar(std::string_view iValue, bool iString) override;
+
+	/// The stream.
+	std::ostream& m_stream;
+	/// The emitter, writing directly to the stream.
+	YAML::Emitter m_emitter;
+	/// Number of opened containers.
+	size_t m_depth = 0;
+};
+
+/**
+ * @brief Class TextReader: pull reader of a JSON or YAML document.
+ *
+ * The document is read token by token: the caller walks the structure it expects and skips what it does not
+ * know, no tree is built in memory. Every scalar is given as text, the typed readers convert it. The first
+ * error stops the reading: every following token is an error.
+ */
+class TextReader {
+public:
+	/// Tokens of a document.
+	enum struct Token : uint8_t {
+		BeginMap,///< Start of a map.
+		EndMap,///< End of a map.
+		BeginSeq,///< Start of a sequence.
+		EndSeq,///< End of a sequence.
+		Scalar,///< A key or a value.
+		End,///< End of the document.
+		Error,///< Invalid document.
+	};
+	/// Maximal nesting of the containers.
+	static constexpr size_t g_maxDepth = 64;
+	/// Maximal length of a scalar.
+	static constexpr size_t g_maxScalarLength = size_t{1} << 20U;
+
+	TextReader() = default;
+	TextReader(const TextReader&) = delete;
+	TextReader(TextReader&&) = delete;
+	auto operator=(const TextReader&) -> TextReader& = delete;
+	auto operator=(TextReader&&) -> TextReader& = delete;
+	virtual ~TextReader();
+
+	/**
+	 * @brief Get the next token.
+	 * @return The token.
+	 */
+	auto next() -> Token;
+	/**
+	 * @brief Get the next token without consuming it.
+	 * @return The token.
+	 */
+	auto peek() -> Token;
+	/**
+	 * @brief Get the text of the last scalar read by next().
+	 * @return The text.
+	 */
+	[[nodiscard]] auto text() const -> std::string_view { return m_text; }
+	/**
+	 * @brief Check if an error occurred.
+	 * @return True if the document is invalid.
+	 */
+	[[nodiscard]] auto hasFailed() const -> bool { return m_failed; }
+	/**
+	 * @brief Get the description of the error.
+	 * @return The description.
+	 */
+	[[nodiscard]] auto getError() const -> const std::string& { return m_error; }
+
+	/**
+	 * @brief Enter a map.
+	 * @return False (and in error) if the next value is not a map.
+	 */
+	auto enterMap() -> bool { return expect(Token::BeginMap, "une table"); }
+	/**
+	 * @brief Read the next key of the current map.
+	 * @param oKey The key.
+	 * @return False at the end of the map or on error.
+	 */
+	auto nextKey(std::string& oKey) -> bool;
+	/**
+	 * @brief Enter a sequence.
+	 * @return False (and in error) if the next value is not a sequence.
+	 */
+	auto enterSeq() -> bool { return expect(Token::BeginSeq, "une liste"); }
+	/**
+	 * @brief Check if the current sequence has a next item.
+	 * @return False at the end of the sequence (consumed) or on error.
+	 */
+	auto nextItem() -> bool;
+	/**
+	 * @brief Skip the next value, whatever its structure.
+	 */
+	void skip();
+
+	/**
+	 * @brief Read a string value.
+	 * @param oValue The value.
+	 * @return False on error.
+	 */
+	auto readString(std::string& oValue) -> bool;
+	/**
+	 * @brief Read an integer value.
+	 * @param oValue The value.
+	 * @return False (and in error) if the value is not an integer in range.
+	 */
+	auto readInteger(int64_t& oValue) -> bool;
+	/**
+	 * @brief Read an integer value of a given type.
+	 * @tparam T The integer type.
+	 * @param oValue The value.
+	 * @return False (and in error) if the value is not an integer in the range of the type.
+	 */
+	template<typename T>
+	auto readInteger(T& oValue) -> bool {
+		int64_t value = 0;
+		if (!readInteger(value))
+			return false;
+		if (!std::in_range<T>(value))
+			return fail(std::format("entier hors limites: {}", value));
+		oValue = static_cast<T>(value);
+		return true;
+	}
+	/**
+	 * @brief Read a floating point value.
+	 * @param oValue The value.
+	 * @return False (and in error) if the value is not a number.
+	 */
+	auto readDouble(double& oValue) -> bool;
+	/**
+	 * @brief Read a date, as nanoseconds since the epoch.
+	 * @param oTime The date.
+	 * @return False (and in error) if the value is not an integer.
+	 */
+	auto readTime(time_point& oTime) -> bool;
+
+	/**
+	 * @brief Put the reader in error.
+	 * @param iMessage Description of the error.
+	 * @return Always false.
+	 */
+	auto fail(std::string iMessage) -> bool;
+
+protected:
+	/**
+	 * @brief Read the next token from the source.
+	 * @param oText The text of a scalar.
+	 * @return The token.
+	 */
+	virtual auto read(std::string& oText) -> Token = 0;
+
+private:
+	/**
+	 * @brief Read the next token and check it.
+	 * @param iToken The expected token.
+	 * @param iWhat Description of the expected token.
+	 * @return False (and in error) if the token is not the expected one.
+	 */
+	auto expect(Token iToken, std::string_view iWhat) -> bool;
+
+	/// Text of the last scalar.
+	std::string m_text;
+	/// The token read ahead by peek().
+	Token m_ahead = Token::End;
+	/// Text of the scalar read ahead.
+	std::string m_aheadText;
+	/// If a token has been read ahead.
+	bool m_hasAhead = false;
+	/// If the reader is in error.
+	bool m_failed = false;
+	/// Description of the error.
+	std::string m_error;
+};
+
+/**
+ * @brief Class JsonReader: pull parser of JSON, reading the stream character by character.
+ */
+class JsonReader final : public TextReader {
+public:
+	/**
+	 * @brief Constructor.
+	 * @param iStream The stream to read.
+	 */
+	explicit JsonReader(std::istream& iStream);
+
+private:
+	auto read(std::string& oText) -> Token override;
+	/**
+	 * @brief Skip the white spaces.
+	 * @return The next character, or EOF.
+	 */
+	auto skipSpaces() -> int;
+	/**
+	 * @brief Read a string, after its opening quote.
+	 * @param oText The string.
+	 * @return False on error.
+	 */
+	auto readQuoted(std::string& oText) -> bool;
+	/**
+	 * @brief Read a number or a literal (true, false, null).
+	 * @param oText The text.
+	 * @return False on error.
+	 */
+	auto readBare(std::string& oText) -> bool;
+	/**
+	 * @brief Read the 4 hexadecimal digits of an escaped character.
+	 * @param oCode The code.
+	 * @return False on error.
+	 */
+	auto readHex(uint32_t& oCode) -> bool;
+
+	/// What is expected in a container.
+	enum struct Expect : uint8_t {
+		First,///< A value (or a key), or the end of the container.
+		Value,///< A value (or a key).
+		Colon,///< The colon after a key.
+		Next,///< A comma or the end of the container.
+	};
+	/// An opened container.
+	struct Level {
+		/// If the container is a map.
+		bool map = false;
+		/// If the next scalar of the map is a key.
+		bool key = true;
+		/// What is expected.
+		Expect expect = Expect::First;
+	};
+	/// The stream buffer.
+	std::streambuf* m_buffer;
+	/// The opened containers.
+	std::vector<Level> m_levels;
+	/// If the root value has been read.
+	bool m_rootDone = false;
+};
+
+/**
+ * @brief Class YamlReader: pull reader of YAML.
+ *
+ * The yaml-cpp event parser runs on a background thread and hands over the tokens by batches, through a
+ * single shared batch: the memory stays bounded whatever the size of the document.
+ */
+class YamlReader final : public TextReader {
+public:
+	/// Number of tokens in a batch.
+	static constexpr size_t g_batchSize = 256;
+
+	/**
+	 * @brief Constructor: the parser starts.
+	 * @param iStream The stream to read, kept alive by the caller.
+	 */
+	explicit YamlReader(std::istream& iStream);
+	/**
+	 * @brief Destructor: the parser is stopped.
+	 */
+	~YamlReader() override;
+	YamlReader(const YamlReader&) = delete;
+	YamlReader(YamlReader&&) = delete;
+	auto operator=(const YamlReader&) -> YamlReader& = delete;
+	auto operator=(YamlReader&&) -> YamlReader& = delete;
+
+private:
+	/// A batch of tokens.
+	using batch_type = std::vector<std::pair<Token, std::string>>;
+	class Handler;
+
+	auto read(std::string& oText) -> Token override;
+	/**
+	 * @brief Parser thread.
+	 * @param iStream The stream to read.
+	 */
+	void parse(std::istream& iStream);
+	/**
+	 * @brief Hand over a batch to the reader (parser thread).
+	 * @param ioBatch The batch, emptied.
+	 * @param iLast If it is the last batch.
+	 * @return False if the reader is gone.
+	 */
+	auto handOver(batch_type& ioBatch, bool iLast) -> bool;
+
+	/// Protection of the shared batch.
+	std::mutex m_mutex;
+	/// Wakes up the reader when a batch is ready.
+	std::condition_variable m_ready;
+	/// Wakes up the parser when the shared batch is free.
+	std::condition_variable m_free;
+	/// The batch handed over.
+	batch_type m_shared;
+	/// The batch being read.
+	batch_type m_batch;
+	/// Position in the batch being read.
+	size_t m_cursor = 0;
+	/// If the parser has handed over its last batch.
+	bool m_finished = false;
+	/// If the reader is gone.
+	bool m_cancelled = false;
+	/// The parser (last member: joined first).
+	std::jthread m_parser;
+};
+
+}// namespace evl::core
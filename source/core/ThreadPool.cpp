@@ -0,0 +1,103 @@
+/**
+ * @file ThreadPool.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "ThreadPool.h"
+
+namespace evl::core {
+
+namespace {
+/// Pool of the calling thread.
+thread_local const ThreadPool* t_pool = nullptr;
+/// Worker index of the calling thread.
+thread_local size_t t_worker = ThreadPool::g_noWorker;
+}// namespace
+
+ThreadPool::ThreadPool(const size_t iThreads) {
+	const size_t threads = iThreads == 0 ? std::max<size_t>(1, std::thread::hardware_concurrency()) : iThreads;
+	m_queues.reserve(threads);
+	for (size_t i = 0; i < threads; ++i) m_queues.push_back(std::make_unique<Queue>());
+	m_workers.reserve(threads);
+	for (size_t i = 0; i < threads; ++i)
+		m_workers.emplace_back([this, i](const std::stop_token& iStop) { run(iStop, i); });
+}
+
+ThreadPool::~ThreadPool() {
+	for (auto& worker: m_workers) worker.request_stop();
+	m_workers.clear();
+}
+
+void ThreadPool::submit(task_type iTask) {
+	size_t index = currentWorker();
+	if (index == g_noWorker)
+		index = m_nextQueue.fetch_add(1, std::memory_order_relaxed) % m_queues.size();
+	{
+		// counted before the push so that a worker never pops a task not counted yet
+		const std::scoped_lock lock(m_mutex);
+		++m_pending;
+		++m_queued;
+	}
+	{
+		const std::scoped_lock lock(m_queues[index]->mutex);
+		m_queues[index]->tasks.push_back(std::move(iTask));
+	}
+	m_wakeUp.notify_one();
+}
+
+void ThreadPool::wait() {
+	std::unique_lock lock(m_mutex);
+	m_done.wait(lock, [this] { return m_pending == 0; });
+}
+
+auto ThreadPool::currentWorker() const -> size_t { return t_pool == this ? t_worker : g_noWorker; }
+
+void ThreadPool::run(const std::stop_token& iStop, const size_t iIndex) {
+	t_pool = this;
+	t_worker = iIndex;
+	while (!iStop.stop_requested()) {
+		task_type task;
+		if (!popTask(iIndex, task)) {
+			std::unique_lock lock(m_mutex);
+			m_wakeUp.wait(lock, iStop, [this] { return m_queued > 0; });
+			continue;
+		}
+		task();
+		const std::scoped_lock lock(m_mutex);
+		if (--m_pending == 0)
+			m_done.notify_all();
+	}
+}
+
+auto ThreadPool::popTask(const size_t iIndex, task_type& oTask) -> bool {
+	bool found = false;
+	{
+		Queue& own = *m_queues[iIndex];
+		const std::scoped_lock lock(own.mutex);
+		if (!own.tasks.empty()) {
+			oTask = std::move(own.tasks.back());
+			own.tasks.pop_back();
+			found = true;
+		}
+	}
+	for (size_t offset = 1; !found && offset < m_queues.size(); ++offset) {
+		Queue& victim = *m_queues[(iIndex + offset) % m_queues.size()];
+		const std::scoped_lock lock(victim.mutex);
+		if (!victim.tasks.empty()) {
+			oTask = std::move(victim.tasks.front());
+			victim.tasks.pop_front();
+			found = true;
+		}
+	}
+	if (found) {
+		const std::scoped_lock lock(m_mutex);
+		--m_queued;
+	}
+	return found;
+}
+
+}// namespace evl::core
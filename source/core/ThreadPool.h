@@ -0,0 +1,114 @@
+/**
+ * @file ThreadPool.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace evl::core {
+
+/**
+ * @brief Class ThreadPool: fixed set of worker threads with work stealing.
+ *
+ * Each worker owns a task queue: it takes its own tasks from the back and, when empty, steals the oldest
+ * tasks from the front of the other queues.
+ */
+class ThreadPool {
+public:
+	/// Type of a task.
+	using task_type = std::function<void()>;
+	/// Worker index of a thread outside the pool.
+	static constexpr size_t g_noWorker = std::numeric_limits<size_t>::max();
+
+	/**
+	 * @brief Constructor.
+	 * @param iThreads The number of workers (0 for the number of hardware threads).
+	 */
+	explicit ThreadPool(size_t iThreads = 0);
+	/**
+	 * @brief Destructor: drops the pending tasks and joins the workers.
+	 */
+	~ThreadPool();
+	ThreadPool(const ThreadPool&) = delete;
+	ThreadPool(ThreadPool&&) = delete;
+	auto operator=(const ThreadPool&) -> ThreadPool& = delete;
+	auto operator=(ThreadPool&&) -> ThreadPool& = delete;
+
+	/**
+	 * @brief Get the number of workers.
+	 * @return The number of workers.
+	 */
+	[[nodiscard]] auto size() const -> size_t { return m_workers.size(); }
+
+	/**
+	 * @brief Queue a task.
+	 * @param iTask The task to run.
+	 */
+	void submit(task_type iTask);
+
+	/**
+	 * @brief Block until all the submitted tasks are finished.
+	 */
+	void wait();
+
+	/**
+	 * @brief Get the index of the worker running the calling thread.
+	 * @return The worker index or g_noWorker if not called from a worker of this pool.
+	 */
+	[[nodiscard]] auto currentWorker() const -> size_t;
+
+private:
+	/// Task queue of a worker.
+	struct Queue {
+		/// Protection of the tasks.
+		std::mutex mutex;
+		/// The queued tasks.
+		std::deque<task_type> tasks;
+	};
+
+	/**
+	 * @brief Worker loop.
+	 * @param iStop The stop request.
+	 * @param iIndex The worker index.
+	 */
+	void run(const std::stop_token& iStop, size_t iIndex);
+
+	/**
+	 * @brief Take a task from the own queue or steal one from another worker.
+	 * @param iIndex The worker index.
+	 * @param oTask The task found.
+	 * @return True if a task has been found.
+	 */
+	auto popTask(size_t iIndex, task_type& oTask) -> bool;
+
+	/// The worker queues.
+	std::vector<std::unique_ptr<Queue>> m_queues;
+	/// Protection of the counters for sleeping and waiting.
+	std::mutex m_mutex;
+	/// Wakes up the workers when tasks are queued.
+	std::condition_variable_any m_wakeUp;
+	/// Wakes up wait() when the last task is done.
+	std::condition_variable m_done;
+	/// Number of tasks in the queues.
+	size_t m_queued = 0;
+	/// Number of tasks submitted and not finished.
+	size_t m_pending = 0;
+	/// Queue receiving the next task submitted from outside the pool.
+	std::atomic<size_t> m_nextQueue = 0;
+	/// The workers (last member: joined before the queues are destroyed).
+	std::vector<std::jthread> m_workers;
+};
+
+}// namespace evl::core
@@ -8,9 +8,13 @@
 #include "utilities.h"
 #include "pch.h"
 
+#include "FileWatcher.h"
+#include "Log.h"
+#include "SettingsSaver.h"
+
 namespace evl::core {
 
-constexpr uint16_t g_currentSaveVersion = 6;
+constexpr uint16_t g_currentSaveVersion = 9;
 
 namespace {
 
@@ -18,6 +22,12 @@ std::shared_ptr<Settings> g_settings;
 
 std::filesystem::path g_baseExecPath;
 
+SettingsSnapshot<GuiSettings> g_guiSettings;
+
+std::unique_ptr<SettingsSaver> g_settingsSaver;
+
+std::unique_ptr<FileWatcher> g_settingsWatcher;
+
 }// namespace
 
 void initializeUtilities([[maybe_unused]] int iArgc, char* iArgv[]) {
@@ -35,6 +45,12 @@ auto getSettings() -> std::shared_ptr<Settings> {
 	return g_settings;
 }
 
+auto getGuiSettings() -> const GuiSettings& {
+	if (g_settings == nullptr)
+		g_settings = std::make_shared<Settings>();
+	return g_guiSettings.get(*g_settings);
+}
+
 void loadSettings() {
 	const auto settings = getSettings();
 	settings->fromFile(getConfigFile());
@@ -42,12 +58,9 @@ void loadSettings() {
 
 void mergeDefaultSettings() {
 	if (g_settings != nullptr) {
-		// General settings
-		if (!g_settings->contains("general/use_imgui")) {
-			g_settings->setValue("general/use_imgui", true);
-		}
-		if (!g_settings->contains("general/log_level")) {
-			g_settings->setValue("general/log_level", std::string("info"));
+		for (const auto& [key, definition]: getSettingsSchema().getDefinitions()) {
+			if (definition.defaultValue.has_value() && !g_settings->contains(key))
+				g_settings->setValue(key, definition.defaultValue);
 		}
 		if (!g_settings->contains("general/data_location")) {
 			g_settings->setValue("general/data_location", g_baseExecPath / "data");
@@ -57,12 +70,64 @@ void mergeDefaultSettings() {
 
 void saveSettings() {
 	if (g_settings != nullptr) {
-		g_settings->toFile(getConfigFile());
+		if (g_settingsSaver == nullptr)
+			g_settingsSaver = std::make_unique<SettingsSaver>(getConfigFile());
+		g_settingsSaver->save(*g_settings);
+	}
+}
+
+auto getThemeFolder() -> std::filesystem::path {
+	std::filesystem::path data = g_baseExecPath / "data";
+	if (g_settings != nullptr) {
+		// a path when set by default, a string when read from the file
+		if (const auto location = g_settings->tryGetValue<std::string>("general/data_location"); location.has_value())
+			data = location.value();
+		else
+			data = g_settings->getValue<std::filesystem::path>("general/data_location", data);
+	}
+	return data / "theme";
+}
+
+void watchSettings() {
+	g_settingsWatcher = std::make_unique<FileWatcher>(std::vector{getConfigFile(), getThemeFolder()});
+}
+
+auto reloadSettings() -> std::vector<std::string> {
+	std::vector<std::string> modified;
+	if (g_settingsWatcher == nullptr || g_settings == nullptr)
+		return modified;
+	const auto configFile = getConfigFile().lexically_normal();
+	for (const auto& file: g_settingsWatcher->takeChanges()) {
+		Settings shadow;
+		if (file == configFile) {
+			// our own write, or one about to overwrite the file
+			if (g_settingsSaver != nullptr && g_settingsSaver->isPending())
+				continue;
+			shadow.fromFile(file);
+			const auto keys = g_settings->update(shadow);
+			modified.insert(modified.end(), keys.begin(), keys.end());
+		} else if (file.extension() != ".tmp") {
+			shadow.fromFile(file);
+			const Settings theme = shadow.extract("theme");
+			// only the file of the active theme: saving another theme must not switch to it
+			if (const auto name = theme.tryGetValue<std::string>("name");
+				!name.has_value() || name != g_settings->tryGetValue<std::string>("theme/name")) {
+				log_debug("Fichier '{}' ignoré: pas le thème actif", file.string());
+				continue;
+			}
+			const auto keys = g_settings->update(theme, "theme", true);
+			modified.insert(modified.end(), keys.begin(), keys.end());
+		}
+		log_debug("Fichier '{}' rechargé", file.string());
 	}
+	return modified;
 }
 
 void leaveSettings() {
+	g_settingsWatcher.reset();
 	saveSettings();
+	// writes the last settings before returning
+	g_settingsSaver.reset();
 	if (g_settings != nullptr) {
 		g_settings.reset();
 	}
@@ -9,6 +9,7 @@
 #pragma once
 
 #include "Settings.h"
+#include "SettingsSection.h"
 #include <filesystem>
 #include <memory>
 
@@ -44,7 +45,9 @@ void loadSettings();
 void mergeDefaultSettings();
 
 /**
- * @brief Save settings to file from the Settings singleton.
+ * @brief Save settings to file from the Settings singleton, on a background thread after a short delay.
+ *
+ * The saves requested during the delay are merged in a single write.
  */
 void saveSettings();
 
@@ -55,7 +58,34 @@ void saveSettings();
 auto getSettings() -> std::shared_ptr<Settings>;
 
 /**
- * @brief Save settings to file from the Settings singleton then destroy it.
+ * @brief Get the display settings of the Settings singleton, reloaded only when the "gui" section changed.
+ * @return The display settings.
+ */
+auto getGuiSettings() -> const GuiSettings&;
+
+/**
+ * @brief Get the folder of the theme files.
+ * @return The "theme" folder of the data location.
+ */
+auto getThemeFolder() -> std::filesystem::path;
+
+/**
+ * @brief Start watching the settings file and the theme folder for external modifications.
+ */
+void watchSettings();
+
+/**
+ * @brief Copy in the Settings singleton the values modified in the watched files since the last call.
+ *
+ * The modified file is read in separate settings, then only the keys whose value differs are copied: the sections
+ * left unchanged keep their generation. A theme file is applied only if its name is the one of the active theme
+ * ("theme/name"), and only modifies the existing keys of the "theme" section.
+ * @return The modified keys, empty if nothing changed.
+ */
+auto reloadSettings() -> std::vector<std::string>;
+
+/**
+ * @brief Save settings to file from the Settings singleton, wait for the write, then destroy it.
  */
 void leaveSettings();
 
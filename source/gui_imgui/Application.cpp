@@ -17,6 +17,7 @@
 #include "core/Log.h"
 #include "core/utilities.h"
 #include "event/AppEvent.h"
+#include "views/ArchivePopups.h"
 #include "views/ConfigPopups.h"
 #include "views/DisplayView.h"
 #include "views/HelpPopups.h"
@@ -61,12 +62,15 @@ Application::Application() {
 	m_popups.push_back(std::make_shared<views::MainConfigPopups>());
 	m_popups.push_back(std::make_shared<views::EventConfigPopups>());
 	m_popups.push_back(std::make_shared<views::GameRoundConfigPopups>());
+	m_popups.push_back(std::make_shared<views::ArchivePopup>());
 
 	// Create actions
 	m_actions.push_back(std::make_shared<actions::NewFileAction>());
 	m_actions.push_back(std::make_shared<actions::LoadFileAction>());
 	m_actions.push_back(std::make_shared<actions::SaveFileAction>());
 	m_actions.push_back(std::make_shared<actions::SaveAsFileAction>());
+	m_actions.push_back(std::make_shared<actions::OpenArchiveAction>());
+	m_actions.push_back(std::make_shared<actions::ArchiveEventAction>());
 	m_actions.push_back(std::make_shared<actions::StartGameAction>());
 	m_actions.push_back(std::make_shared<actions::StopGameAction>());
 	m_actions.push_back(std::make_shared<actions::PreferencesAction>());
@@ -80,9 +84,29 @@ Application::Application() {
 	m_actions.push_back(std::make_shared<actions::RandomPickAction>());
 	m_actions.push_back(std::make_shared<actions::CancelPickAction>());
 	m_actions.push_back(std::make_shared<actions::DisplayRulesAction>());
+	m_actions.push_back(std::make_shared<actions::UndoAction>());
+	m_actions.back()->setShortcut({.key = KeyCode::Z, .modifiers = {.ctrl = true}});
+	m_actions.push_back(std::make_shared<actions::RedoAction>());
+	m_actions.back()->setShortcut({.key = KeyCode::Y, .modifiers = {.ctrl = true}});
+
+	// Restore the event of a session that did not stop cleanly
+	if (const auto log = core::Autosave::pendingLog(); !log.empty() && core::Autosave::recover(log, m_currentEvent)) {
+		m_currentFile = core::Autosave::eventPath(log);
+		if (!m_currentFile.empty())
+			m_currentEvent.setBasePath(m_currentFile);
+		log_warn("Reprise de l'événement interrompu depuis '{}'.", log.string());
+	}
+	m_journal.setListener([this](const core::Journal& iJournal, const core::Journal::Change iChange) {
+		m_autosave.record(iJournal, iChange);
+	});
+	restartJournal();
+	applyRngEngine();
+	syncRng();
 
 	m_theme.loadFromSettings(core::getSettings()->extract("theme"));
 	setTheme(m_theme);
+	// the settings and the themes can be tuned from outside while running
+	core::watchSettings();
 
 	m_mainWindow.setEventCallback([this]<typename T>(T&& ioEvent) -> auto { onEvent(std::forward<T>(ioEvent)); });
 
@@ -92,6 +116,8 @@ Application::Application() {
 Application::~Application() {
 	log_info("Shutting down application.");
 	// Cleanup
+	m_saver.wait();
+	m_autosave.stop();
 	m_mainWindow.close();
 }
 
@@ -107,6 +133,16 @@ void Application::run() {
 		m_mainWindow.newFrame();
 		if (m_state != State::Running)
 			continue;
+		// the theme is applied again only if one of its keys changed; the display reads the "gui" section again
+		// only if it changed
+		if (const auto keys = core::reloadSettings(); !keys.empty()) {
+			if (std::ranges::any_of(keys, [](const std::string& iKey) { return iKey.starts_with("theme/"); })) {
+				m_theme.loadFromSettings(core::getSettings()->extract("theme"));
+				m_mainWindow.setTheme(m_theme);
+			}
+			if (std::ranges::find(keys, "general/rng_engine") != keys.end())
+				applyRngEngine();
+		}
 		const auto dview = getView("display_window");
 		if (isDisplayNeeded()) {
 			if (!dview->visibility())
@@ -196,9 +232,11 @@ void Application::checkActionEnable() const {
 	if (status == core::Event::Status::Invalid || status == core::Event::Status::MissingParties) {
 		getAction("save_file_as")->disable();
 		getAction("save_file")->disable();
+		getAction("archive_event")->disable();
 	} else {
 		getAction("save_file")->enable();
 		getAction("save_file_as")->enable();
+		getAction("archive_event")->enable();
 	}
 	if (status == core::Event::Status::Ready) {
 		getAction("start_game")->enable();
@@ -215,6 +253,63 @@ void Application::checkActionEnable() const {
 	} else {
 		getAction("game_settings")->enable();
 	}
+	if (m_journal.canUndo()) {
+		getAction("undo")->enable();
+	} else {
+		getAction("undo")->disable();
+	}
+	if (m_journal.canRedo()) {
+		getAction("redo")->enable();
+	} else {
+		getAction("redo")->disable();
+	}
+}
+
+void Application::saveCurrentEvent(const std::filesystem::path& iFile) {
+	m_currentEvent.setBasePath(iFile);
+	m_saver.save(m_currentEvent, iFile);
+	// the autosave log follows the event file
+	m_currentFile = iFile;
+	m_autosave.moveTo(core::Autosave::logPath(iFile));
+}
+
+auto Application::archiveCurrentEvent(const std::filesystem::path& iFile) -> bool {
+	if (!exists(iFile))
+		m_archive.close();
+	else if (m_archive.getPath() != iFile && !m_archive.open(iFile))
+		return false;
+	// the archived events are copied without decoding, the mapping is released before the replacement
+	core::SeasonArchiveWriter writer;
+	for (size_t i = 0; i < m_archive.size(); ++i) writer.add(m_archive, i);
+	writer.add(m_currentEvent);
+	m_archive.close();
+	const bool written = writer.write(iFile);
+	return m_archive.open(iFile) && written;
+}
+
+void Application::restartJournal() {
+	m_autosave.start(core::Autosave::logPath(m_currentFile));
+	m_journal.reset();
+}
+
+void Application::syncRng() {
+	m_rng.resetPick();
+	if (m_currentEvent.canDraw()) {
+		for (const auto number: m_currentEvent.getCurrentCGameRound()->getDrawLog().draws()) m_rng.addPick(number);
+	}
+}
+
+void Application::applyRngEngine() {
+	const auto name = core::getSettings()->getValue<std::string>("general/rng_engine", "Pcg");
+	const auto engine = magic_enum::enum_cast<core::RandomNumberGenerator::Engine>(name);
+	if (!engine.has_value()) {
+		log_warn("Unknown random number generator '{}', keeping {}.", name, magic_enum::enum_name(m_rng.getEngine()));
+		return;
+	}
+	if (engine.value() == m_rng.getEngine())
+		return;
+	m_rng.setEngine(engine.value());
+	log_info("Random number generator: {}.", name);
 }
 
 auto Application::isDisplayNeeded() const -> bool {
@@ -10,8 +10,12 @@
 
 #include "MainWindow.h"
 #include "actions/Action.h"
+#include "core/Autosave.h"
+#include "core/EventSaver.h"
+#include "core/Journal.h"
 #include "core/Log.h"
 #include "core/RandomNumberGenerator.h"
+#include "core/SeasonArchive.h"
 #include "event/KeyCodes.h"
 #include "views/Popups.h"
 #include "views/View.h"
@@ -174,6 +178,58 @@ public:
 	 */
 	auto getCurrentEvent() -> core::Event& { return m_currentEvent; }
 
+	/**
+	 * @brief Access to the journal of the current Event.
+	 * @return The journal.
+	 */
+	auto getJournal() -> core::Journal& { return m_journal; }
+
+	/**
+	 * @brief Access to the crash-safe autosave of the current Event.
+	 * @return The autosave.
+	 */
+	auto getAutosave() -> core::Autosave& { return m_autosave; }
+
+	/**
+	 * @brief Access to the background saver of the events.
+	 * @return The saver.
+	 */
+	auto getSaver() -> core::EventSaver& { return m_saver; }
+
+	/**
+	 * @brief Access to the opened season archive.
+	 * @return The archive.
+	 */
+	auto getArchive() -> core::SeasonArchive& { return m_archive; }
+
+	/**
+	 * @brief Add the current event at the end of a season archive, created if needed, and open it.
+	 * @param iFile The archive.
+	 * @return False if the archive cannot be read or written.
+	 */
+	auto archiveCurrentEvent(const std::filesystem::path& iFile) -> bool;
+
+	/**
+	 * @brief Save the current event in a file on the background saver.
+	 * @param iFile The file.
+	 */
+	void saveCurrentEvent(const std::filesystem::path& iFile);
+
+	/**
+	 * @brief Start a new journal and a new autosave log for the current event (after a load or a new event).
+	 */
+	void restartJournal();
+
+	/**
+	 * @brief Put the draws of the current round back in the random number generator after a jump in the journal.
+	 */
+	void syncRng();
+
+	/**
+	 * @brief Use the random number generator chosen in the settings (general/rng_engine).
+	 */
+	void applyRngEngine();
+
 	/**
 	 * @brief Access to the current file.
 	 * @return The current file.
@@ -263,6 +319,14 @@ private:
 
 	/// The current event.
 	core::Event m_currentEvent{};
+	/// The journal of the current event (undo, redo).
+	core::Journal m_journal{m_currentEvent};
+	/// The crash-safe autosave of the journal.
+	core::Autosave m_autosave;
+	/// The background saver.
+	core::EventSaver m_saver;
+	/// The opened season archive.
+	core::SeasonArchive m_archive;
 	/// The current file.
 	std::filesystem::path m_currentFile{};
 	/// The current draw mode.
@@ -9,6 +9,7 @@
 
 #include "FileActions.h"
 
+#include "core/EventFile.h"
 #include "gui_imgui/Application.h"
 #include "gui_imgui/utils/FileDialog.h"
 
@@ -21,6 +22,8 @@ void NewFileAction::onExecute() {
 	auto& app = Application::get();
 	app.getCurrentEvent() = core::Event{};
 	app.getCurrentFile().clear();
+	app.restartJournal();
+	app.syncRng();
 }
 
 
@@ -36,13 +39,20 @@ void LoadFileAction::onExecute() {
 	auto& app = Application::get();
 	app.getCurrentFile() = file;
 
-	std::ifstream f;
-	f.open(file, std::ios::in | std::ios::binary);
 	app.getCurrentEvent().setBasePath(file);
-	app.getCurrentEvent().read(f, 0);
+	// the chunked files are mapped, the older versions go through the stream
+	if (core::EventFileView view; view.open(file)) {
+		app.getCurrentEvent().readChunks(view);
+	} else {
+		std::ifstream f;
+		f.open(file, std::ios::in | std::ios::binary);
+		app.getCurrentEvent().read(f, 0);
+		f.close();
+	}
 	app.getCurrentFile() = file;
+	app.restartJournal();
+	app.syncRng();
 	log_info("File '{}' loaded successfully.", file.string());
-	f.close();
 }
 
 
@@ -64,12 +74,8 @@ void SaveFileAction::onExecute() {
 			return;
 		}
 	}
-	std::ofstream f;
-	f.open(file, std::ios::out | std::ios::binary);
-	app.getCurrentEvent().setBasePath(file);
-	app.getCurrentEvent().write(f);
-	log_info("File '{}' saved successfully.", file.string());
-	f.close();
+	app.saveCurrentEvent(file);
+	log_trace("Save of '{}' requested.", file.string());
 }
 
 
@@ -85,12 +91,43 @@ void SaveAsFileAction::onExecute() {
 		return;
 	}
 	file = newfile;
-	std::ofstream f;
-	f.open(file, std::ios::out | std::ios::binary);
-	app.getCurrentEvent().setBasePath(file);
-	app.getCurrentEvent().write(f);
-	log_info("File '{}' saved successfully.", file.string());
-	f.close();
+	app.saveCurrentEvent(file);
+	log_trace("Save of '{}' requested.", file.string());
+}
+
+OpenArchiveAction::OpenArchiveAction() { setIconName("date-span"); }
+OpenArchiveAction::~OpenArchiveAction() = default;
+void OpenArchiveAction::onExecute() {
+	log_trace("Open archive action executed.");
+	const auto file = utils::FileDialog::openFile(utils::g_archiveFilter);
+	if (file.empty() || !exists(file)) {
+		log_trace("Open archive action canceled.");
+		return;
+	}
+	auto& app = Application::get();
+	// only the index is read, the events are decoded when loaded
+	if (!app.getArchive().open(file))
+		return;
+	if (const auto pop = app.getPopup("popup_archive"))
+		pop->open();
+}
+
+
+ArchiveEventAction::ArchiveEventAction() { setIconName("date-to"); }
+ArchiveEventAction::~ArchiveEventAction() = default;
+void ArchiveEventAction::onExecute() {
+	log_trace("Archive event action executed.");
+	const auto file = utils::FileDialog::saveFile(utils::g_archiveFilter);
+	if (file.empty()) {
+		log_trace("Archive event action canceled.");
+		return;
+	}
+	auto& app = Application::get();
+	if (!app.archiveCurrentEvent(file))
+		return;
+	log_info("Event archived in '{}'.", file.string());
+	if (const auto pop = app.getPopup("popup_archive"))
+		pop->open();
 }
 
 QuitAction::QuitAction() = default;
@@ -93,6 +93,46 @@ private:
 };
 
 
+/**
+ * @brief Class OpenArchiveAction: open a season archive and list its events.
+ */
+class OpenArchiveAction final : public Action {
+public:
+	OpenArchiveAction();
+	~OpenArchiveAction() override;
+	OpenArchiveAction(const OpenArchiveAction&) = delete;
+	OpenArchiveAction(OpenArchiveAction&&) = delete;
+	auto operator=(const OpenArchiveAction&) -> OpenArchiveAction& = delete;
+	auto operator=(OpenArchiveAction&&) -> OpenArchiveAction& = delete;
+	[[nodiscard]] auto getName() const -> std::string override { return "open_archive"; }
+
+private:
+	/**
+	 * @brief Execute the action.
+	 */
+	void onExecute() override;
+};
+
+/**
+ * @brief Class ArchiveEventAction: add the current event to a season archive.
+ */
+class ArchiveEventAction final : public Action {
+public:
+	ArchiveEventAction();
+	~ArchiveEventAction() override;
+	ArchiveEventAction(const ArchiveEventAction&) = delete;
+	ArchiveEventAction(ArchiveEventAction&&) = delete;
+	auto operator=(const ArchiveEventAction&) -> ArchiveEventAction& = delete;
+	auto operator=(ArchiveEventAction&&) -> ArchiveEventAction& = delete;
+	[[nodiscard]] auto getName() const -> std::string override { return "archive_event"; }
+
+private:
+	/**
+	 * @brief Execute the action.
+	 */
+	void onExecute() override;
+};
+
 class QuitAction final : public Action {
 public:
 	QuitAction();
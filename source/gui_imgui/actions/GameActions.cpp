@@ -23,7 +23,7 @@ void StartGameAction::onExecute() {
 	if (app.getCurrentEvent().getStatus() != core::Event::Status::Ready) {
 		return;
 	}
-	app.getCurrentEvent().nextState();
+	app.getJournal().nextState();
 	log_trace("Start game action executed.");
 }
 
@@ -36,9 +36,10 @@ GameNextActions::GameNextActions() { setIconName("submit-for-approval"); }
 GameNextActions::~GameNextActions() = default;
 void GameNextActions::onExecute() {
 	auto& currentEvent = Application::get().getCurrentEvent();
+	auto& journal = Application::get().getJournal();
 
 	if (currentEvent.getStatus() == core::Event::Status::DisplayRules) {
-		currentEvent.displayRules();// The call in this state willrestore previous state.
+		journal.displayRules();// The call in this state willrestore previous state.
 		return;// No further action needed.
 	}
 	bool goNext = true;
@@ -47,13 +48,15 @@ void GameNextActions::onExecute() {
 			round->getType() != core::GameRound::Type::Pause &&
 			round->getStatus() == core::GameRound::Status::Running) {
 			if (round->getCurrentSubRound()->getStatus() == core::SubGameRound::Status::Running) {
-				currentEvent.addWinnerToCurrentRound("john_doe");// Placeholder for winner input
+				// Use the cards detected by the registry, fall back to a placeholder for unregistered cards.
+				const auto winners = currentEvent.getPendingWinnersStr();
+				journal.addWinner(winners.empty() ? "john_doe" : winners);
 				goNext = false;
 			}
 		}
 	}
 	if (goNext) {
-		currentEvent.nextState();
+		journal.nextState();
 	}
 	if (const auto round = currentEvent.getCurrentCGameRound();
 		round->getType() != core::GameRound::Type::Pause && round->drawsCount() == 0) {
@@ -67,7 +70,7 @@ void RandomPickAction::onExecute() {
 	auto& event = Application::get().getCurrentEvent();
 	if (!event.canDraw())
 		return;
-	event.getCurrentGameRound()->addPickedNumber(Application::get().getRng().pick());
+	Application::get().getJournal().draw(Application::get().getRng().pick());
 	log_trace("Random pick action executed.");
 }
 
@@ -77,7 +80,7 @@ void CancelPickAction::onExecute() {
 	auto& event = Application::get().getCurrentEvent();
 	if (!event.canDraw())
 		return;
-	event.getCurrentGameRound()->removeLastPick();
+	Application::get().getJournal().cancelPick();
 	Application::get().getRng().popNum();
 	log_trace("Cancel pick action executed.");
 }
@@ -85,8 +88,25 @@ void CancelPickAction::onExecute() {
 DisplayRulesAction::DisplayRulesAction() { setIconName("terms-and-conditions"); }
 DisplayRulesAction::~DisplayRulesAction() = default;
 void DisplayRulesAction::onExecute() {
-	auto& event = Application::get().getCurrentEvent();
-	event.displayRules();
+	Application::get().getJournal().displayRules();
+}
+
+UndoAction::UndoAction() { setIconName("restart"); }
+UndoAction::~UndoAction() = default;
+void UndoAction::onExecute() {
+	if (!Application::get().getJournal().undo())
+		return;
+	Application::get().syncRng();
+	log_trace("Undo action executed.");
+}
+
+RedoAction::RedoAction() = default;
+RedoAction::~RedoAction() = default;
+void RedoAction::onExecute() {
+	if (!Application::get().getJournal().redo())
+		return;
+	Application::get().syncRng();
+	log_trace("Redo action executed.");
 }
 
 }// namespace evl::gui_imgui::actions
@@ -151,4 +151,56 @@ private:
 	void onExecute() override;
 };
 
+/**
+ * @brief Class UndoAction: undo the last operation of the journal.
+ */
+class UndoAction final : public Action {
+public:
+	/**
+	 * @brief Default constructor.
+	 */
+	UndoAction();
+	/**
+	 * @brief Default destructor.
+	 */
+	~UndoAction() override;
+	UndoAction(const UndoAction&) = delete;
+	UndoAction(UndoAction&&) = delete;
+	auto operator=(const UndoAction&) -> UndoAction& = delete;
+	auto operator=(UndoAction&&) -> UndoAction& = delete;
+	[[nodiscard]] auto getName() const -> std::string override { return "undo"; }
+
+private:
+	/**
+	 * @brief Execute the action.
+	 */
+	void onExecute() override;
+};
+
+/**
+ * @brief Class RedoAction: redo the last undone operation of the journal.
+ */
+class RedoAction final : public Action {
+public:
+	/**
+	 * @brief Default constructor.
+	 */
+	RedoAction();
+	/**
+	 * @brief Default destructor.
+	 */
+	~RedoAction() override;
+	RedoAction(const RedoAction&) = delete;
+	RedoAction(RedoAction&&) = delete;
+	auto operator=(const RedoAction&) -> RedoAction& = delete;
+	auto operator=(RedoAction&&) -> RedoAction& = delete;
+	[[nodiscard]] auto getName() const -> std::string override { return "redo"; }
+
+private:
+	/**
+	 * @brief Execute the action.
+	 */
+	void onExecute() override;
+};
+
 }// namespace evl::gui_imgui::actions
@@ -11,6 +11,7 @@
 namespace evl::gui_imgui::utils {
 
 const std::string g_gameFilter = "Loto Files|lev";
+const std::string g_archiveFilter = "Season Archives|lsa";
 const std::string g_imageFilter = "Image Files|png,jpg,jpeg,bmp,tga,gif,svg\n"
 								  "PNG Files|png\n"
 								  "JPG Files|jpg,jpeg\n"
@@ -19,6 +20,7 @@ const std::string g_imageFilter = "Image Files|png,jpg,jpeg,bmp,tga,gif,svg\n"
 								  "GIF Files|gif\n"
 								  "SVG Files|svg";
 const std::string g_yamlFilter = "YAML Files|yaml,yml";
+const std::string g_cardPackFilter = "Card Packs|evc";
 
 /**
  * @brief Class FileDialog.
@@ -0,0 +1,107 @@
+/**
+ * @file ArchivePopups.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "ArchivePopups.h"
+
+#include "core/Log.h"
+#include "gui_imgui/Application.h"
+
+#include <imgui.h>
+
+namespace evl::gui_imgui::views {
+
+namespace {
+constexpr float g_buttonWidth = 100.0f;
+constexpr float g_buttonSectionHeight = 50.0f;
+}// namespace
+
+ArchivePopup::ArchivePopup() = default;
+ArchivePopup::~ArchivePopup() = default;
+
+void ArchivePopup::onPopupUpdate() {
+	auto& archive = Application::get().getArchive();
+	if (archive.isOpen())
+		ImGui::Text("%s: %zu événements", archive.getPath().filename().string().c_str(), archive.size());
+	else
+		ImGui::Text("Aucune archive ouverte.");
+
+	// seul l’index est lu: les événements sont décodés au chargement
+	const ImVec2 contentAvail = ImGui::GetContentRegionAvail();
+	if (ImGui::BeginChild("ArchiveList", ImVec2(0, contentAvail.y - g_buttonSectionHeight), ImGuiChildFlags_Borders)) {
+		constexpr ImGuiTableFlags tableFlags = ImGuiTableFlags_Resizable | ImGuiTableFlags_SizingStretchProp |
+											   ImGuiTableFlags_RowBg | ImGuiTableFlags_NoSavedSettings;
+		if (ImGui::BeginTable("ArchiveTable", 5, tableFlags)) {
+			ImGui::TableSetupColumn("Nom", ImGuiTableColumnFlags_WidthStretch, 2.0f);
+			ImGui::TableSetupColumn("Date", ImGuiTableColumnFlags_WidthStretch, 1.2f);
+			ImGui::TableSetupColumn("Lieu", ImGuiTableColumnFlags_WidthStretch, 1.5f);
+			ImGui::TableSetupColumn("Statut", ImGuiTableColumnFlags_WidthStretch, 1.0f);
+			ImGui::TableSetupColumn("Parties", ImGuiTableColumnFlags_WidthStretch, 0.6f);
+			ImGui::TableHeadersRow();
+			for (size_t i = 0; i < archive.size(); ++i) {
+				const auto& header = archive.getHeader(i);
+				ImGui::TableNextRow();
+				ImGui::TableSetColumnIndex(0);
+				const std::string label = std::format("{}##archive{}", header.name, i);
+				if (ImGui::Selectable(label.c_str(), m_selected == i,
+									  ImGuiSelectableFlags_SpanAllColumns | ImGuiSelectableFlags_AllowDoubleClick)) {
+					m_selected = i;
+					if (ImGui::IsMouseDoubleClicked(ImGuiMouseButton_Left)) {
+						loadSelected();
+						ImGui::CloseCurrentPopup();
+					}
+				}
+				ImGui::TableSetColumnIndex(1);
+				if (header.start != core::g_epoch)
+					ImGui::Text("%s", core::formatCalendar(header.start).c_str());
+				ImGui::TableSetColumnIndex(2);
+				ImGui::Text("%s", header.location.c_str());
+				ImGui::TableSetColumnIndex(3);
+				ImGui::Text("%s", std::string(magic_enum::enum_name(header.status)).c_str());
+				ImGui::TableSetColumnIndex(4);
+				ImGui::Text("%u", header.roundCount);
+			}
+			ImGui::EndTable();
+		}
+	}
+	ImGui::EndChild();
+
+	ImGui::BeginDisabled(m_selected >= archive.size());
+	if (ImGui::Button("Charger", ImVec2(g_buttonWidth, 0))) {
+		loadSelected();
+		ImGui::CloseCurrentPopup();
+	}
+	ImGui::EndDisabled();
+	ImGui::SameLine();
+	ImGui::BeginDisabled(!archive.isOpen());
+	if (ImGui::Button("Archiver", ImVec2(g_buttonWidth, 0))) {
+		const auto path = archive.getPath();
+		Application::get().archiveCurrentEvent(path);
+	}
+	ImGui::SetItemTooltip("Ajoute l'événement courant à la fin de l'archive");
+	ImGui::EndDisabled();
+	ImGui::SameLine();
+	if (ImGui::Button("Fermer", ImVec2(g_buttonWidth, 0))) {
+		ImGui::CloseCurrentPopup();
+	}
+}
+
+void ArchivePopup::loadSelected() const {
+	auto& app = Application::get();
+	const auto event = app.getArchive().getEvent(m_selected);
+	if (event == nullptr)
+		return;
+	app.getCurrentEvent() = *event;
+	// l’événement n’a pas de fichier propre: il faudra le sauver sous un nouveau nom
+	app.getCurrentFile().clear();
+	app.restartJournal();
+	app.syncRng();
+	log_info("Événement '{}' chargé depuis l'archive.", event->getName());
+}
+
+}// namespace evl::gui_imgui::views
@@ -0,0 +1,60 @@
+/**
+ * @file ArchivePopups.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+
+#pragma once
+#include "Popups.h"
+
+namespace evl::gui_imgui::views {
+
+/**
+ * @brief Class ArchivePopup: list of the events of the opened season archive.
+ */
+class ArchivePopup final : public Popup {
+public:
+	/// Default constructor.
+	ArchivePopup();
+	/// Default destructor.
+	~ArchivePopup() override;
+
+	ArchivePopup(const ArchivePopup&) = delete;
+	ArchivePopup(ArchivePopup&&) = delete;
+	auto operator=(const ArchivePopup&) -> ArchivePopup& = delete;
+	auto operator=(ArchivePopup&&) -> ArchivePopup& = delete;
+
+	/**
+	 * @brief Function called at Update Time.
+	 */
+	void onPopupUpdate() override;
+
+	/**
+	 * @brief Get the name of the view.
+	 * @return The name of the view.
+	 */
+	[[nodiscard]] auto getName() const -> std::string override { return "popup_archive"; }
+
+	/**
+	 * @brief Get the popup title.
+	 * @return The popup title.
+	 */
+	[[nodiscard]] auto getPopupTitle() const -> std::string override { return "Archive de saison"; }
+
+protected:
+	/// Function called when the popup is opened.
+	void onOpen() override { m_selected = 0; }
+
+private:
+	/**
+	 * @brief Load the selected event as the current event.
+	 */
+	void loadSelected() const;
+
+	/// Index of the selected event.
+	size_t m_selected = 0;
+};
+
+}// namespace evl::gui_imgui::views
@@ -10,6 +10,8 @@
 #include "ConfigPopups.h"
 
 #include "DisplayView.h"
+#include "core/CardGenerator.h"
+#include "core/CardPack.h"
 #include "core/Log.h"
 #include "core/Settings.h"
 #include "core/maths/vectors.h"
@@ -252,6 +254,7 @@ void MainConfigPopups::dataToSettings() {
 	settings.setValue("fade_strength", m_data.fadeStrength);
 	core::getSettings()->include(settings, "gui");
 	core::getSettings()->setValue("general/data_location", std::string{m_data.dataLocation.string()});
+	core::saveSettings();
 }
 
 void MainConfigPopups::settingsToData() {
@@ -338,6 +341,47 @@ void EventConfigPopups::onPopupUpdate() {
 	}
 	ImGui::EndChild();
 
+	// Cartons
+	if (ImGui::BeginChild("Cards", ImVec2(0, 100), ImGuiWindowFlags_NoTitleBar)) {
+		ImGui::Text("Cartons (%zu)", m_event.getCards().size());
+		ImGui::Separator();
+
+		ImGui::Columns(2, "CardsColumns");
+		ImGui::SetColumnWidth(0, 200);
+
+		ImGui::Text("Fichier de cartons:");
+		ImGui::NextColumn();
+		ImGui::SetNextItemWidth(-80);
+		std::string cardPack = m_event.getCardPack().string();
+		if (ImGui::InputText("##CardPack", &cardPack, tags | ImGuiInputTextFlags_EnterReturnsTrue)) {
+			m_event.setCardPack(cardPack);
+		}
+		ImGui::SameLine();
+		if (ImGui::Button("...##SearchCardPack") && (tags & ImGuiInputTextFlags_ReadOnly) == 0) {
+			if (const auto path = utils::FileDialog::openFile(utils::g_cardPackFilter); !path.empty()) {
+				m_event.setCardPack(path);
+			}
+		}
+		ImGui::NextColumn();
+
+		ImGui::Text("Générer (nombre, graine):");
+		ImGui::NextColumn();
+		ImGui::SetNextItemWidth(120);
+		ImGui::InputInt("##CardCount", &m_cardCount, 100, 10000, tags);
+		m_cardCount = std::max(m_cardCount, 1);
+		ImGui::SameLine();
+		ImGui::SetNextItemWidth(-80);
+		ImGui::InputScalar("##CardSeed", ImGuiDataType_U64, &m_cardSeed, nullptr, nullptr, nullptr, tags);
+		ImGui::SameLine();
+		if (ImGui::Button("Générer##GenerateCards") && (tags & ImGuiInputTextFlags_ReadOnly) == 0) {
+			generateCardPack();
+		}
+		ImGui::NextColumn();
+
+		ImGui::Columns(1);
+	}
+	ImGui::EndChild();
+
 	// Organisateur
 	if (ImGui::BeginChild("Organizer", ImVec2(0, 100), ImGuiWindowFlags_NoTitleBar)) {
 		ImGui::Text("Organisateur");
@@ -441,6 +485,19 @@ void EventConfigPopups::onPopupUpdate() {
 	}
 }
 
+void EventConfigPopups::generateCardPack() {
+	auto path = utils::FileDialog::saveFile(utils::g_cardPackFilter);
+	if (path.empty())
+		return;
+	if (path.extension() != ".evc")
+		path.replace_extension(".evc");
+	const core::CardGenerator generator(m_cardSeed);
+	const auto cards = generator.generate(static_cast<size_t>(m_cardCount));
+	if (!core::CardPack::write(path, cards, m_cardSeed))
+		return;
+	m_event.setCardPack(path);
+}
+
 void EventConfigPopups::fromCurrentEvent() {
 	// Load data from current event
 	m_event = Application::get().getCurrentEvent();
@@ -479,6 +536,7 @@ GameRoundConfigPopups::~GameRoundConfigPopups() = default;
 void GameRoundConfigPopups::onOpen() {
 	// Initialisation des données si nécessaire
 	fromCurrentEvent();
+	m_importResult.clear();
 }
 
 void GameRoundConfigPopups::onClose() {
@@ -592,7 +650,11 @@ void GameRoundConfigPopups::onPopupUpdate() {
 		if (ImGui::Button("Importer", ImVec2(g_buttonWidth, 0))) {
 			// Action import
 			if (const auto path = utils::FileDialog::openFile(utils::g_yamlFilter); !path.empty()) {
-				m_event.importYaml(path);
+				m_importFailed = !m_event.importYaml(path);
+				m_importResult = m_importFailed ? std::format("Import de '{}' impossible", path.filename().string())
+												: std::format("Parties importées de '{}'", path.filename().string());
+				m_selectedGameRound = 0;
+				m_selectedSubRound = 0;
 			}
 		}
 		ImGui::SameLine();
@@ -602,6 +664,12 @@ void GameRoundConfigPopups::onPopupUpdate() {
 				m_event.exportYaml(path);
 			}
 		}
+		if (!m_importResult.empty()) {
+			if (m_importFailed)
+				ImGui::TextColored({1.0f, 0.30f, 0.30f, 1.0f}, "%s", m_importResult.c_str());
+			else
+				ImGui::TextUnformatted(m_importResult.c_str());
+		}
 	}
 	ImGui::EndChild();
 }
@@ -133,7 +133,15 @@ public:
 private:
 	/// The event copy.
 	core::Event m_event;
+	/// Number of cards to generate.
+	int m_cardCount = 1000;
+	/// Seed of the card generation.
+	uint64_t m_cardSeed = 0;
 
+	/**
+	 * @brief Generate a card pack and attach it to the event.
+	 */
+	void generateCardPack();
 	/**
 	 * @brief Load data from current event.
 	 */
@@ -205,6 +213,10 @@ private:
 
 	size_t m_selectedSubRound = 0;
 	size_t m_selectedGameRound = 0;
+	/// Result of the last import, empty if none.
+	std::string m_importResult;
+	/// True if the last import failed.
+	bool m_importFailed = false;
 	/**
 	 * @brief Load data from current event.
 	 */
@@ -25,12 +25,15 @@ namespace evl::gui_imgui::views {
 
 namespace {
 
+/// Number of surviving cards listed in inverse games.
+constexpr size_t g_survivorListSize = 10;
+
 void renderTitle(const std::string& iTitle, const math::vec2& iRegion, const float iExtraScale = 1.0f) {
 	// Part title
-	const auto gui_settings = core::getSettings()->extract("gui");
+	const auto& gui_settings = core::getGuiSettings();
 	ImGui::SetCursorPosY(iRegion.y() * 0.05f);
 
-	if (const auto scale = gui_settings.getValue("title_scale", 4.0f) * iExtraScale; scale > 0.0f) {
+	if (const auto scale = gui_settings.titleScale * iExtraScale; scale > 0.0f) {
 		ImGui::SetWindowFontScale(scale);
 	}
 	const ImVec2 titleSize = ImGui::CalcTextSize(iTitle.c_str());
@@ -205,7 +208,7 @@ void DisplayView::onUpdate() {
 void DisplayView::renderEventStart() const {
 	const float contentWidth = ImGui::GetContentRegionAvail().x;
 	const float contentHeight = ImGui::GetContentRegionAvail().y;
-	const auto gui_settings = core::getSettings()->extract("gui");
+	const auto& gui_settings = core::getGuiSettings();
 
 	// Top row: Organizer logo (left) and organizer name (right)
 	if (ImGui::BeginChild("TopRow", {0, contentHeight * 0.15f}, ImGuiChildFlags_None)) {
@@ -235,7 +238,7 @@ void DisplayView::renderEventStart() const {
 
 	// Event title
 	ImGui::SetCursorPosY(ImGui::GetCursorPosY() + contentHeight * 0.05f);
-	if (const float scale = gui_settings.getValue("title_scale", 4.0f); scale > 0.f)
+	if (const float scale = gui_settings.titleScale; scale > 0.f)
 		ImGui::SetWindowFontScale(scale);
 	const ImVec2 titleSize = ImGui::CalcTextSize(m_currentEvent.getName().c_str());
 	ImGui::SetCursorPosX((contentWidth - titleSize.x) * 0.5f);
@@ -298,7 +301,7 @@ void DisplayView::renderEventRules() const {
 }
 
 void DisplayView::renderRoundReady() const {
-	const auto gui_settings = core::getSettings()->extract("gui");
+	const auto& gui_settings = core::getGuiSettings();
 	const auto& style = ImGui::GetStyle();
 	math::vec2 region = utils::imVec2ToVec2(ImGui::GetContentRegionAvail());
 	auto currentRound = m_currentEvent.getCurrentGameRound();
@@ -322,8 +325,8 @@ void DisplayView::renderRoundReady() const {
 	const float frameWidth = region.x() * 0.90f;
 
 	const ImVec2 vSize = ImGui::CalcTextSize("Valeur");
-	const auto value_scale = gui_settings.getValue("value_scale", 3.f);
-	const auto price_scale = gui_settings.getValue("prices_scale", 2.5f);
+	const auto value_scale = gui_settings.valueScale;
+	const auto price_scale = gui_settings.pricesScale;
 	const std::string valueText = std::format("{:.2f} €", currentSubRound->getValue());
 	const ImVec2 valueSize = ImGui::CalcTextSize(valueText.c_str());
 	const float valueHeight = (value_scale > 0 ? value_scale * valueSize.y : valueSize.y) + vSize.y +
@@ -371,14 +374,14 @@ void DisplayView::renderRoundRunning() const {
 	}
 	const auto currentSubRound = currentRound->getCurrentSubRound();
 
-	const auto gui_settings = core::getSettings()->extract("gui");
+	const auto& gui_settings = core::getGuiSettings();
 	const auto& style = ImGui::GetStyle();
 	math::vec2 region = utils::imVec2ToVec2(ImGui::GetContentRegionAvail());
 
 	// Part title
 	ImGui::SetCursorPosY(region.y() * 0.05f);
 	const std::string title = std::format("{} - {}", currentRound->getName(), currentSubRound->getTypeStr());
-	if (const auto scale = gui_settings.getValue("title_scale", 4.0f); scale > 0.0f) {
+	if (const auto scale = gui_settings.titleScale; scale > 0.0f) {
 		ImGui::SetWindowFontScale(scale);
 	}
 	const ImVec2 titleSize = ImGui::CalcTextSize(title.c_str());
@@ -396,31 +399,29 @@ void DisplayView::renderRoundRunning() const {
 	if (ImGui::BeginChild("NumberGridPanel", {leftPanelWidth, contentHeight}, ImGuiChildFlags_Borders)) {
 		// Render 9x10 grid
 		const ImVec2 availWidth = ImGui::GetContentRegionAvail();
-		const math::vec2 spacing = gui_settings.getValue("grid_button_spacing", math::vec2{4.0f, 4.0f});
+		const math::vec2& spacing = gui_settings.gridSpacing;
 		const ImVec2 buttonSize{(availWidth.x - spacing.x() * 9) / 10.0f, (availWidth.y - spacing.y() * 8) / 9.0f};
 
-		const auto buttonColor = gui_settings.getValue("grid_background_color", math::vec4{0.1f, 0.1f, 0.1f, 1.0f});
+		const auto& buttonColor = gui_settings.gridBackgroundColor;
 
-		const auto fading = gui_settings.getValue("fade_numbers", true);
-		const auto fadingCount = gui_settings.getValue("fade_amount", 3);
-		const auto fadingStrength = gui_settings.getValue("fade_strength", 0.5f);
-		const auto buttonColorActiveLast =
-				gui_settings.getValue("selected_number_color", math::vec4{1.f, 0.44f, 0.f, 1.0f});
+		const auto fading = gui_settings.fadeNumbers;
+		const auto fadingCount = gui_settings.fadeAmount;
+		const auto fadingStrength = gui_settings.fadeStrength;
+		const auto& buttonColorActiveLast = gui_settings.selectedNumberColor;
 		const auto buttonColorActivePrev = buttonColorActiveLast * (1.f - fadingStrength);
 		const auto buttonColorActive = buttonColorActivePrev * (1.f - fadingStrength);
-		const auto gridTextScale = gui_settings.getValue("grid_text_scale", 0.9f);
-		const auto drawnNumbers = currentRound->getAllDraws();
+		const auto gridTextScale = gui_settings.gridTextScale;
+		const auto& drawLog = currentRound->getDrawLog();
 
 		for (uint8_t row = 0; row < 9; ++row) {
 			for (uint8_t col = 0; col < 10; ++col) {
 				const uint8_t number = row * 10 + col + 1;
 				ImGui::SetCursorPos({static_cast<float>(col) * (buttonSize.x + spacing.x()) + style.WindowPadding.x,
 									 static_cast<float>(row) * (buttonSize.y + spacing.y()) + style.WindowPadding.y});
-				if (auto it = std::ranges::find(std::ranges::reverse_view(drawnNumbers), number);
-					it != drawnNumbers.rend()) {
+				if (const auto index = drawLog.recency(number); index != core::DrawLog::g_notDrawn) {
 					if (fading) {
 						// Determine how recent the number was drawn
-						if (const auto index = std::distance(drawnNumbers.rbegin(), it); index == 0) {// Most recent
+						if (index == 0) {// Most recent
 							ImGui::PushStyleColor(ImGuiCol_Button, utils::vec4ToImVec4(buttonColorActiveLast));
 						} else if (std::cmp_less(index, fadingCount + 1)) {// Within fading range
 							ImGui::PushStyleColor(ImGuiCol_Button, utils::vec4ToImVec4(buttonColorActivePrev));
@@ -457,8 +458,8 @@ void DisplayView::renderRoundRunning() const {
 		ImGui::Separator();
 
 		ImGui::BeginGroup();
-		const auto drawnNumbers = currentRound->getAllDraws();
-		const std::string lastNumberText = drawnNumbers.empty() ? "--" : std::format("{}", drawnNumbers.back());
+		const auto& drawLog = currentRound->getDrawLog();
+		const std::string lastNumberText = drawLog.empty() ? "--" : std::format("{}", drawLog.last());
 		utils::adaptTextToRegion(lastNumberText, {.autoRegion = false,
 												  .contentSize = {fullWidth, ImGui::GetContentRegionAvail().y},
 												  .vCenter = false,
@@ -467,6 +468,14 @@ void DisplayView::renderRoundRunning() const {
 												  .textAdapt = "00"});
 		ImGui::EndGroup();
 
+		// Remaining players in inverse games
+		if (currentRound->getType() == core::GameRound::Type::Inverse && !m_currentEvent.getCards().empty()) {
+			const auto survivors = m_currentEvent.getSurvivorCount();
+			ImGui::Text("Joueurs restants: %zu", survivors);
+			if (survivors > 0 && survivors <= g_survivorListSize)
+				ImGui::TextWrapped("%s", m_currentEvent.getSurvivorsStr(g_survivorListSize).c_str());
+		}
+
 		// Logo
 		ImGui::BeginGroup();
 		const float size = std::min(fullWidth, ImGui::GetContentRegionAvail().y - ImGui::GetCursorPosY());
@@ -478,7 +487,7 @@ void DisplayView::renderRoundRunning() const {
 
 		// Timing info
 		const auto textHeigh = ImGui::CalcTextSize("D").y;
-		const float timeScale = gui_settings.getValue("time_scale", 1.6f);
+		const float timeScale = gui_settings.timeScale;
 		auto now = core::clock::now();
 		auto elapsed = now - currentSubRound->getStarting();
 		const std::string nowStr = core::formatClockNoSecond(now);
@@ -516,10 +525,10 @@ void DisplayView::renderRoundRunning() const {
 	ImGui::SetCursorPosY(nextPos);
 	if (ImGui::BeginChild("SubRoundInfo", {leftPanelWidth, 0}, ImGuiChildFlags_None)) {
 		const auto currentWidth = ImGui::GetContentRegionAvail().x;
-		const auto truncate_price = gui_settings.getValue("truncate_price", false);
-		const auto truncate_price_lines = gui_settings.getValue("truncate_price_lines", 3);
-		const auto value_scale = gui_settings.getValue("value_scale", 3.0f) * 0.8f;
-		auto price_scale = gui_settings.getValue("prices_scale", 2.5f) * 0.8f;
+		const auto truncate_price = gui_settings.truncatePrice;
+		const auto truncate_price_lines = gui_settings.truncatePriceLines;
+		const auto value_scale = gui_settings.valueScale * 0.8f;
+		auto price_scale = gui_settings.pricesScale * 0.8f;
 		const std::string priceText = std::format("{:.2f} €", currentSubRound->getValue());
 		const auto valueSize =
 				std::max(ImGui::CalcTextSize(priceText.c_str()).x, ImGui::CalcTextSize("Valeur").x) * value_scale;
@@ -625,8 +634,7 @@ void DisplayView::renderEventPause() {
 	} else {
 		ImGui::SetCursorPosY(ImGui::GetCursorPosY() + ImGui::GetContentRegionAvail().y * 0.4f);
 		const ImVec2 msgSize = ImGui::CalcTextSize("Une buvette est à votre disposition");
-		const auto gui_settings = core::getSettings()->extract("gui");
-		auto scale = gui_settings.getValue("title_scale", 4.0f);
+		auto scale = core::getGuiSettings().titleScale;
 		if (scale <= 0.0f) {
 			scale = 1.0f;
 		}
@@ -656,15 +664,15 @@ void DisplayView::applyCommonStyle() const {
 		return;
 	}
 	auto& style = ImGui::GetStyle();
-	const auto gui_settings = core::getSettings()->extract("gui");
-	const auto back = gui_settings.getValue("background_color", utils::imVec4ToVec4(style.Colors[ImGuiCol_WindowBg]));
+	const auto& gui_settings = core::getGuiSettings();
+	const auto back = gui_settings.backgroundColor.value_or(utils::imVec4ToVec4(style.Colors[ImGuiCol_WindowBg]));
 	style.Colors[ImGuiCol_WindowBg] = utils::vec4ToImVec4(back);
 	style.Colors[ImGuiCol_DockingEmptyBg] = utils::vec4ToImVec4(back);
 	style.Colors[ImGuiCol_FrameBg] = utils::vec4ToImVec4(back);
 	style.Colors[ImGuiCol_ChildBg] = utils::vec4ToImVec4(back);
 	style.Colors[ImGuiCol_PopupBg] = utils::vec4ToImVec4(back);
 	style.Colors[ImGuiCol_Text] =
-			utils::vec4ToImVec4(gui_settings.getValue("text_color", utils::imVec4ToVec4(style.Colors[ImGuiCol_Text])));
+			utils::vec4ToImVec4(gui_settings.textColor.value_or(utils::imVec4ToVec4(style.Colors[ImGuiCol_Text])));
 }
 
 }// namespace evl::gui_imgui::views
@@ -152,9 +152,8 @@ void MainView::renderDrawnNumbersTab() const {
 
 	const auto currentRound = m_currentEvent.getCurrentGameRound();
 	auto& rng = Application::get().getRng();
-	// Get all drawn numbers for current round
-	const auto drawnNumbers = currentRound->getAllDraws();
-	const std::unordered_set drawnSet(drawnNumbers.begin(), drawnNumbers.end());
+	// Drawn numbers of the current round
+	const auto& drawLog = currentRound->getDrawLog();
 
 	// Calculate button size to fit 10 per row
 	const ImVec2 availWidth = ImGui::GetContentRegionAvail();
@@ -165,7 +164,7 @@ void MainView::renderDrawnNumbersTab() const {
 	for (uint8_t row = 0; row < 9; ++row) {
 		for (uint8_t col = 0; col < 10; ++col) {
 			const uint8_t number = row * 10 + col + 1;
-			const bool isDrawn = drawnSet.contains(number);
+			const bool isDrawn = drawLog.isDrawn(number);
 
 			// Push style for drawn numbers
 			if (isDrawn) {
@@ -190,7 +189,7 @@ void MainView::renderDrawnNumbersTab() const {
 
 			// Handle click only if not already drawn
 			if (clicked && !isDrawn) {
-				currentRound->addPickedNumber(number);
+				Application::get().getJournal().draw(number);
 				rng.addPick(number);
 			}
 
@@ -210,7 +209,7 @@ void MainView::renderRightPanel() const {
 	if (m_currentEvent.getStatus() == core::Event::Status::GameRunning) {
 		if (const auto currentRound = m_currentEvent.getCurrentGameRound();
 			currentRound->getStatus() == core::GameRound::Status::Running) {
-			const auto drawnNumbers = currentRound->getAllDraws();
+			const auto drawnNumbers = currentRound->getDrawLog().draws();
 			const size_t drawnCount = drawnNumbers.size();
 			if (drawnCount >= 1) {
 				prevDrawnNumber = drawnNumbers[drawnCount - 1];
@@ -236,6 +235,11 @@ void MainView::renderRightPanel() const {
 			ImGui::Text("Numéro tiré");
 			ImGui::Separator();
 			const std::string numberText = (prevDrawnNumber != -1) ? std::format("{}", prevDrawnNumber) : "--";
+			if (!m_currentEvent.getPendingWinners().empty())
+				ImGui::Text("Cartons gagnants: %s", m_currentEvent.getPendingWinnersStr().c_str());
+			else if (m_currentEvent.canDraw() && !m_currentEvent.getCards().empty() &&
+					 m_currentEvent.getCurrentCGameRound()->getType() == core::GameRound::Type::Inverse)
+				ImGui::Text("Cartons restants: %zu", m_currentEvent.getSurvivorCount());
 			utils::adaptTextToRegion(
 					numberText,
 					{.autoRegion = true, .vCenter = true, .hCenter = true, .drawText = true, .textAdapt = "00"});
@@ -282,10 +286,8 @@ void MainView::renderCommandsTab() const {
 	if (m_currentEvent.getStatus() == core::Event::Status::GameRunning) {
 		if (const auto currentRound = m_currentEvent.getCurrentGameRound();
 			currentRound->getStatus() == core::GameRound::Status::Running) {
-			const auto drawnNumbers = currentRound->getAllDraws();
-			if (const size_t drawnCount = drawnNumbers.size(); drawnCount >= 1) {
-				prevDrawnNumber = drawnNumbers[drawnCount - 1];
-			}
+			if (const auto& drawLog = currentRound->getDrawLog(); !drawLog.empty())
+				prevDrawnNumber = drawLog.last();
 		}
 	}
 	{
@@ -335,13 +337,18 @@ void MainView::renderCommandsTab() const {
 }
 
 void MainView::renderStatisticsTab() const {
-	const auto stats = m_currentEvent.getStats();
+	const auto& stats = m_currentEvent.getStats();
+	if (stats.getVersion() != m_statsVersion) {
+		m_statsVersion = stats.getVersion();
+		m_lessPickStr = stats.lessPickStr();
+		m_mostPickStr = stats.mostPickStr();
+	}
 	ImGui::Columns(2, "StatsColumns", true);
 
 	if (ImGui::BeginChild("LeftColomunStats")) {
 		// Less picked numbers
 		if (ImGui::CollapsingHeader("Numéros le moins sortis", ImGuiTreeNodeFlags_DefaultOpen)) {
-			ImGui::TextWrapped("%s", stats.lessPickStr().c_str());
+			ImGui::TextWrapped("%s", m_lessPickStr.c_str());
 			ImGui::Text("Nombre de sortie: %d", stats.lessPickNb);
 		}
 
@@ -365,7 +372,7 @@ void MainView::renderStatisticsTab() const {
 	if (ImGui::BeginChild("RightColomunStats")) {
 		// Most picked numbers
 		if (ImGui::CollapsingHeader("Numéros le plus sortis", ImGuiTreeNodeFlags_DefaultOpen)) {
-			ImGui::TextWrapped("%s", stats.mostPickStr().c_str());
+			ImGui::TextWrapped("%s", m_mostPickStr.c_str());
 			ImGui::Text("Nombre de sortie: %d", stats.mostPickNb);
 		}
 
@@ -395,6 +402,7 @@ void MainView::renderEventInfo() const {
 	std::string startTime = "--";
 	std::string endTime = "--";
 	std::string duration = "--:--:--";
+	std::string forecast = "--";
 	float progress = 0.0f;
 
 	if (m_currentEvent.getStatus() == core::Event::Status::GameRunning) {
@@ -407,6 +415,11 @@ void MainView::renderEventInfo() const {
 		const auto dur = end - start;
 		duration = core::formatDuration(dur);
 		progress = m_currentEvent.getProgression();
+		const auto remaining = m_currentEvent.getForecast().getRemaining();
+		forecast = std::format("{} (reste {})",
+							   core::formatClockNoSecond(core::clock::now() +
+														 std::chrono::duration_cast<core::clock::duration>(remaining)),
+							   core::formatDuration(remaining));
 	}
 
 	ImGui::Columns(2, "EventInfoColumns", true);
@@ -432,12 +445,17 @@ void MainView::renderEventInfo() const {
 
 	ImGui::Separator();
 
-	ImGui::Columns(2, "DurationColumns", false);
+	ImGui::Columns(3, "DurationColumns", false);
 
 	ImGui::Text("Durée:");
 	ImGui::SameLine();
 	ImGui::TextDisabled("%s", duration.c_str());
 
+	ImGui::NextColumn();
+	ImGui::Text("Fin prévue:");
+	ImGui::SameLine();
+	ImGui::TextDisabled("%s", forecast.c_str());
+
 	ImGui::NextColumn();
 	ImGui::Text("Progression:");
 	ImGui::SameLine();
@@ -11,6 +11,8 @@
 #include "core/Event.h"
 #include "core/maths/vectors.h"
 
+#include <limits>
+
 namespace evl::gui_imgui::views {
 
 /**
@@ -65,6 +67,11 @@ private:
 	int m_selectedScreen = 0;
 	float m_logScale = 0.7f;
 	size_t m_lineInLog = 0;
+
+	// statistics strings, rebuilt only when the statistics version changes
+	mutable uint64_t m_statsVersion = std::numeric_limits<uint64_t>::max();
+	mutable std::string m_lessPickStr;
+	mutable std::string m_mostPickStr;
 };
 
 }// namespace evl::gui_imgui::views
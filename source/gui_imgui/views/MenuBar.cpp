@@ -53,12 +53,20 @@ void MenuBar::onUpdate() {
 			defineMenuItem("Sauver", "save_file");
 			defineMenuItem("Sauver sous...", "save_file_as");
 			ImGui::Separator();
+			defineMenuItem("Ouvrir une archive...", "open_archive");
+			defineMenuItem("Archiver l'événement...", "archive_event");
+			ImGui::Separator();
 			defineMenuItem("Commencer", "start_game");
 			defineMenuItem("Arrêter", "stop_game");
 			ImGui::Separator();
 			defineMenuItem("Quitter", "quit_application");
 			ImGui::EndMenu();
 		}
+		if (ImGui::BeginMenu("Édition")) {
+			defineMenuItem("Annuler", "undo");
+			defineMenuItem("Rétablir", "redo");
+			ImGui::EndMenu();
+		}
 		if (ImGui::BeginMenu("Paramètres")) {
 			defineMenuItem("General", "preferences");
 			defineMenuItem("Événement", "event_settings");
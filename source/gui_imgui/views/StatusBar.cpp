@@ -38,7 +38,20 @@ void StatusBar::onUpdate() {
 									   ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoScrollbar |
 									   ImGuiWindowFlags_NoSavedSettings;
 
-	const std::string leftText = std::format("App : {}", magic_enum::enum_name(app.getState()));
+	std::string leftText = std::format("App : {}", magic_enum::enum_name(app.getState()));
+	switch (app.getSaver().getStatus()) {
+		case core::EventSaver::Status::Idle:
+			break;
+		case core::EventSaver::Status::Running:
+			leftText += " - Sauvegarde en cours...";
+			break;
+		case core::EventSaver::Status::Succeeded:
+			leftText += std::format(" - Sauvegardé: {}", app.getSaver().getFile().filename().string());
+			break;
+		case core::EventSaver::Status::Failed:
+			leftText += std::format(" - Échec de la sauvegarde: {}", app.getSaver().getFile().filename().string());
+			break;
+	}
 	const std::string centerText = std::format("Event: {}", app.getCurrentEvent().getStateString());
 	const std::string rightText = std::format("Status: {}", magic_enum::enum_name(app.getCurrentEvent().getStatus()));
 	const auto leftSize = ImGui::CalcTextSize(leftText.c_str());
@@ -54,6 +54,10 @@ void ToolBar::onUpdate() {
 	utils::defineActionButtonItem(utils::getNextStepStr(Application::get().getCurrentEvent()), "game_next_step");
 	utils::defineActionButtonItem("Tirage Aléatoire", "random_pick");
 	utils::defineActionButtonItem("Annuler dernier tirage", "cancel_pick");
+	ImGui::SameLine();
+	ImGui::SeparatorEx(ImGuiSeparatorFlags_Vertical);
+	utils::defineActionButtonItem("Annuler", "undo");
+	utils::defineActionButtonItem("Rétablir", "redo");
 	ImGui::End();
 }
 
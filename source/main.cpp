@@ -10,8 +10,12 @@
 #include <QApplication>
 #include <QCommandLineParser>
 #endif
+#include <core/Event.h>
+#include <core/EventFile.h>
 #include <core/Log.h>
+#include <core/Migration.h>
 #include <core/Settings.h>
+#include <core/Simulator.h>
 #include <core/utilities.h>
 #include <gui_imgui/Application.h>
 #ifdef USE_QT
@@ -19,6 +23,8 @@
 #include <gui_qt/baseDefinitions.h>
 #endif
 
+#include <fstream>
+#include <iostream>
 #include <magic_enum/magic_enum.hpp>
 
 #ifdef USE_QT
@@ -26,6 +32,115 @@ using namespace evl::gui;
 #endif
 using namespace std::filesystem;
 
+namespace {
+/**
+ * @brief Upgrade or check the event files of a directory without interface, if asked on the command line.
+ *
+ * Usage: --migrate <dossier> or --check <dossier>, with --no-backup and --threads <n>.
+ * @param iArgc Number of arguments.
+ * @param iArgv The arguments.
+ * @return The exit code, nothing if no migration is asked.
+ */
+auto runMigration(const int iArgc, char* iArgv[]) -> std::optional<int> {
+	evl::core::Migrator::Options options;
+	path directory;
+	bool asked = false;
+	for (int i = 1; i < iArgc; ++i) {
+		const std::string_view arg = iArgv[i];
+		if ((arg == "--migrate" || arg == "--check") && i + 1 < iArgc) {
+			asked = true;
+			options.checkOnly = arg == "--check";
+			directory = iArgv[++i];
+		} else if (arg == "--no-backup") {
+			options.backup = false;
+		} else if (arg == "--threads" && i + 1 < iArgc) {
+			options.threads = std::strtoul(iArgv[++i], nullptr, 10);
+		}
+	}
+	if (!asked)
+		return std::nullopt;
+	if (!is_directory(directory)) {
+		log_error("'{}' n'est pas un dossier", directory.string());
+		return EXIT_FAILURE;
+	}
+	const auto report = evl::core::Migrator(options).migrate(directory);
+	for (const auto& result: report.files) {
+		if (result.outcome == evl::core::MigrationResult::Outcome::Current)
+			continue;
+		std::cout << std::format("{:<12} v{} {}{}\n", magic_enum::enum_name(result.outcome), result.version,
+								 result.file.string(), result.lossy ? " (avec pertes)" : "");
+	}
+	std::cout << std::format("{} fichiers, {} à jour, {} migrés, {} à migrer, {} en échec\n", report.files.size(),
+							 report.count(evl::core::MigrationResult::Outcome::Current),
+							 report.count(evl::core::MigrationResult::Outcome::Upgraded),
+							 report.count(evl::core::MigrationResult::Outcome::Outdated), report.failed());
+	return report.failed() == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+/**
+ * @brief Simulate the rounds of an event without interface, if asked on the command line.
+ *
+ * Usage: --simulate <fichier.lev>, with --cards <n>, --runs <n>, --seed <n> and --threads <n>.
+ * @param iArgc Number of arguments.
+ * @param iArgv The arguments.
+ * @return The exit code, nothing if no simulation is asked.
+ */
+auto runSimulation(const int iArgc, char* iArgv[]) -> std::optional<int> {
+	evl::core::Simulator::Options options;
+	path file;
+	bool asked = false;
+	for (int i = 1; i < iArgc; ++i) {
+		const std::string_view arg = iArgv[i];
+		if (arg == "--simulate" && i + 1 < iArgc) {
+			asked = true;
+			file = iArgv[++i];
+		} else if (arg == "--cards" && i + 1 < iArgc) {
+			options.cards = std::strtoul(iArgv[++i], nullptr, 10);
+		} else if (arg == "--runs" && i + 1 < iArgc) {
+			options.runs = std::strtoul(iArgv[++i], nullptr, 10);
+		} else if (arg == "--seed" && i + 1 < iArgc) {
+			options.seed = std::strtoull(iArgv[++i], nullptr, 10);
+		} else if (arg == "--threads" && i + 1 < iArgc) {
+			options.threads = std::strtoul(iArgv[++i], nullptr, 10);
+		}
+	}
+	if (!asked)
+		return std::nullopt;
+	if (!is_regular_file(file)) {
+		log_error("'{}' n'est pas un fichier", file.string());
+		return EXIT_FAILURE;
+	}
+	// only the rounds are simulated, with generated cards: the card pack of the event is not needed
+	evl::core::Event event;
+	event.setBasePath(file);
+	if (evl::core::EventFileView view; view.open(file)) {
+		event.readChunks(view, evl::core::Event::CardLoading::Skip);
+	} else {
+		std::ifstream stream(file, std::ios::in | std::ios::binary);
+		event.read(stream, 0, evl::core::Event::CardLoading::Skip);
+		if (stream.fail()) {
+			log_error("Impossible de lire le fichier '{}'", file.string());
+			return EXIT_FAILURE;
+		}
+	}
+	const auto result = evl::core::Simulator(event, options).run();
+	if (result.runs == 0)
+		return EXIT_FAILURE;
+	const auto minutes = [](const std::chrono::duration<double> iDuration) { return iDuration.count() / 60.0; };
+	for (const auto& [type, stats]: result.types) {
+		std::cout << std::format("{:<16} {:>8} parties, tirages {:>5.1f} (min {}, max {}), durée {:>5.1f} min "
+								 "(90% < {:.1f} min)\n",
+								 magic_enum::enum_name(type), stats.samples, stats.meanDraws, stats.minDraws,
+								 stats.maxDraws, minutes(stats.meanDuration), minutes(stats.p90Duration));
+	}
+	std::cout << std::format("Événement : durée moyenne {:.1f} min, médiane {:.1f} min, 90% < {:.1f} min\n",
+							 minutes(result.meanDuration), minutes(result.medianDuration), minutes(result.p90Duration));
+	std::cout << std::format("{} simulations, {} tirages en {:.2f} s\n", result.runs, result.totalDraws,
+							 result.elapsed.count());
+	return EXIT_SUCCESS;
+}
+}// namespace
+
 auto main(int iArgc, char* iArgv[]) -> int {
 #ifdef EVL_DEBUG
 	evl::Log::init(evl::Log::Level::Trace);
@@ -33,6 +148,14 @@ auto main(int iArgc, char* iArgv[]) -> int {
 	evl::Log::init(evl::Log::Level::Info);
 #endif
 	evl::core::initializeUtilities(iArgc, iArgv);
+	if (const auto migration = runMigration(iArgc, iArgv); migration.has_value()) {
+		evl::Log::invalidate();
+		return migration.value();
+	}
+	if (const auto simulation = runSimulation(iArgc, iArgv); simulation.has_value()) {
+		evl::Log::invalidate();
+		return simulation.value();
+	}
 	evl::core::loadSettings();
 	evl::core::mergeDefaultSettings();
 	const auto settings = evl::core::getSettings();
@@ -0,0 +1,97 @@
+/**
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "../TestMainHelper.h"
+
+#include "core/Autosave.h"
+
+using namespace evl::core;
+
+namespace {
+void play(Journal& ioJournal) {
+	ioJournal.nextState();
+	ioJournal.nextState();
+	for (uint8_t draw = 1; draw <= 40; ++draw) ioJournal.draw(draw);
+	ioJournal.cancelPick();
+	// an undone winner must not come back after the next operation
+	ioJournal.addWinner("999");
+	ioJournal.undo();
+	ioJournal.addWinner("153");
+	ioJournal.undo();
+	ioJournal.redo();
+	ioJournal.draw(77);
+	ioJournal.seek(10);
+	ioJournal.seek(44);
+}
+
+auto makeGame() -> Event {
+	Event evt;
+	evt.setName("toto");
+	evt.setOrganizerName("toto tata");
+	for (int i = 0; i < 3; ++i) evt.pushGameRound(GameRound(GameRound::Type::OneQuineFullCard));
+	return evt;
+}
+
+/// Full serialized state of an event, clock values included.
+auto savedState(const Event& iEvent) -> std::string {
+	std::ostringstream stream(std::ios::out | std::ios::binary);
+	iEvent.write(stream);
+	return stream.str();
+}
+}// namespace
+
+TEST(Autosave, Paths) {
+	EXPECT_EQ(Autosave::logPath("soiree.lev").filename(), "soiree.lev.wal");
+	EXPECT_EQ(Autosave::eventPath(Autosave::logPath("soiree.lev")), "soiree.lev");
+	EXPECT_TRUE(Autosave::eventPath(Autosave::logPath({})).empty());
+}
+
+TEST(Autosave, Recover) {
+	const fs::path log = fs::temp_directory_path() / "test_autosave.lev.wal";
+	Event evt = makeGame();
+	Journal journal(evt);
+	{
+		Autosave autosave;
+		ASSERT_TRUE(autosave.start(log));
+		EXPECT_EQ(Autosave::pendingLog(), "");// only the header
+		journal.setListener([&](const Journal& iJournal, const Journal::Change iChange) {
+			autosave.record(iJournal, iChange);
+		});
+		journal.reset();
+		play(journal);
+		autosave.flush();
+		// the changes share a few fsync
+		EXPECT_LT(autosave.getCommitCount(), 10);
+		EXPECT_EQ(Autosave::pendingLog(), log);
+		// crash: the destructor writes the pending changes but keeps the log
+		journal.setListener({});
+	}
+	ASSERT_EQ(Autosave::pendingLog(), log);
+	Event recovered;
+	ASSERT_TRUE(Autosave::recover(log, recovered));
+	EXPECT_EQ(recovered.getName(), "toto");
+	EXPECT_EQ(recovered.getStatus(), evt.getStatus());
+	EXPECT_EQ(recovered.getCurrentCGameRound()->getAllDraws(), evt.getCurrentCGameRound()->getAllDraws());
+	EXPECT_EQ(recovered.getCurrentCGameRound()->beginSubRound()->getWinner(), "153");
+	EXPECT_EQ(recovered.getCurrentCGameRound()->beginSubRound()->getWinner(),
+			  evt.getCurrentCGameRound()->beginSubRound()->getWinner());
+	// the operations are replayed at their original time
+	EXPECT_EQ(savedState(recovered), savedState(evt));
+
+	// a change torn by the crash is ignored: the last seek is lost
+	const auto size = fs::file_size(log);
+	fs::resize_file(log, size - 2);
+	Event torn;
+	ASSERT_TRUE(Autosave::recover(log, torn));
+	EXPECT_EQ(torn.getCurrentCGameRound()->drawsCount(), 8);
+
+	// clean shutdown: nothing to recover
+	Autosave autosave;
+	autosave.start(log);
+	autosave.stop();
+	EXPECT_FALSE(fs::exists(log));
+	EXPECT_EQ(Autosave::pendingLog(), "");
+}
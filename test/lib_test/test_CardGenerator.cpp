@@ -0,0 +1,113 @@
+/**
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "../TestMainHelper.h"
+
+#include "core/CardGenerator.h"
+#include "core/CardPack.h"
+#include "core/Event.h"
+#include "core/utilities.h"
+
+#include <fstream>
+
+using namespace evl::core;
+namespace fs = std::filesystem;
+
+TEST(CardGenerator, ValidCards) {
+	const CardGenerator generator(42);
+	EXPECT_EQ(generator.getSeed(), 42);
+	for (uint64_t index = 0; index < 2000; ++index) {
+		const auto card = generator.generateCard(index);
+		EXPECT_TRUE(CardGenerator::isValid(card));
+	}
+	CardRegistry::numbers_type card = generator.generateCard(0);
+	std::swap(card[0], card[1]);
+	EXPECT_FALSE(CardGenerator::isValid(card));
+	card = {1, 5, 23, 45, 67, 12, 28, 34, 56, 81, 9, 37, 49, 72, 90};
+	EXPECT_FALSE(CardGenerator::isValid(card));// two numbers of the column 1-9 in a row
+	card = {1, 12, 23, 45, 67, 11, 28, 34, 56, 81, 9, 37, 49, 72, 90};
+	EXPECT_FALSE(CardGenerator::isValid(card));// column 10-19 not sorted top to bottom
+	card = {1, 12, 23, 45, 67, 15, 28, 34, 56, 81, 9, 37, 49, 72, 90};
+	EXPECT_TRUE(CardGenerator::isValid(card));
+}
+
+TEST(CardGenerator, Deterministic) {
+	const auto cards = CardGenerator(1234).generate(20000);
+	ASSERT_EQ(cards.size(), 20000);
+	EXPECT_EQ(cards, CardGenerator(1234).generate(20000));
+	EXPECT_NE(cards, CardGenerator(1235).generate(20000));
+	// independent of the number of cards asked
+	const auto first = CardGenerator(1234).generate(100);
+	EXPECT_TRUE(std::equal(first.begin(), first.end(), cards.begin()));
+	std::set<CardRegistry::numbers_type> unique(cards.begin(), cards.end());
+	EXPECT_EQ(unique.size(), cards.size());
+	EXPECT_TRUE(std::ranges::all_of(cards, &CardGenerator::isValid));
+}
+
+TEST(CardPack, WriteRead) {
+	const fs::path tmp = fs::temp_directory_path() / "test_cards";
+	create_directories(tmp);
+	const fs::path file = tmp / "cards.evc";
+	const auto cards = CardGenerator(7).generate(500);
+	ASSERT_TRUE(CardPack::write(file, cards, 7));
+	EXPECT_EQ(fs::file_size(file), CardPack::g_headerSize + 500 * CardPack::g_stride);
+	EXPECT_FALSE(fs::exists(tmp / "cards.evc.tmp"));
+
+	CardPack pack;
+	EXPECT_FALSE(pack.isOpen());
+	ASSERT_TRUE(pack.open(file));
+	EXPECT_EQ(pack.size(), 500);
+	EXPECT_EQ(pack.getSeed(), 7);
+	EXPECT_EQ(pack.getCard(123), cards[123]);
+	EXPECT_EQ(pack.getCard(500), CardRegistry::numbers_type{});
+
+	CardRegistry registry;
+	EXPECT_EQ(pack.loadInto(registry), 500);
+	EXPECT_EQ(registry.getSerial(9), 10);
+	pack.close();
+	EXPECT_FALSE(pack.isOpen());
+
+	// bad files
+	const fs::path bad = tmp / "bad.evc";
+	std::ofstream(bad, std::ios::binary) << "NOTCARDS and some more bytes to reach the header size";
+	EXPECT_FALSE(pack.open(bad));
+	EXPECT_FALSE(pack.open(tmp / "missing.evc"));
+	fs::resize_file(file, CardPack::g_headerSize + 10 * CardPack::g_stride);
+	EXPECT_FALSE(pack.open(file));
+	remove_all(tmp);
+}
+
+TEST(CardPack, Event) {
+	const fs::path tmp = fs::temp_directory_path() / "test_cards_event";
+	create_directories(tmp);
+	ASSERT_TRUE(CardPack::write(tmp / "cards.evc", CardGenerator(3).generate(50), 3));
+
+	Event evt;
+	evt.setName("toto");
+	evt.setOrganizerName("toto tata");
+	evt.pushGameRound(GameRound(GameRound::Type::OneQuine));
+	evt.setBasePath(tmp / "event.lev");
+	evt.setCardPack(tmp / "cards.evc");
+	EXPECT_EQ(evt.getCardPack(), fs::path("cards.evc"));
+	EXPECT_EQ(evt.getCardPackFull(), tmp / "cards.evc");
+	EXPECT_EQ(evt.getCards().size(), 50);
+
+	std::ofstream fileSave(tmp / "event.lev", std::ios::out | std::ios::binary);
+	evt.write(fileSave);
+	fileSave.close();
+
+	Event evt2;
+	evt2.setBasePath(tmp / "event.lev");
+	std::ifstream fileRead(tmp / "event.lev", std::ios::in | std::ios::binary);
+	evt2.read(fileRead, getSaveVersion());
+	fileRead.close();
+	EXPECT_EQ(evt2.getCardPack(), fs::path("cards.evc"));
+	EXPECT_EQ(evt2.getCards().size(), 50);
+
+	evt2.setCardPack({});
+	EXPECT_TRUE(evt2.getCards().empty());
+	remove_all(tmp);
+}
@@ -0,0 +1,244 @@
+/**
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "../TestMainHelper.h"
+
+#include "core/CardRegistry.h"
+#include "core/Event.h"
+
+#include <numeric>
+#include <random>
+
+using namespace evl::core;
+
+namespace {
+const CardRegistry::numbers_type g_card1 = {1, 12, 23, 45, 67, 5, 18, 34, 56, 81, 9, 27, 39, 72, 90};
+const CardRegistry::numbers_type g_card2 = {2, 13, 24, 46, 68, 6, 19, 35, 57, 82, 8, 28, 38, 73, 89};
+
+auto maskOf(const std::vector<uint8_t>& iNumbers) -> NumberMask {
+	NumberMask mask;
+	for (const auto number: iNumbers) mask.set(number);
+	return mask;
+}
+}// namespace
+
+TEST(NumberMask, Basics) {
+	NumberMask mask;
+	EXPECT_TRUE(mask.empty());
+	mask.set(1);
+	mask.set(64);
+	mask.set(65);
+	mask.set(90);
+	mask.set(0);
+	mask.set(91);
+	EXPECT_EQ(mask.count(), 4);
+	EXPECT_TRUE(mask.test(64));
+	EXPECT_TRUE(mask.test(65));
+	EXPECT_FALSE(mask.test(91));
+	mask.reset(64);
+	EXPECT_FALSE(mask.test(64));
+	EXPECT_TRUE(maskOf({1, 90}).isSubsetOf(mask));
+	EXPECT_FALSE(maskOf({1, 2}).isSubsetOf(mask));
+	mask.clear();
+	EXPECT_TRUE(mask.empty());
+}
+
+TEST(CardRegistry, AddCard) {
+	CardRegistry cards;
+	EXPECT_TRUE(cards.empty());
+	EXPECT_TRUE(cards.addCard(g_card1));
+	EXPECT_TRUE(cards.addCard(g_card2, 1234));
+	CardRegistry::numbers_type bad = g_card1;
+	bad[3] = 1;
+	EXPECT_FALSE(cards.addCard(bad));
+	bad[3] = 91;
+	EXPECT_FALSE(cards.addCard(bad));
+	EXPECT_EQ(cards.size(), 2);
+	EXPECT_EQ(cards.getSerial(0), 1);
+	EXPECT_EQ(cards.getSerial(1), 1234);
+	EXPECT_EQ(cards.getCardMask(0).count(), 15);
+	EXPECT_EQ(cards.getRowMask(0, 2), maskOf({9, 27, 39, 72, 90}));
+	EXPECT_EQ(cards.getSerialsStr({0, 1}), "1, 1234");
+	cards.clear();
+	EXPECT_TRUE(cards.empty());
+}
+
+TEST(CardRegistry, Lines) {
+	CardRegistry cards;
+	cards.addCard(g_card1);
+	const auto draws = maskOf({1, 12, 23, 45, 67, 5, 18, 34, 56});
+	EXPECT_EQ(cards.countLines(0, draws), 1);
+	EXPECT_EQ(cards.countMissing(0, draws), 6);
+	EXPECT_EQ(CardRegistry::requiredLines(SubGameRound::Type::OneQuine), 1);
+	EXPECT_EQ(CardRegistry::requiredLines(SubGameRound::Type::TwoQuines), 2);
+	EXPECT_EQ(CardRegistry::requiredLines(SubGameRound::Type::FullCard), 3);
+	EXPECT_EQ(CardRegistry::requiredLines(SubGameRound::Type::Inverse), 0);
+	EXPECT_TRUE(cards.findWinners(SubGameRound::Type::Inverse, draws).empty());
+}
+
+TEST(CardRegistry, Winners) {
+	CardRegistry cards;
+	// Enough cards to use several kernel blocks.
+	for (uint32_t i = 0; i < 1500; ++i) cards.addCard(i % 2 == 0 ? g_card1 : g_card2);
+	auto draws = maskOf({1, 12, 23, 45});
+	EXPECT_TRUE(cards.findNewWinners(SubGameRound::Type::OneQuine, draws, 45).empty());
+	draws.set(67);
+	const auto winners = cards.findNewWinners(SubGameRound::Type::OneQuine, draws, 67);
+	EXPECT_EQ(winners.size(), 750);
+	EXPECT_EQ(winners.back(), 1498);
+	EXPECT_EQ(cards.findWinners(SubGameRound::Type::OneQuine, draws).size(), 750);
+	// Already completed: no new winner with another number.
+	draws.set(2);
+	EXPECT_TRUE(cards.findNewWinners(SubGameRound::Type::OneQuine, draws, 2).empty());
+	EXPECT_TRUE(cards.findNewWinners(SubGameRound::Type::TwoQuines, draws, 2).empty());
+	// Last draw not in the draws.
+	EXPECT_TRUE(cards.findNewWinners(SubGameRound::Type::OneQuine, draws, 3).empty());
+}
+
+TEST(CardRegistry, EventDetection) {
+	Event evt;
+	evt.setName("toto");
+	evt.setOrganizerName("toto tata");
+	evt.pushGameRound(GameRound(GameRound::Type::OneQuineFullCard));
+	evt.getCards().addCard(g_card1, 42);
+	evt.getCards().addCard(g_card2, 43);
+	evt.addPickedNumber(1);
+	EXPECT_TRUE(evt.getCurrentCGameRound()->emptyDraws());
+	evt.nextState();
+	evt.nextState();
+	evt.nextState();
+	ASSERT_TRUE(evt.canDraw());
+	for (const uint8_t number: std::vector<uint8_t>{1, 12, 23, 45}) evt.addPickedNumber(number);
+	EXPECT_TRUE(evt.getPendingWinners().empty());
+	evt.addPickedNumber(67);
+	ASSERT_EQ(evt.getPendingWinners().size(), 1);
+	EXPECT_EQ(evt.getPendingWinnersStr(), "42");
+	evt.removeLastPick();
+	EXPECT_TRUE(evt.getPendingWinners().empty());
+	EXPECT_EQ(evt.getCards().getTrackedDraws().count(), 4);
+	// Cards registered during the game: tracking is resynchronized on the next draw.
+	evt.getCards().addCard(g_card1, 44);
+	evt.addPickedNumber(67);
+	EXPECT_EQ(evt.getPendingWinnersStr(), "42, 44");
+	evt.removeLastPick();
+	evt.addPickedNumber(67);
+	evt.addWinnerToCurrentRound(evt.getPendingWinnersStr());
+	EXPECT_TRUE(evt.getPendingWinners().empty());
+	EXPECT_STREQ(evt.getCurrentCGameRound()->beginSubRound()->getWinner().c_str(), "42, 44");
+}
+
+TEST(CardRegistry, IncrementalTracking) {
+	CardRegistry cards;
+	std::mt19937 gen(42);
+	std::array<uint8_t, 90> numbers{};
+	std::iota(numbers.begin(), numbers.end(), uint8_t{1});
+	// Enough cards to build the index with several threads.
+	for (uint32_t i = 0; i < 140000; ++i) {
+		std::ranges::shuffle(numbers, gen);
+		CardRegistry::numbers_type card{};
+		std::copy_n(numbers.begin(), card.size(), card.begin());
+		cards.addCard(card);
+	}
+	EXPECT_TRUE(cards.isIndexDirty());
+	cards.buildIndex();
+	EXPECT_FALSE(cards.isIndexDirty());
+	size_t entries = 0;
+	for (uint8_t number = 1; number <= 90; ++number) entries += cards.getPostingSize(number);
+	EXPECT_EQ(entries, cards.size() * 15);
+	EXPECT_EQ(cards.getPostingSize(0), 0);
+
+	std::ranges::shuffle(numbers, gen);
+	NumberMask draws;
+	for (uint8_t i = 0; i < 30; ++i) {
+		const uint8_t number = numbers[i];
+		draws.set(number);
+		const auto winners = cards.applyDraw(number, SubGameRound::Type::OneQuine);
+		EXPECT_EQ(winners, cards.findNewWinners(SubGameRound::Type::OneQuine, draws, number));
+		EXPECT_EQ(winners, cards.getWinnersByDraw(number, SubGameRound::Type::OneQuine));
+	}
+	EXPECT_EQ(cards.getTrackedDraws(), draws);
+	// Undo the last draws and check the counters are restored.
+	for (uint8_t i = 29; i >= 20; --i) {
+		cards.undoDraw(numbers[i]);
+		draws.reset(numbers[i]);
+	}
+	for (CardRegistry::card_id card = 0; card < 1000; ++card)
+		EXPECT_EQ(cards.getTrackedLines(card), cards.countLines(card, draws));
+	cards.syncTracking(std::span{numbers}.first(20));
+	for (CardRegistry::card_id card = 0; card < 1000; ++card)
+		EXPECT_EQ(cards.getTrackedLines(card), cards.countLines(card, draws));
+}
+
+TEST(CardRegistry, Elimination) {
+	CardRegistry cards;
+	cards.addCard(g_card1, 10);
+	cards.addCard(g_card2, 20);
+	cards.syncElimination({});
+	EXPECT_EQ(cards.getSurvivorCount(), 2);
+	EXPECT_EQ(cards.eliminate(3), 0);
+	EXPECT_EQ(cards.eliminate(1), 1);
+	EXPECT_EQ(cards.getSurvivors(10), CardRegistry::winners_type{1});
+	EXPECT_EQ(cards.getEliminationDepth(), 2);
+	cards.undoElimination();
+	EXPECT_EQ(cards.getSurvivorCount(), 2);
+	EXPECT_EQ(cards.getEliminationDepth(), 1);
+
+	Event evt;
+	evt.setName("toto");
+	evt.setOrganizerName("toto tata");
+	evt.pushGameRound(GameRound(GameRound::Type::Inverse));
+	evt.getCards().addCard(g_card1, 10);
+	evt.getCards().addCard(g_card2, 20);
+	evt.getCards().addCard(g_card2, 30);
+	evt.nextState();
+	evt.nextState();
+	evt.nextState();
+	ASSERT_TRUE(evt.canDraw());
+	EXPECT_EQ(evt.getSurvivorCount(), 3);
+	evt.addPickedNumber(2);
+	EXPECT_EQ(evt.getSurvivorCount(), 1);
+	EXPECT_EQ(evt.getPendingWinnersStr(), "10");
+	evt.removeLastPick();
+	EXPECT_EQ(evt.getSurvivorCount(), 3);
+	EXPECT_EQ(evt.getSurvivorsStr(2), "10, 20");
+	evt.addPickedNumber(3);
+	evt.addPickedNumber(2);
+	evt.addPickedNumber(1);
+	EXPECT_EQ(evt.getSurvivorCount(), 0);
+	EXPECT_EQ(evt.getPendingWinnersStr(), "10");
+}
+
+TEST(CardRegistry, SubRoundOpening) {
+	CardRegistry cards;
+	cards.addCard(g_card1, 10);
+	cards.addCard(g_card2, 20);
+	cards.syncTracking({});
+	for (const uint8_t number: {5, 18, 34, 56, 81, 1, 12, 23, 45})
+		(void)cards.applyDraw(number, SubGameRound::Type::OneQuine);
+	// the second row completed during the one quine is not a new winner of the draw
+	EXPECT_TRUE(cards.applyDraw(67, SubGameRound::Type::OneQuine).empty());
+	EXPECT_EQ(cards.getTrackedWinners(SubGameRound::Type::OneQuine), CardRegistry::winners_type{0});
+	EXPECT_EQ(cards.getTrackedWinners(SubGameRound::Type::TwoQuines), CardRegistry::winners_type{0});
+	EXPECT_TRUE(cards.getTrackedWinners(SubGameRound::Type::FullCard).empty());
+
+	// the card already holding two quines wins as soon as the sub-round opens
+	Event evt;
+	evt.setName("toto");
+	evt.setOrganizerName("toto tata");
+	evt.pushGameRound(GameRound(GameRound::Type::OneTwoQuineFullCard));
+	evt.getCards().addCard(g_card1, 10);
+	evt.getCards().addCard(g_card2, 20);
+	evt.nextState();
+	evt.nextState();
+	evt.nextState();
+	ASSERT_TRUE(evt.canDraw());
+	for (const uint8_t number: {5, 18, 34, 56, 81}) evt.addPickedNumber(number);
+	EXPECT_EQ(evt.getPendingWinnersStr(), "10");
+	for (const uint8_t number: {1, 12, 23, 45, 67}) evt.addPickedNumber(number);
+	EXPECT_TRUE(evt.getPendingWinners().empty());
+	evt.addWinnerToCurrentRound("10");
+	EXPECT_EQ(evt.getPendingWinnersStr(), "10");
+}
@@ -0,0 +1,72 @@
+/**
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "../TestMainHelper.h"
+
+#include "core/GameRound.h"
+
+using namespace evl::core;
+
+TEST(DrawLog, Lookups) {
+	DrawLog log;
+	EXPECT_TRUE(log.empty());
+	EXPECT_EQ(log.last(), 0);
+	EXPECT_EQ(log.recency(12), DrawLog::g_notDrawn);
+	EXPECT_FALSE(log.push(0, 0));
+	EXPECT_FALSE(log.push(91, 0));
+	EXPECT_TRUE(log.push(12, 0));
+	EXPECT_TRUE(log.push(90, 0));
+	EXPECT_TRUE(log.push(45, 1));
+	EXPECT_EQ(log.size(), 3);
+	EXPECT_EQ(log.last(), 45);
+	EXPECT_TRUE(log.isDrawn(90));
+	EXPECT_FALSE(log.isDrawn(89));
+	EXPECT_EQ(log.recency(45), 0);
+	EXPECT_EQ(log.recency(12), 2);
+	EXPECT_EQ(log.subRoundOf(1), 0);
+	EXPECT_EQ(log.subRoundOf(2), 1);
+	EXPECT_EQ(log.mask().count(), 3);
+	log.pop();
+	EXPECT_FALSE(log.isDrawn(45));
+	EXPECT_EQ(log.recency(90), 0);
+}
+
+TEST(DrawLog, Duplicates) {
+	DrawLog log;
+	log.push(60, 0);
+	log.push(30, 0);
+	log.push(60, 0);
+	EXPECT_EQ(log.recency(60), 0);
+	log.pop();
+	EXPECT_TRUE(log.isDrawn(60));
+	EXPECT_EQ(log.recency(60), 1);
+	for (uint8_t number = 1; log.size() < DrawLog::g_capacity; ++number) log.push(number, 0);
+	EXPECT_FALSE(log.push(5, 0));
+}
+
+TEST(DrawLog, GameRound) {
+	GameRound gr{GameRound::Type::OneQuineFullCard};
+	gr.nextStatus();
+	gr.addPickedNumber(60);
+	gr.addPickedNumber(0);
+	gr.addPickedNumber(30);
+	gr.addWinner("12");
+	gr.addPickedNumber(45);
+	EXPECT_EQ(gr.drawsCount(), 3);
+	EXPECT_EQ(gr.getAllDraws(), (GameRound::draws_type{60, 30, 45}));
+	EXPECT_EQ(gr.getDrawLog().subRoundOf(2), 1);
+	gr.removeLastPick();
+	EXPECT_EQ(gr.getDrawLog().last(), 30);
+	gr.addPickedNumber(45);
+
+	std::stringstream stream(std::ios::in | std::ios::out | std::ios::binary);
+	gr.write(stream);
+	GameRound gr2;
+	gr2.read(stream, getSaveVersion());
+	EXPECT_EQ(gr2.getAllDraws(), gr.getAllDraws());
+	EXPECT_EQ(gr2.getDrawLog().recency(60), 2);
+	EXPECT_EQ(gr2.getDrawLog().subRoundOf(2), 1);
+}
@@ -10,6 +10,7 @@
 
 #include <core/utilities.h>
 #include <fstream>
+#include <random>
 
 using namespace evl::core;
 
@@ -230,3 +231,103 @@ TEST(Event, YamlSerialize) {
 				 "un bon pour un tour à l’urinoir\nun colonel");
 	remove_all(tmp);
 }
+
+TEST(Event, LiveStatistics) {
+	Event evt;
+	evt.setName("toto");
+	evt.setOrganizerName("toto tata");
+	evt.pushGameRound(GameRound(GameRound::Type::OneQuineFullCard));
+	evt.pushGameRound(GameRound(GameRound::Type::Enfant));
+	evt.nextState();
+	evt.nextState();
+	const uint64_t version = evt.getStats().getVersion();
+	evt.addPickedNumber(12);
+	evt.addPickedNumber(45);
+	evt.addPickedNumber(7);
+	EXPECT_NE(evt.getStats().getVersion(), version);
+	EXPECT_EQ(evt.getStats().mostPickList, (Statistics::pick_list{7, 12, 45}));
+	evt.removeLastPick();
+	EXPECT_EQ(evt.getStats().mostPickList, (Statistics::pick_list{12, 45}));
+	EXPECT_EQ(evt.getStats().lessPickList.size(), 88);
+	evt.addWinnerToCurrentRound("153");
+	EXPECT_EQ(evt.getStats().subRoundMostNb, 2);
+	evt.addPickedNumber(80);
+	evt.addWinnerToCurrentRound("154");
+	evt.nextState();
+	evt.nextState();
+	const auto computed = evt.computeStats();
+	const auto& live = evt.getStats();
+	EXPECT_EQ(live.mostPickList, computed.mostPickList);
+	EXPECT_EQ(live.lessPickNb, computed.lessPickNb);
+	EXPECT_EQ(live.roundMostNb, computed.roundMostNb);
+	EXPECT_EQ(live.subRoundMostNb, computed.subRoundMostNb);
+	EXPECT_EQ(live.subRoundLessNb, computed.subRoundLessNb);
+	EXPECT_DOUBLE_EQ(live.subRoundAverageNb, computed.subRoundAverageNb);
+	// child rounds are not counted
+	const uint64_t before = live.getVersion();
+	evt.addPickedNumber(33);
+	EXPECT_EQ(evt.getStats().getVersion(), before);
+}
+
+TEST(Event, PickListsUpdate) {
+	// the lists kept draw after draw match the ones counted from scratch
+	Statistics stats;
+	std::array<int, 90> counts{};
+	std::mt19937 gen(42);
+	std::uniform_int_distribution<int> number(1, 90);
+	for (int i = 0; i < 3000; ++i) {
+		const auto draw = static_cast<uint8_t>(number(gen));
+		if (i % 3 == 2 && counts[draw - 1] > 0) {
+			stats.popDraw(draw);
+			--counts[draw - 1];
+		} else {
+			stats.pushDraw(draw);
+			++counts[draw - 1];
+		}
+		const int least = std::ranges::min(counts);
+		const int most = std::ranges::max(counts);
+		Statistics::pick_list leastList;
+		Statistics::pick_list mostList;
+		for (uint8_t n = 1; n <= 90; ++n) {
+			if (counts[n - 1] == least)
+				leastList.push_back(n);
+			if (counts[n - 1] == most)
+				mostList.push_back(n);
+		}
+		ASSERT_EQ(stats.lessPickNb, least);
+		ASSERT_EQ(stats.mostPickNb, most);
+		ASSERT_EQ(stats.lessPickList, leastList);
+		ASSERT_EQ(stats.mostPickList, mostList);
+	}
+}
+
+TEST(Event, CurrentRoundCursor) {
+	Event evt;
+	evt.setName("toto");
+	evt.setOrganizerName("toto tata");
+	for (int i = 0; i < 200; ++i) evt.pushGameRound(GameRound(GameRound::Type::OneQuineFullCard));
+	evt.nextState();
+	evt.nextState();
+	for (int i = 0; i < 150; ++i) {
+		EXPECT_EQ(evt.getCurrentGameRoundIndex(), i);
+		evt.addPickedNumber(static_cast<uint8_t>(i % 90 + 1));
+		evt.addWinnerToCurrentRound("153");
+		EXPECT_EQ(evt.getCurrentCGameRound()->getCurrentSubRound()->getType(), SubGameRound::Type::FullCard);
+		evt.addWinnerToCurrentRound("154");
+		EXPECT_EQ(evt.getCurrentCGameRound()->getCurrentSubRound(), evt.getCurrentCGameRound()->endSubRound());
+		evt.nextState();
+	}
+	EXPECT_EQ(evt.getCurrentGameRoundIndex(), 150);
+	EXPECT_FALSE(evt.isCurrentGameRoundLast());
+	EXPECT_EQ(evt.getNextCGameRound(), std::next(evt.beginRounds(), 151));
+
+	// the cursor is rebuilt when reading
+	std::stringstream stream(std::ios::in | std::ios::out | std::ios::binary);
+	evt.write(stream);
+	Event evt2;
+	evt2.read(stream, getSaveVersion());
+	EXPECT_EQ(evt2.getCurrentGameRoundIndex(), 150);
+	evt2.addWinnerToCurrentRound("155");
+	EXPECT_EQ(evt2.getCurrentCGameRound()->getCurrentSubRound()->getType(), SubGameRound::Type::FullCard);
+	EXPECT_TRUE(evt2.canDraw());
+}
@@ -0,0 +1,157 @@
+/**
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "../TestMainHelper.h"
+
+#include "core/Event.h"
+#include "core/EventFile.h"
+
+using namespace evl::core;
+
+namespace {
+auto makeGame() -> Event {
+	Event evt;
+	evt.setName("Loto de la fête");
+	evt.setOrganizerName("Comité");
+	evt.setLocation("Salle des fêtes");
+	evt.setRules("Un carton par personne");
+	evt.pushGameRound(GameRound(GameRound::Type::OneQuineFullCard));
+	evt.pushGameRound(GameRound(GameRound::Type::Inverse));
+	evt.getGameRound(0)->getSubRound(1)->define(SubGameRound::Type::FullCard, "un jambon", 25.0);
+	evt.nextState();
+	evt.nextState();
+	for (const uint8_t draw: {12, 45, 7}) evt.addPickedNumber(draw);
+	evt.addWinnerToCurrentRound("153");
+	evt.addPickedNumber(90);
+	return evt;
+}
+
+/// Write an event in the version 8 format, with the round serialization kept for the old files.
+auto writeVersion8(const Event& iEvent) -> std::string {
+	std::ostringstream stream(std::ios::out | std::ios::binary);
+	const uint16_t version = 8;
+	stream.write(reinterpret_cast<const char*>(&version), sizeof(version));
+	const auto status = iEvent.getStatus();
+	stream.write(reinterpret_cast<const char*>(&status), sizeof(status));
+	eventFile::writeLegacyString(stream, iEvent.getOrganizerName());
+	eventFile::writeLegacyString(stream, "");
+	eventFile::writeLegacyString(stream, iEvent.getName());
+	eventFile::writeLegacyString(stream, "");
+	eventFile::writeLegacyString(stream, iEvent.getLocation());
+	eventFile::writeLegacyString(stream, iEvent.getRules());
+	const Event::rounds_type::size_type count = iEvent.sizeRounds();
+	stream.write(reinterpret_cast<const char*>(&count), sizeof(count));
+	for (auto round = iEvent.beginRounds(); round != iEvent.endRounds(); ++round) round->write(stream);
+	stream.write(reinterpret_cast<const char*>(&iEvent.getStarting()), sizeof(time_point));
+	stream.write(reinterpret_cast<const char*>(&iEvent.getEnding()), sizeof(time_point));
+	eventFile::writeLegacyString(stream, "");
+	return stream.str();
+}
+
+void expectSameEvent(const Event& iExpected, const Event& iActual) {
+	EXPECT_EQ(iActual.getName(), iExpected.getName());
+	EXPECT_EQ(iActual.getOrganizerName(), iExpected.getOrganizerName());
+	EXPECT_EQ(iActual.getLocation(), iExpected.getLocation());
+	EXPECT_EQ(iActual.getRules(), iExpected.getRules());
+	EXPECT_EQ(iActual.getStatus(), iExpected.getStatus());
+	EXPECT_EQ(iActual.getStarting(), iExpected.getStarting());
+	ASSERT_EQ(iActual.sizeRounds(), iExpected.sizeRounds());
+	for (auto expected = iExpected.beginRounds(), actual = iActual.beginRounds(); expected != iExpected.endRounds();
+		 ++expected, ++actual) {
+		EXPECT_EQ(actual->getType(), expected->getType());
+		EXPECT_EQ(actual->getStatus(), expected->getStatus());
+		EXPECT_EQ(actual->getAllDraws(), expected->getAllDraws());
+		ASSERT_EQ(actual->sizeSubRound(), expected->sizeSubRound());
+		for (auto subExp = expected->beginSubRound(), sub = actual->beginSubRound(); subExp != expected->endSubRound();
+			 ++subExp, ++sub) {
+			EXPECT_EQ(sub->getWinner(), subExp->getWinner());
+			EXPECT_EQ(sub->getPrices(), subExp->getPrices());
+			EXPECT_EQ(sub->getDrawDelays(), subExp->getDrawDelays());
+			EXPECT_EQ(sub->getStarting(), subExp->getStarting());
+		}
+	}
+	EXPECT_EQ(iActual.getCurrentGameRoundIndex(), iExpected.getCurrentGameRoundIndex());
+}
+}// namespace
+
+TEST(EventFile, RoundTrip) {
+	const Event evt = makeGame();
+	std::stringstream stream(std::ios::in | std::ios::out | std::ios::binary);
+	evt.write(stream);
+	const auto content = stream.str();
+	uint16_t version = 0;
+	std::memcpy(&version, content.data(), sizeof(version));
+	EXPECT_EQ(version, getSaveVersion());
+	EXPECT_EQ(content.substr(2, eventFile::g_magic.size()), eventFile::g_magic);
+
+	Event evt2;
+	evt2.read(stream, 0);
+	EXPECT_FALSE(stream.fail());
+	expectSameEvent(evt, evt2);
+}
+
+TEST(EventFile, MappedView) {
+	const fs::path file = fs::temp_directory_path() / "test_event_file.lev";
+	const Event evt = makeGame();
+	{
+		std::ofstream stream(file, std::ios::out | std::ios::binary);
+		evt.write(stream);
+	}
+	EventFileView view;
+	ASSERT_TRUE(view.open(file));
+	EXPECT_EQ(view.getString(eventFile::EventString::Name), "Loto de la fête");
+	EXPECT_EQ(view.roundCount(), 2);
+	const auto round = view.round(0);
+	EXPECT_EQ(static_cast<GameRound::Type>(round.type), GameRound::Type::OneQuineFullCard);
+	const auto sub = view.subRound(round.firstSubRound + 1);
+	EXPECT_EQ(sub.prices, "un jambon");
+	EXPECT_DOUBLE_EQ(sub.value, 25.0);
+	const auto first = view.subRound(round.firstSubRound);
+	EXPECT_EQ(std::vector(first.draws.begin(), first.draws.end()), (std::vector<uint8_t>{12, 45, 7}));
+	EXPECT_EQ(first.winner, "153");
+
+	Event evt2;
+	evt2.readChunks(view);
+	expectSameEvent(evt, evt2);
+	fs::remove(file);
+}
+
+TEST(EventFile, Validation) {
+	std::stringstream stream(std::ios::in | std::ios::out | std::ios::binary);
+	makeGame().write(stream);
+	const auto content = stream.str();
+	const std::span data{reinterpret_cast<const uint8_t*>(content.data()), content.size()};
+	EventFileView view;
+	EXPECT_TRUE(view.parse(data));
+	EXPECT_FALSE(view.parse(data.first(data.size() - 1)));
+	// a string reference out of the pool
+	auto corrupted = content;
+	const size_t event = eventFile::g_headerSize + eventFile::g_chunkCount * eventFile::g_tocEntrySize;
+	corrupted[event + 17 + 7] = static_cast<char>(0x7F);// size of the organizer name
+	EXPECT_FALSE(view.parse({reinterpret_cast<const uint8_t*>(corrupted.data()), corrupted.size()}));
+	// a status out of the enumeration
+	corrupted = content;
+	corrupted[event] = static_cast<char>(0x7F);
+	EXPECT_FALSE(view.parse({reinterpret_cast<const uint8_t*>(corrupted.data()), corrupted.size()}));
+
+	// a stream announcing a huge file is refused without allocating it
+	auto huge = content;
+	huge[15] = static_cast<char>(0x7F);
+	std::istringstream hugeStream(huge, std::ios::in | std::ios::binary);
+	Event evt;
+	evt.read(hugeStream, 0);
+	EXPECT_TRUE(hugeStream.fail());
+	EXPECT_EQ(evt.sizeRounds(), 0);
+}
+
+TEST(EventFile, Version8) {
+	const Event evt = makeGame();
+	std::istringstream stream(writeVersion8(evt), std::ios::in | std::ios::binary);
+	Event evt2;
+	evt2.read(stream, 0);
+	EXPECT_FALSE(stream.fail());
+	expectSameEvent(evt, evt2);
+}
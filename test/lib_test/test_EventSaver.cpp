@@ -0,0 +1,46 @@
+/**
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "../TestMainHelper.h"
+
+#include "core/EventSaver.h"
+
+using namespace evl::core;
+
+TEST(EventSaver, Save) {
+	const fs::path tmp = fs::temp_directory_path() / "test_saver";
+	remove_all(tmp);
+	create_directories(tmp);
+	const fs::path file = tmp / "soiree.lev";
+	std::ofstream(file) << "previous content";
+
+	Event evt;
+	evt.setName("toto");
+	evt.setOrganizerName("toto tata");
+	evt.pushGameRound(GameRound(GameRound::Type::OneQuineFullCard));
+	EventSaver saver;
+	EXPECT_EQ(saver.getStatus(), EventSaver::Status::Idle);
+	saver.save(evt, file);
+	// the game goes on while the copy is written
+	evt.setName("titi");
+	saver.wait();
+	EXPECT_EQ(saver.getStatus(), EventSaver::Status::Succeeded);
+	EXPECT_EQ(saver.getFile(), file);
+	EXPECT_FALSE(fs::exists(tmp / "soiree.lev.tmp"));
+
+	Event loaded;
+	std::ifstream stream(file, std::ios::in | std::ios::binary);
+	loaded.read(stream, 0);
+	EXPECT_EQ(loaded.getName(), "toto");
+	EXPECT_EQ(loaded.sizeRounds(), 1);
+
+	// a failed save leaves nothing behind
+	saver.save(evt, tmp / "missing" / "soiree.lev");
+	saver.wait();
+	EXPECT_EQ(saver.getStatus(), EventSaver::Status::Failed);
+	EXPECT_FALSE(fs::exists(tmp / "missing"));
+	remove_all(tmp);
+}
@@ -0,0 +1,57 @@
+/**
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "../TestMainHelper.h"
+#include "core/FileWatcher.h"
+
+#include <fstream>
+
+using namespace evl::core;
+
+namespace {
+void writeFile(const fs::path& iFile, const std::string_view iContent) {
+	std::ofstream out(iFile);
+	out << iContent;
+}
+
+auto waitChanges(FileWatcher& ioWatcher) -> std::vector<fs::path> {
+	for (int i = 0; i < 200; ++i) {
+		if (auto changes = ioWatcher.takeChanges(); !changes.empty())
+			return changes;
+		std::this_thread::sleep_for(std::chrono::milliseconds{10});
+	}
+	return {};
+}
+}// namespace
+
+TEST(FileWatcher, Changes) {
+	const fs::path root = fs::temp_directory_path() / "evl_file_watcher";
+	fs::remove_all(root);
+	fs::create_directories(root / "theme");
+	const fs::path config = root / "config.yml";
+	writeFile(config, "a: 1\n");
+	writeFile(root / "other.yml", "a: 1\n");
+	{
+		FileWatcher watcher({config, root / "theme"}, std::chrono::milliseconds{20});
+		std::this_thread::sleep_for(std::chrono::milliseconds{100});
+		EXPECT_TRUE(watcher.takeChanges().empty());
+
+		// written beside then renamed, as the settings saver does
+		writeFile(root / "config.yml.tmp", "a: 2\n");
+		fs::rename(root / "config.yml.tmp", config);
+		EXPECT_EQ(waitChanges(watcher), std::vector{fs::absolute(config).lexically_normal()});
+
+		// a file of a watched folder
+		writeFile(root / "theme" / "dark.lth", "theme: {}\n");
+		EXPECT_EQ(waitChanges(watcher), std::vector{fs::absolute(root / "theme" / "dark.lth").lexically_normal()});
+
+		// not watched
+		writeFile(root / "other.yml", "a: 2\n");
+		std::this_thread::sleep_for(std::chrono::milliseconds{100});
+		EXPECT_TRUE(watcher.takeChanges().empty());
+	}
+	fs::remove_all(root);
+}
@@ -0,0 +1,81 @@
+/**
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "../TestMainHelper.h"
+
+#include "core/Event.h"
+
+using namespace evl::core;
+
+TEST(Forecast, Counters) {
+	std::vector<GameRound> rounds;
+	rounds.emplace_back(GameRound::Type::OneTwoQuineFullCard);
+	rounds.emplace_back(GameRound::Type::Pause);
+	rounds.emplace_back(GameRound::Type::Inverse);
+	Forecast forecast;
+	forecast.reset(rounds);
+	EXPECT_EQ(forecast.getRemainingCount(SubGameRound::Type::OneQuine), 1);
+	EXPECT_EQ(forecast.getRemainingCount(SubGameRound::Type::FullCard), 1);
+	EXPECT_EQ(forecast.getRemainingCount(SubGameRound::Type::Inverse), 1);
+	const duration overhead = forecast.getOverhead();
+	const duration pace = forecast.getPace();
+	const double draws = forecast.getExpectedDraws(SubGameRound::Type::OneQuine) +
+						 forecast.getExpectedDraws(SubGameRound::Type::TwoQuines) +
+						 forecast.getExpectedDraws(SubGameRound::Type::FullCard) +
+						 forecast.getExpectedDraws(SubGameRound::Type::Inverse);
+	EXPECT_NEAR(forecast.getRemaining().count(), (pace * draws + overhead * 4.0 + duration{900.0}).count(), 1e-6);
+
+	forecast.closePause(duration{600.0});
+	forecast.closeSubRound(SubGameRound::Type::OneQuine, 20);
+	EXPECT_EQ(forecast.getRemainingCount(SubGameRound::Type::OneQuine), 0);
+	EXPECT_DOUBLE_EQ(forecast.getExpectedDraws(SubGameRound::Type::OneQuine), 16.0);
+	forecast.setExpectedDraws(SubGameRound::Type::TwoQuines, 10.0);
+	EXPECT_DOUBLE_EQ(forecast.getExpectedDraws(SubGameRound::Type::TwoQuines), 10.0);
+}
+
+TEST(Forecast, Pace) {
+	Forecast forecast;
+	forecast.reset({GameRound(GameRound::Type::Enfant)});
+	const duration before = forecast.getRemaining();
+	time_point now = clock::now();
+	forecast.pushDraw(SubGameRound::Type::OneQuine, now);
+	EXPECT_LT(forecast.getRemaining(), before);
+	for (int i = 0; i < 20; ++i) {
+		now += std::chrono::seconds(30);
+		forecast.pushDraw(SubGameRound::Type::OneQuine, now);
+	}
+	EXPECT_GT(forecast.getPace(), duration{25.0});
+	// an interruption does not count as a draw interval
+	const duration pace = forecast.getPace();
+	now += std::chrono::hours(1);
+	forecast.pushDraw(SubGameRound::Type::OneQuine, now);
+	EXPECT_EQ(forecast.getPace(), pace);
+	// all expected draws done: only the overhead remains
+	EXPECT_NEAR(forecast.getRemaining().count(), forecast.getOverhead().count(), 1e-6);
+	forecast.popDraw();
+	forecast.closeSubRound(SubGameRound::Type::OneQuine, 21);
+	EXPECT_EQ(forecast.getRemaining(), duration::zero());
+}
+
+TEST(Forecast, EventUpdates) {
+	Event evt;
+	evt.setName("toto");
+	evt.setOrganizerName("toto tata");
+	evt.pushGameRound(GameRound(GameRound::Type::Enfant));
+	evt.pushGameRound(GameRound(GameRound::Type::Enfant));
+	evt.nextState();
+	evt.nextState();
+	EXPECT_EQ(evt.getForecast().getRemainingCount(SubGameRound::Type::OneQuine), 2);
+	const duration start = evt.getForecast().getRemaining();
+	evt.addPickedNumber(12);
+	evt.addPickedNumber(45);
+	EXPECT_LT(evt.getForecast().getRemaining(), start);
+	evt.removeLastPick();
+	evt.addWinnerToCurrentRound("153");
+	evt.nextState();
+	EXPECT_EQ(evt.getForecast().getRemainingCount(SubGameRound::Type::OneQuine), 1);
+	EXPECT_DOUBLE_EQ(evt.getForecast().getExpectedDraws(SubGameRound::Type::OneQuine), 6.5);
+}
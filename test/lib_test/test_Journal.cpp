@@ -0,0 +1,145 @@
+/**
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "../TestMainHelper.h"
+
+#include "core/Journal.h"
+
+using namespace evl::core;
+
+namespace {
+/// Summary of the game state of an event.
+auto gameState(const Event& iEvent) -> std::string {
+	std::string state = iEvent.getStateString();
+	for (auto round = iEvent.beginRounds(); round != iEvent.endRounds(); ++round) {
+		state += std::format("|{}:{}", round->getStatusStr(), round->getDrawStr());
+		for (auto sub = round->beginSubRound(); sub != round->endSubRound(); ++sub) state += sub->getWinner() + ";";
+	}
+	return state;
+}
+
+/// Full serialized state of an event, clock values included.
+auto savedState(const Event& iEvent) -> std::string {
+	std::ostringstream stream(std::ios::out | std::ios::binary);
+	iEvent.write(stream);
+	return stream.str();
+}
+
+auto makeGame() -> Event {
+	Event evt;
+	evt.setName("toto");
+	evt.setOrganizerName("toto tata");
+	for (int i = 0; i < 6; ++i) evt.pushGameRound(GameRound(GameRound::Type::OneQuineFullCard));
+	return evt;
+}
+}// namespace
+
+TEST(Journal, UndoRedo) {
+	Event evt = makeGame();
+	Journal journal(evt);
+	EXPECT_FALSE(journal.canUndo());
+	// edited before the first operation: kept by the undo
+	evt.setName("titi");
+	journal.addWinner("152");// refused: not recorded
+	EXPECT_FALSE(journal.canUndo());
+	journal.nextState();
+	journal.nextState();
+	journal.draw(12);
+	journal.draw(45);
+	journal.draw(0);// refused: not recorded
+	EXPECT_EQ(journal.getPosition(), 4);
+	journal.cancelPick();
+	EXPECT_EQ(evt.getCurrentCGameRound()->drawsCount(), 1);
+	EXPECT_TRUE(journal.undo());
+	EXPECT_EQ(evt.getCurrentCGameRound()->getAllDraws(), (GameRound::draws_type{12, 45}));
+	journal.addWinner("");// refused: not recorded
+	EXPECT_EQ(journal.getPosition(), 4);
+	journal.addWinner("153");
+	EXPECT_FALSE(journal.canRedo());
+	const auto afterWinner = gameState(evt);
+	// a mistaken winner is reverted
+	EXPECT_TRUE(journal.undo());
+	EXPECT_EQ(evt.getCurrentCGameRound()->getCurrentSubRound()->getType(), SubGameRound::Type::OneQuine);
+	EXPECT_TRUE(evt.getCurrentCGameRound()->beginSubRound()->getWinner().empty());
+	EXPECT_EQ(evt.getCurrentCGameRound()->getAllDraws(), (GameRound::draws_type{12, 45}));
+	EXPECT_TRUE(journal.redo());
+	EXPECT_EQ(gameState(evt), afterWinner);
+	EXPECT_FALSE(journal.redo());
+	// a new operation after an undo drops the redo history
+	journal.undo();
+	journal.addWinner("154");
+	EXPECT_FALSE(journal.canRedo());
+	EXPECT_EQ(journal.getWinner(journal.getRecords().back()), "154");
+	EXPECT_TRUE(journal.seek(0));
+	EXPECT_EQ(evt.getName(), "titi");
+	EXPECT_EQ(evt.getStatus(), Event::Status::Ready);
+}
+
+TEST(Journal, Replay) {
+	Event evt = makeGame();
+	Journal journal(evt);
+	std::vector<std::string> states{gameState(evt)};
+	const auto step = [&](const auto& iOperation) {
+		iOperation();
+		states.push_back(gameState(evt));
+	};
+	step([&] { journal.nextState(); });
+	step([&] { journal.nextState(); });
+	for (uint8_t round = 0; round < 6; ++round) {
+		for (uint8_t draw = 1; draw <= 10; ++draw) step([&] { journal.draw(draw + round); });
+		step([&] { journal.cancelPick(); });
+		step([&] { journal.addWinner("a"); });
+		step([&] { journal.displayRules(); });
+		step([&] { journal.displayRules(); });
+		step([&] { journal.draw(50); });
+		step([&] { journal.addWinner("b"); });
+		step([&] { journal.nextState(); });
+	}
+	ASSERT_EQ(journal.getPosition() + 1, states.size());
+	ASSERT_GT(journal.getPosition(), 2 * Journal::g_snapshotInterval);
+	for (const size_t position: {size_t{0}, size_t{17}, size_t{60}, size_t{33}, states.size() - 1, size_t{90}}) {
+		EXPECT_TRUE(journal.seek(position));
+		EXPECT_EQ(gameState(evt), states[position]) << "position " << position;
+	}
+	while (journal.canUndo()) {
+		journal.undo();
+		EXPECT_EQ(gameState(evt), states[journal.getPosition()]) << "position " << journal.getPosition();
+	}
+	EXPECT_FALSE(journal.seek(states.size()));
+}
+
+TEST(Journal, ReplayKeepsTimes) {
+	Event evt = makeGame();
+	Journal journal(evt);
+	time_point now = clock::now();
+	const auto tick = [&now] { return now += std::chrono::seconds(7); };
+	std::vector<std::string> states{savedState(evt)};
+	const auto step = [&](const auto& iOperation) {
+		iOperation();
+		states.push_back(savedState(evt));
+	};
+	step([&] { journal.nextState(tick()); });
+	step([&] { journal.nextState(tick()); });
+	for (uint8_t round = 0; round < 3; ++round) {
+		for (uint8_t draw = 1; draw <= 5; ++draw) step([&] { journal.draw(draw + round, tick()); });
+		step([&] { journal.cancelPick(); });
+		step([&] { journal.addWinner("a", tick()); });
+		step([&] { journal.draw(50, tick()); });
+		step([&] { journal.addWinner("b", tick()); });
+		step([&] { journal.nextState(tick()); });
+	}
+	ASSERT_EQ(journal.getPosition() + 1, states.size());
+	// the undone operations are replayed later: the times are those of the records
+	now += std::chrono::hours(1);
+	while (journal.canUndo()) {
+		journal.undo();
+		EXPECT_EQ(savedState(evt), states[journal.getPosition()]) << "position " << journal.getPosition();
+	}
+	EXPECT_TRUE(journal.seek(states.size() - 1));
+	EXPECT_EQ(savedState(evt), states.back());
+	EXPECT_TRUE(journal.seek(9));
+	EXPECT_EQ(savedState(evt), states[9]);
+}
@@ -30,3 +30,27 @@ TEST(Log, InitAndInvalidate) {
 	// restore test global level for other tests
 	Log::setVerbosityLevel(g_logLv);
 }
+
+TEST(Log, Filtering) {
+	Log::setVerbosityLevel(Log::Level::Error);
+	EXPECT_FALSE(Log::isEnabled(Log::Level::Warning));
+	EXPECT_TRUE(Log::isEnabled(Log::Level::Error));
+	EXPECT_FALSE(Log::isEnabled(Log::Level::Off));
+
+	// the arguments of a filtered call are not evaluated
+	int evaluated = 0;
+	const auto count = [&evaluated] { return ++evaluated; };
+	logs::LogBuffer::get().clear();
+	log_warn("filtered {}", count());
+	EXPECT_EQ(evaluated, 0);
+	log_error("test message {}", count());
+	EXPECT_EQ(evaluated, 1);
+	ASSERT_EQ(logs::LogBuffer::get().getLogs().size(), 1);
+	EXPECT_EQ(logs::LogBuffer::get().getLogs().back().message, "test message 1");
+	logs::LogBuffer::get().clear();
+
+	Log::invalidate();
+	EXPECT_FALSE(Log::isEnabled(Log::Level::Critical));
+	Log::init(g_logLv);
+	EXPECT_EQ(Log::getVerbosityLevel(), g_logLv);
+}
@@ -0,0 +1,207 @@
+/**
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "../TestMainHelper.h"
+
+#include "core/Event.h"
+#include "core/EventFile.h"
+#include "core/Migration.h"
+#include "core/utilities.h"
+
+using namespace evl::core;
+namespace fs = std::filesystem;
+using Outcome = MigrationResult::Outcome;
+
+namespace {
+auto makeGame(const std::string& iName) -> Event {
+	Event evt;
+	evt.setName(iName);
+	evt.setOrganizerName("Comité");
+	evt.setLocation("Salle des fêtes");
+	evt.pushGameRound(GameRound(GameRound::Type::OneQuineFullCard));
+	evt.nextState();
+	evt.nextState();
+	for (const uint8_t draw: {12, 45, 7}) evt.addPickedNumber(draw);
+	return evt;
+}
+
+/// Write an event in the version 8 format, with a corrupt round count if given.
+auto writeVersion8(const Event& iEvent, const std::optional<Event::rounds_type::size_type>& iRoundCount = {})
+		-> std::string {
+	std::ostringstream stream(std::ios::out | std::ios::binary);
+	const uint16_t version = 8;
+	stream.write(reinterpret_cast<const char*>(&version), sizeof(version));
+	const auto status = iEvent.getStatus();
+	stream.write(reinterpret_cast<const char*>(&status), sizeof(status));
+	for (const auto& text: {iEvent.getOrganizerName(), std::string{}, iEvent.getName(), std::string{},
+							iEvent.getLocation(), iEvent.getRules()})
+		eventFile::writeLegacyString(stream, text);
+	const Event::rounds_type::size_type count = iRoundCount.value_or(iEvent.sizeRounds());
+	stream.write(reinterpret_cast<const char*>(&count), sizeof(count));
+	for (auto round = iEvent.beginRounds(); round != iEvent.endRounds(); ++round) round->write(stream);
+	stream.write(reinterpret_cast<const char*>(&iEvent.getStarting()), sizeof(time_point));
+	stream.write(reinterpret_cast<const char*>(&iEvent.getEnding()), sizeof(time_point));
+	eventFile::writeLegacyString(stream, "");
+	return stream.str();
+}
+
+template<typename T>
+void put(std::ostream& oStream, const T& iValue) {
+	oStream.write(reinterpret_cast<const char*>(&iValue), sizeof(T));
+}
+
+/// Write a running event of one round in the version 2 or 3 format: the draws are saved by round.
+auto writeVersion3(const uint16_t iVersion) -> std::string {
+	std::ostringstream stream(std::ios::out | std::ios::binary);
+	put(stream, iVersion);
+	put(stream, Event::Status::GameRunning);
+	for (const std::string text: {"Comité", "", "Ancien", "", "Salle des fêtes", "Un carton par personne"})
+		eventFile::writeLegacyString(stream, text);
+	if (iVersion == 3)
+		eventFile::writeLegacyString(stream, "");
+	put(stream, Event::rounds_type::size_type{1});
+	if (iVersion == 3)
+		put(stream, 7);
+	put(stream, GameRound::Type::OneQuineFullCard);
+	put(stream, GameRound::Status::Running);
+	put(stream, time_point{});
+	put(stream, time_point{});
+	const GameRound::draws_type draws{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+	put(stream, draws.size());
+	stream.write(reinterpret_cast<const char*>(draws.data()), static_cast<std::streamsize>(draws.size()));
+	put(stream, GameRound::sub_rounds_type::size_type{2});
+	put(stream, SubGameRound::Type::OneQuine);
+	put(stream, uint32_t{1});
+	eventFile::writeLegacyString(stream, "un jambon");
+	put(stream, SubGameRound::Type::FullCard);
+	put(stream, uint32_t{0});
+	eventFile::writeLegacyString(stream, "");
+	put(stream, time_point{});
+	put(stream, time_point{});
+	return stream.str();
+}
+
+auto writeCurrent(const Event& iEvent) -> std::string {
+	std::ostringstream stream(std::ios::out | std::ios::binary);
+	iEvent.write(stream);
+	return stream.str();
+}
+
+void writeFile(const fs::path& iFile, const std::string& iContent) {
+	std::ofstream out(iFile, std::ios::binary | std::ios::trunc);
+	out.write(iContent.data(), static_cast<std::streamsize>(iContent.size()));
+}
+
+auto readFile(const fs::path& iFile) -> std::string {
+	std::ifstream in(iFile, std::ios::binary);
+	return {std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>()};
+}
+
+auto findResult(const MigrationReport& iReport, const std::string& iName) -> const MigrationResult& {
+	return *std::ranges::find(iReport.files, iName, [](const MigrationResult& iResult) {
+		return iResult.file.filename().string();
+	});
+}
+}// namespace
+
+TEST(Migration, Steps) {
+	const auto steps = getMigrationSteps();
+	ASSERT_FALSE(steps.empty());
+	EXPECT_EQ(steps.back().version, getSaveVersion());
+	EXPECT_TRUE(std::ranges::is_sorted(steps, {}, &MigrationStep::version));
+	EXPECT_TRUE(getMigrationSteps(getSaveVersion()).empty());
+	ASSERT_EQ(getMigrationSteps(8).size(), 1);
+	EXPECT_EQ(getMigrationSteps(8).front().version, 9);
+	EXPECT_FALSE(std::ranges::any_of(getMigrationSteps(4), &MigrationStep::lossy));
+	EXPECT_TRUE(std::ranges::any_of(getMigrationSteps(3), &MigrationStep::lossy));
+	EXPECT_FALSE(hasFormatChange(eventFile::g_firstVersion - 1, FormatChange::Chunks));
+	EXPECT_TRUE(hasFormatChange(eventFile::g_firstVersion, FormatChange::Chunks));
+	EXPECT_TRUE(hasFormatChange(3, FormatChange::RoundIds));
+	EXPECT_FALSE(hasFormatChange(3, FormatChange::SubRoundResults));
+}
+
+TEST(Migration, DrawsByRound) {
+	for (const uint16_t version: {uint16_t{2}, uint16_t{3}}) {
+		std::istringstream stream(writeVersion3(version), std::ios::in | std::ios::binary);
+		Event event;
+		event.read(stream, 0, Event::CardLoading::Skip);
+		ASSERT_FALSE(stream.fail()) << "version " << version;
+		EXPECT_EQ(event.getName(), "Ancien");
+		EXPECT_EQ(event.getRules(), "Un carton par personne");
+		const auto round = event.beginRounds();
+		EXPECT_EQ(round->getId(), version == 3 ? 7 : 0);
+		// the draws are shared between the finished sub-round and the current one
+		const auto first = round->beginSubRound();
+		EXPECT_EQ(first->getStatus(), SubGameRound::Status::Done);
+		EXPECT_EQ(first->getWinner(), g_legacyWinner);
+		EXPECT_EQ(first->getPrices(), "un jambon");
+		EXPECT_EQ(first->getDraws(), (SubGameRound::draws_type{1, 2, 3, 4, 5}));
+		const auto second = std::next(first);
+		EXPECT_EQ(second->getStatus(), SubGameRound::Status::Running);
+		EXPECT_EQ(second->getDraws(), (SubGameRound::draws_type{6, 7, 8, 9, 10, 11}));
+		EXPECT_EQ(round->getCurrentSubRound(), second);
+		EXPECT_EQ(round->getAllDraws(), (GameRound::draws_type{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11}));
+	}
+}
+
+TEST(Migration, Directory) {
+	const fs::path tmp = fs::temp_directory_path() / "evl_migration";
+	remove_all(tmp);
+	create_directories(tmp / "2025");
+	const std::string old = writeVersion8(makeGame("Ancien"));
+	const std::string current = writeCurrent(makeGame("Récent"));
+	writeFile(tmp / "2025" / "ancien.lev", old);
+	writeFile(tmp / "recent.lev", current);
+	writeFile(tmp / "tronque.lev", current.substr(0, current.size() / 2));
+	writeFile(tmp / "futur.lev", std::string("\x63\x00 données", 11));
+	writeFile(tmp / "notes.txt", "pas un événement");
+
+	// check only: nothing is written
+	auto report = Migrator({.checkOnly = true, .threads = 2}).migrate(tmp);
+	ASSERT_EQ(report.files.size(), 4);
+	EXPECT_EQ(findResult(report, "ancien.lev").outcome, Outcome::Outdated);
+	EXPECT_EQ(findResult(report, "ancien.lev").version, 8);
+	EXPECT_EQ(findResult(report, "recent.lev").outcome, Outcome::Current);
+	EXPECT_EQ(findResult(report, "tronque.lev").outcome, Outcome::Corrupted);
+	EXPECT_EQ(findResult(report, "futur.lev").outcome, Outcome::Unsupported);
+	EXPECT_EQ(report.failed(), 2);
+	EXPECT_EQ(readFile(tmp / "2025" / "ancien.lev"), old);
+
+	// upgrade
+	report = Migrator({.threads = 2}).migrate(tmp);
+	EXPECT_EQ(findResult(report, "ancien.lev").outcome, Outcome::Upgraded);
+	EXPECT_EQ(report.count(Outcome::Upgraded), 1);
+	EXPECT_EQ(readFile(tmp / "2025" / "ancien.lev.bak"), old);
+	EXPECT_FALSE(exists(tmp / "2025" / "ancien.lev.tmp"));
+	EXPECT_EQ(readFile(tmp / "recent.lev"), current);
+	Event event;
+	std::ifstream in(tmp / "2025" / "ancien.lev", std::ios::binary);
+	event.read(in, 0);
+	EXPECT_FALSE(in.fail());
+	EXPECT_EQ(event.getName(), "Ancien");
+	EXPECT_EQ(event.beginRounds()->getAllDraws(), (std::vector<uint8_t>{12, 45, 7}));
+	in.close();
+
+	// a second run finds everything up to date
+	report = Migrator({.backup = false}).migrate(tmp);
+	EXPECT_EQ(findResult(report, "ancien.lev").outcome, Outcome::Current);
+	EXPECT_EQ(report.count(Outcome::Upgraded), 0);
+	remove_all(tmp);
+}
+
+TEST(Migration, CorruptRoundCount) {
+	const fs::path tmp = fs::temp_directory_path() / "evl_migration_count";
+	remove_all(tmp);
+	create_directories(tmp);
+	const std::string corrupt = writeVersion8(makeGame("Corrompu"), 5'000'000);
+	writeFile(tmp / "corrompu.lev", corrupt);
+
+	const auto report = Migrator({.threads = 1}).migrate(tmp);
+	ASSERT_EQ(report.files.size(), 1);
+	EXPECT_EQ(findResult(report, "corrompu.lev").outcome, Outcome::Corrupted);
+	EXPECT_EQ(readFile(tmp / "corrompu.lev"), corrupt);
+	remove_all(tmp);
+}
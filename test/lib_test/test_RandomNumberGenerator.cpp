@@ -45,3 +45,69 @@ TEST(RandomNumberGenerator, LargePick) {
 	EXPECT_EQ(a, 255);
 	EXPECT_EQ(rng.getPicked().size(), 90);
 }
+
+TEST(RandomNumberGenerator, Seed) {
+	RandomNumberGenerator rng;
+	RandomNumberGenerator rng2;
+	rng.seed(42);
+	rng2.seed(42);
+	for (uint8_t i = 0; i < 90; ++i) EXPECT_EQ(rng.pick(), rng2.pick());
+	EXPECT_FALSE(rng.addPick(12));
+	rng.popNum();
+	EXPECT_EQ(rng.getPicked().size(), 89);
+	const uint8_t last = rng.pick();
+	EXPECT_EQ(rng.getPicked().back(), last);
+	EXPECT_EQ(rng.getPicked().size(), 90);
+}
+
+TEST(RandomNumberGenerator, Engines) {
+	for (const auto engine: {RandomNumberGenerator::Engine::Pcg, RandomNumberGenerator::Engine::Xoshiro,
+							 RandomNumberGenerator::Engine::ChaCha20}) {
+		RandomNumberGenerator rng(true, engine);
+		EXPECT_EQ(rng.getEngine(), engine);
+		NumberMask seen;
+		for (uint8_t i = 0; i < 90; ++i) {
+			const uint8_t n = rng.pick();
+			EXPECT_TRUE(NumberMask::isValid(n));
+			EXPECT_FALSE(seen.test(n));
+			seen.set(n);
+		}
+		EXPECT_EQ(rng.pick(), 255);
+		// same key, same draws
+		RandomNumberGenerator other(false, engine);
+		other.seed(1234);
+		for (const auto n: rng.getPicked()) EXPECT_EQ(other.pick(), n);
+	}
+	RandomNumberGenerator rng(true);
+	rng.setEngine(RandomNumberGenerator::Engine::ChaCha20);
+	EXPECT_EQ(rng.getEngine(), RandomNumberGenerator::Engine::ChaCha20);
+}
+
+TEST(RandomNumberGenerator, UrnManual) {
+	RandomNumberGenerator rng(true);
+	EXPECT_FALSE(rng.addPick(0));
+	EXPECT_FALSE(rng.addPick(91));
+	for (uint8_t n = 1; n <= 89; ++n) EXPECT_TRUE(rng.addPick(n));
+	EXPECT_EQ(rng.pick(), 90);
+	rng.popNum();
+	rng.popNum();
+	EXPECT_EQ(rng.getPicked().back(), 88);
+	EXPECT_TRUE(rng.addPick(90));
+	EXPECT_EQ(rng.pick(), 89);
+}
+
+TEST(RandomEngines, ChaCha20Vector) {
+	// keystream of the null key and null nonce
+	ChaCha20 engine;
+	engine.seed({});
+	EXPECT_EQ(engine(), 0xADE0B876);
+	EXPECT_EQ(engine(), 0x903DF1A0);
+}
+
+TEST(RandomEngines, Bounded) {
+	Pcg32 engine;
+	engine.seed(expandSeed(7));
+	std::array<uint32_t, 3> counts{};
+	for (int i = 0; i < 3000; ++i) ++counts[boundedRandom(engine, 3)];
+	for (const auto count: counts) EXPECT_GT(count, 800);
+}
@@ -0,0 +1,109 @@
+/**
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "../TestMainHelper.h"
+
+#include "core/SeasonAggregator.h"
+
+using namespace evl::core;
+namespace fs = std::filesystem;
+
+namespace {
+void writeEvent(const fs::path& iPath, const std::vector<uint8_t>& iDraws) {
+	Event evt;
+	evt.setName("toto");
+	evt.setOrganizerName("toto tata");
+	evt.pushGameRound(GameRound(GameRound::Type::OneQuineFullCard));
+	evt.pushGameRound(GameRound(GameRound::Type::Inverse));
+	evt.nextState();
+	evt.nextState();
+	for (const auto draw: iDraws) evt.addPickedNumber(draw);
+	evt.addWinnerToCurrentRound("153");
+	evt.addPickedNumber(90);
+	evt.addWinnerToCurrentRound("154");
+	evt.nextState();
+	evt.nextState();
+	std::ofstream file(iPath, std::ios::out | std::ios::binary);
+	evt.write(file);
+}
+}// namespace
+
+TEST(SeasonAggregator, Summary) {
+	EventSummary first;
+	first.drawsToWin[1].add(10);
+	first.rounds.add(duration{60.0});
+	first.picks[4] = 3;
+	EventSummary second;
+	second.drawsToWin[1].add(4);
+	second.rounds.add(duration{30.0});
+	second.picks[4] = 1;
+	second.picks[9] = 4;
+	first.merge(second);
+	EXPECT_EQ(first.drawsToWin[1].count, 2);
+	EXPECT_EQ(first.drawsToWin[1].least, 4);
+	EXPECT_EQ(first.drawsToWin[1].most, 10);
+	EXPECT_DOUBLE_EQ(first.drawsToWin[1].mean(), 7.0);
+	EXPECT_DOUBLE_EQ(first.rounds.shortest, 30.0);
+	EXPECT_DOUBLE_EQ(first.rounds.mean().count(), 45.0);
+	EXPECT_EQ(first.mostPicked(), (Statistics::pick_list{5, 10}));
+	EXPECT_EQ(first.leastPicked().size(), 88);
+}
+
+TEST(SeasonAggregator, Scan) {
+	const fs::path tmp = fs::temp_directory_path() / "test_season";
+	remove_all(tmp);
+	create_directories(tmp);
+	writeEvent(tmp / "first.lev", {12, 45, 7});
+	writeEvent(tmp / "second.lev", {12, 3});
+	std::ofstream(tmp / "broken.lev", std::ios::out | std::ios::binary) << "garbage";
+	std::ofstream(tmp / "notes.txt") << "not an event";
+
+	SeasonAggregator season(tmp);
+	auto report = season.scan();
+	EXPECT_EQ(report.events, 2);
+	EXPECT_EQ(report.decoded, 3);
+	EXPECT_EQ(report.failed, 1);
+	EXPECT_EQ(report.total.picks[11], 2);
+	EXPECT_EQ(report.total.picks[89], 2);
+	EXPECT_EQ(report.total.mostPicked(), (Statistics::pick_list{12, 90}));
+	const auto& oneQuine = report.total.drawsToWin[static_cast<size_t>(SubGameRound::Type::OneQuine)];
+	EXPECT_EQ(oneQuine.count, 2);
+	EXPECT_EQ(oneQuine.least, 2);
+	EXPECT_EQ(oneQuine.most, 3);
+	EXPECT_EQ(report.total.drawsToWin[static_cast<size_t>(SubGameRound::Type::FullCard)].count, 2);
+	EXPECT_EQ(report.total.rounds.count, 2);
+	EXPECT_EQ(report.total.subRounds.count, 4);
+	EXPECT_TRUE(fs::exists(tmp / SeasonAggregator::g_indexName));
+	EXPECT_FALSE(fs::exists(tmp / std::format("{}.tmp", SeasonAggregator::g_indexName)));
+
+	// nothing changed: everything comes from the index, even with a new aggregator
+	const auto total = report.total;
+	SeasonAggregator again(tmp);
+	report = again.scan();
+	EXPECT_EQ(report.decoded, 0);
+	EXPECT_EQ(report.events, 2);
+	EXPECT_EQ(report.total.picks, total.picks);
+	for (size_t kind = 0; kind < total.drawsToWin.size(); ++kind)
+		EXPECT_EQ(report.total.drawsToWin[kind].total, total.drawsToWin[kind].total);
+	EXPECT_EQ(report.total.roundDraws.total, total.roundDraws.total);
+	EXPECT_EQ(report.total.rounds.count, total.rounds.count);
+	EXPECT_DOUBLE_EQ(report.total.subRounds.total, total.subRounds.total);
+	EXPECT_DOUBLE_EQ(report.total.subRounds.longest, total.subRounds.longest);
+
+	// only the new file is decoded
+	writeEvent(tmp / "third.lev", {5});
+	report = again.scan();
+	EXPECT_EQ(report.decoded, 1);
+	EXPECT_EQ(report.events, 3);
+	EXPECT_EQ(report.total.picks[4], 1);
+
+	// a removed file leaves the season
+	fs::remove(tmp / "second.lev");
+	report = again.scan();
+	EXPECT_EQ(report.decoded, 0);
+	EXPECT_EQ(report.events, 2);
+	remove_all(tmp);
+}
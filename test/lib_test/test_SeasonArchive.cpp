@@ -0,0 +1,148 @@
+/**
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "../TestMainHelper.h"
+
+#include "core/SeasonArchive.h"
+
+using namespace evl::core;
+namespace fs = std::filesystem;
+
+namespace {
+auto makeGame(const std::string& iName, const size_t iRounds) -> Event {
+	Event evt;
+	evt.setName(iName);
+	evt.setOrganizerName("Comité");
+	evt.setLocation("Salle " + iName);
+	for (size_t i = 0; i < iRounds; ++i) evt.pushGameRound(GameRound(GameRound::Type::OneQuineFullCard));
+	evt.nextState();
+	evt.nextState();
+	evt.addPickedNumber(42);
+	return evt;
+}
+
+auto makeArchive(const fs::path& iFile, const size_t iCount) -> bool {
+	SeasonArchiveWriter writer;
+	for (size_t i = 0; i < iCount; ++i) writer.add(makeGame(std::format("Loto {}", i), i + 1));
+	return writer.write(iFile);
+}
+}// namespace
+
+TEST(SeasonArchive, Index) {
+	const fs::path tmp = fs::temp_directory_path() / "evl_archive_index";
+	create_directories(tmp);
+	const fs::path file = tmp / "saison.lsa";
+	ASSERT_TRUE(makeArchive(file, 5));
+	EXPECT_FALSE(exists(tmp / "saison.lsa.tmp"));
+
+	SeasonArchive archive;
+	ASSERT_TRUE(archive.open(file));
+	ASSERT_EQ(archive.size(), 5);
+	EXPECT_EQ(archive.getDecodeCount(), 0);
+	const Event expected = makeGame("Loto 3", 4);
+	const auto& header = archive.getHeader(3);
+	EXPECT_EQ(header.name, "Loto 3");
+	EXPECT_EQ(header.location, "Salle Loto 3");
+	EXPECT_EQ(header.roundCount, 4);
+	EXPECT_EQ(header.status, expected.getStatus());
+	EXPECT_EQ(archive.getDecodeCount(), 0);
+
+	const auto event = archive.getEvent(3);
+	ASSERT_NE(event, nullptr);
+	EXPECT_EQ(event->getName(), "Loto 3");
+	EXPECT_EQ(event->sizeRounds(), 4);
+	EXPECT_EQ(event->getStarting(), header.start);
+	EXPECT_EQ(event->beginRounds()->getAllDraws(), std::vector<uint8_t>{42});
+	EXPECT_EQ(archive.getDecodeCount(), 1);
+	EXPECT_EQ(archive.getEvent(3), event);
+	EXPECT_EQ(archive.getDecodeCount(), 1);
+	EXPECT_EQ(archive.getEvent(5), nullptr);
+	archive.close();
+	remove_all(tmp);
+}
+
+TEST(SeasonArchive, Cache) {
+	const fs::path tmp = fs::temp_directory_path() / "evl_archive_cache";
+	create_directories(tmp);
+	const fs::path file = tmp / "saison.lsa";
+	ASSERT_TRUE(makeArchive(file, 4));
+
+	SeasonArchive archive(2);
+	ASSERT_TRUE(archive.open(file));
+	const auto first = archive.getEvent(0);
+	archive.getEvent(1);
+	archive.getEvent(0);// most recent again
+	archive.getEvent(2);// evicts 1
+	EXPECT_EQ(archive.getDecodeCount(), 3);
+	EXPECT_EQ(archive.getEvent(0), first);
+	EXPECT_EQ(archive.getDecodeCount(), 3);
+	archive.getEvent(1);
+	EXPECT_EQ(archive.getDecodeCount(), 4);
+	// an event given out stays alive after its eviction
+	archive.getEvent(3);
+	EXPECT_EQ(first->getName(), "Loto 0");
+	archive.close();
+	remove_all(tmp);
+}
+
+TEST(SeasonArchive, Append) {
+	const fs::path tmp = fs::temp_directory_path() / "evl_archive_append";
+	create_directories(tmp);
+	const fs::path file = tmp / "saison.lsa";
+	ASSERT_TRUE(makeArchive(file, 2));
+	{
+		SeasonArchive archive;
+		ASSERT_TRUE(archive.open(file));
+		SeasonArchiveWriter writer;
+		for (size_t i = 0; i < archive.size(); ++i) writer.add(archive, i);
+		writer.add(makeGame("Nouveau", 2));
+		ASSERT_TRUE(writer.write(file));
+		EXPECT_EQ(archive.getDecodeCount(), 0);
+	}
+	SeasonArchive archive;
+	ASSERT_TRUE(archive.open(file));
+	ASSERT_EQ(archive.size(), 3);
+	EXPECT_EQ(archive.getHeader(1).name, "Loto 1");
+	ASSERT_NE(archive.getEvent(1), nullptr);
+	EXPECT_EQ(archive.getEvent(1)->sizeRounds(), 2);
+	EXPECT_EQ(archive.getEvent(2)->getName(), "Nouveau");
+	archive.close();
+	remove_all(tmp);
+}
+
+TEST(SeasonArchive, Corrupted) {
+	const fs::path tmp = fs::temp_directory_path() / "evl_archive_corrupted";
+	create_directories(tmp);
+	const fs::path file = tmp / "saison.lsa";
+	ASSERT_TRUE(makeArchive(file, 2));
+	std::string content;
+	{
+		std::ifstream in(file, std::ios::binary);
+		content.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+	}
+	const auto rewrite = [&](const std::string& iContent) {
+		std::ofstream out(file, std::ios::binary | std::ios::trunc);
+		out.write(iContent.data(), static_cast<std::streamsize>(iContent.size()));
+	};
+	SeasonArchive archive;
+	// a byte of the first event changed: the index is still valid, the event is refused
+	auto modified = content;
+	modified[40] = static_cast<char>(modified[40] ^ 0x5A);
+	rewrite(modified);
+	ASSERT_TRUE(archive.open(file));
+	EXPECT_EQ(archive.getEvent(0), nullptr);
+	EXPECT_NE(archive.getEvent(1), nullptr);
+	archive.close();
+	// truncated index
+	rewrite(content.substr(0, content.size() - 4));
+	EXPECT_FALSE(archive.open(file));
+	EXPECT_FALSE(archive.isOpen());
+	// not an archive
+	rewrite("not an archive at all, really not");
+	EXPECT_FALSE(archive.open(file));
+	EXPECT_FALSE(archive.open(tmp / "missing.lsa"));
+	remove_all(tmp);
+}
@@ -6,7 +6,10 @@
  * All modification must get authorization from the author.
  */
 #include "../TestMainHelper.h"
+#include "core/RandomNumberGenerator.h"
 #include "core/Settings.h"
+#include "core/SettingsSaver.h"
+#include "core/SettingsSection.h"
 
 using namespace evl::core;
 
@@ -173,3 +176,201 @@ TEST(core_Settings, Extract) {
 	EXPECT_FALSE(audioSettings.contains("graphics/resolution/width"));
 	EXPECT_FALSE(audioSettings.contains("graphics/resolution/height"));
 }
+
+TEST(core_Settings, Generation) {
+	Settings settings;
+	const auto start = settings.getGeneration("gui");
+	settings.setValue("theme/color", 1);
+	EXPECT_EQ(settings.getGeneration("gui"), start);
+	settings.setValue("gui/title_scale", 2.0f);
+	const auto touched = settings.getGeneration("gui");
+	EXPECT_GT(touched, start);
+	settings.remove("gui/unknown");
+	EXPECT_EQ(settings.getGeneration("gui"), touched);
+	settings.remove("gui/title_scale");
+	EXPECT_GT(settings.getGeneration("gui"), touched);
+	const auto before = settings.getGeneration("gui");
+	settings.clear();
+	EXPECT_GT(settings.getGeneration("gui"), before);
+	EXPECT_GT(settings.getGeneration("other"), before);
+}
+
+TEST(core_Settings, Snapshot) {
+	Settings settings;
+	settings.setValue("gui/title_scale", 2.0f);
+	settings.setValue("gui/fade_amount", 5);
+	settings.setValue("gui/text_color", evl::math::vec4{1.f, 0.f, 0.f, 1.f});
+	SettingsSnapshot<GuiSettings> snapshot;
+	const auto* gui = &snapshot.get(settings);
+	EXPECT_FLOAT_EQ(gui->titleScale, 2.0f);
+	EXPECT_EQ(gui->fadeAmount, 5);
+	EXPECT_FLOAT_EQ(gui->timeScale, 1.6f);
+	ASSERT_TRUE(gui->textColor.has_value());
+	EXPECT_FLOAT_EQ(gui->textColor->x(), 1.f);
+	EXPECT_FALSE(gui->backgroundColor.has_value());
+	// unchanged section: nothing reloaded
+	settings.setValue("theme/color", 1);
+	EXPECT_EQ(&snapshot.get(settings), gui);
+	EXPECT_EQ(snapshot.getLoadCount(), 1);
+	// changed section
+	settings.setValue("gui/title_scale", 3.0);
+	EXPECT_FLOAT_EQ(snapshot.get(settings).titleScale, 3.0f);
+	EXPECT_EQ(snapshot.getLoadCount(), 2);
+	settings.remove("gui/text_color");
+	EXPECT_FALSE(snapshot.get(settings).textColor.has_value());
+	EXPECT_EQ(snapshot.getLoadCount(), 3);
+}
+
+TEST(core_Settings, Tree) {
+	Settings settings;
+	settings.setValue("gui/title_scale", 2.0f);
+	settings.setValue("gui-old/title_scale", 1.0f);
+	settings.setValue("gui/grid/spacing", evl::math::vec2{4.f, 4.f});
+	settings.setValue("gui/grid", 3);// dropped: "gui/grid" is a group
+	settings.setValue("gui/a", true);
+	settings.setValue("zeta", std::string("fin"));
+	for (int i = 0; i < 1000; ++i) settings.setValue(std::format("many/group{}/value{}", i % 10, i), i);
+
+	const Settings gui = settings.extract("gui");
+	EXPECT_EQ(gui.size(), 4);
+	EXPECT_TRUE(gui.contains("grid/spacing"));
+	EXPECT_EQ(settings.extract("many/group3").size(), 100);
+
+	const fs::path file = fs::temp_directory_path() / "evl_settings_tree.yml";
+	ASSERT_TRUE(settings.toFile(file));
+	Settings loaded;
+	loaded.fromFile(file);
+	EXPECT_EQ(loaded.size(), settings.size() - 1);
+	EXPECT_FALSE(loaded.contains("gui/grid"));
+	EXPECT_NEAR(loaded.getValue<float>("gui-old/title_scale"), 1.0f, 1e-6);
+	EXPECT_NEAR(loaded.getValue<float>("gui/title_scale"), 2.0f, 1e-6);
+	EXPECT_EQ(loaded.getValue<bool>("gui/a"), true);
+	EXPECT_EQ(loaded.getValue<std::string>("zeta"), "fin");
+	EXPECT_EQ(loaded.getValue<int>("many/group7/value997"), 997);
+	fs::remove(file);
+}
+
+TEST(core_Settings, Saver) {
+	const fs::path file = fs::temp_directory_path() / "evl_settings_saver.yml";
+	fs::remove(file);
+	Settings settings;
+	{
+		SettingsSaver saver(file, std::chrono::milliseconds{50});
+		for (int i = 1; i <= 5; ++i) {
+			settings.setValue("general/count", i);
+			saver.save(settings);
+		}
+		saver.flush();
+		EXPECT_EQ(saver.getWriteCount(), 1);
+		Settings loaded;
+		loaded.fromFile(file);
+		EXPECT_EQ(loaded.getValue<int>("general/count"), 5);
+
+		// written after the delay
+		settings.setValue("general/count", 6);
+		saver.save(settings);
+		for (int i = 0; i < 200 && saver.getWriteCount() < 2; ++i)
+			std::this_thread::sleep_for(std::chrono::milliseconds{10});
+		EXPECT_EQ(saver.getWriteCount(), 2);
+
+		// written by the destructor
+		settings.setValue("general/count", 7);
+		saver.save(settings);
+	}
+	Settings loaded;
+	loaded.fromFile(file);
+	EXPECT_EQ(loaded.getValue<int>("general/count"), 7);
+	EXPECT_FALSE(fs::exists(fs::path(file) += ".tmp"));
+	fs::remove(file);
+}
+
+TEST(core_Settings, Schema) {
+	const fs::path file = fs::temp_directory_path() / "evl_settings_schema.yml";
+	{
+		std::ofstream out(file);
+		out << "general:\n  use_imgui: Off\n  log_level: 4\n"
+			<< "gui:\n  title_scale: 4\n  time_scale: large\n  fade_amount: 150\n"
+			<< "  grid_button_spacing: [2, 3]\n  selected_number_color: [1, 0.5]\n"
+			<< "  text_color: [0.5, 1.5, 0, 1]\n"
+			<< "other:\n  flag: yes\n  count: 12\n  ratio: 0.25\n  name: test\n  pair: [1, 2]\n";
+	}
+	Settings settings;
+	settings.fromFile(file);
+	fs::remove(file);
+
+	// known keys: the type of the schema
+	EXPECT_EQ(settings.tryGetValue<bool>("general/use_imgui"), false);
+	EXPECT_EQ(settings.tryGetValue<std::string>("general/log_level"), "4");
+	EXPECT_EQ(settings.tryGetValue<float>("gui/title_scale"), 4.0f);
+	EXPECT_EQ(settings.tryGetValue<int>("gui/fade_amount"), 90);// clamped
+	const auto spacing = settings.tryGetValue<evl::math::vec2>("gui/grid_button_spacing");
+	ASSERT_TRUE(spacing.has_value());
+	EXPECT_NEAR(spacing->y(), 3.0f, 1e-6);
+	const auto color = settings.tryGetValue<evl::math::vec4>("gui/text_color");
+	ASSERT_TRUE(color.has_value());
+	EXPECT_NEAR(color->y(), 1.0f, 1e-6);// clamped
+	// invalid values are ignored
+	EXPECT_FALSE(settings.contains("gui/time_scale"));
+	EXPECT_FALSE(settings.contains("gui/selected_number_color"));
+
+	// unknown keys: the type is guessed
+	EXPECT_EQ(settings.tryGetValue<bool>("other/flag"), true);
+	EXPECT_EQ(settings.tryGetValue<int>("other/count"), 12);
+	EXPECT_EQ(settings.tryGetValue<float>("other/ratio"), 0.25f);
+	EXPECT_EQ(settings.tryGetValue<std::string>("other/name"), "test");
+	EXPECT_TRUE(settings.tryGetValue<evl::math::vec2>("other/pair").has_value());
+}
+
+TEST(core_Settings, SchemaDefaults) {
+	// the defaults of the schema are the ones of the display
+	Settings settings;
+	for (const auto& [key, definition]: getSettingsSchema().getDefinitions()) {
+		if (definition.defaultValue.has_value())
+			settings.setValue(key, definition.defaultValue);
+	}
+	const GuiSettings defaults;
+	GuiSettings gui;
+	gui.load(settings);
+	EXPECT_EQ(gui.titleScale, defaults.titleScale);
+	EXPECT_EQ(gui.gridTextScale, defaults.gridTextScale);
+	EXPECT_EQ(gui.gridSpacing, defaults.gridSpacing);
+	EXPECT_EQ(gui.selectedNumberColor, defaults.selectedNumberColor);
+	EXPECT_FALSE(gui.textColor.has_value());
+	EXPECT_EQ(gui.fadeAmount, defaults.fadeAmount);
+	EXPECT_EQ(gui.truncatePriceLines, defaults.truncatePriceLines);
+	EXPECT_EQ(settings.getValue<std::string>("general/log_level"), "info");
+	const auto engine = magic_enum::enum_cast<RandomNumberGenerator::Engine>(
+			settings.getValue<std::string>("general/rng_engine"));
+	EXPECT_EQ(engine, RandomNumberGenerator::Engine::Pcg);
+}
+
+TEST(core_Settings, Update) {
+	Settings settings;
+	settings.setValue("gui/title_scale", 4.0f);
+	settings.setValue("gui/fade_numbers", true);
+	settings.setValue("theme/Text", evl::math::vec4{1.f, 1.f, 1.f, 1.f});
+	settings.setValue("general/data_location", fs::path("data"));
+	const auto theme = settings.getGeneration("theme");
+	const auto general = settings.getGeneration("general");
+
+	Settings shadow;
+	shadow.setValue("gui/title_scale", 5.0f);
+	shadow.setValue("gui/fade_numbers", true);
+	shadow.setValue("gui/new_key", 2);
+	shadow.setValue("theme/Text", evl::math::vec4{1.f, 1.f, 1.f, 1.f});
+	shadow.setValue("general/data_location", std::string("data"));// as read from the file
+	const auto keys = settings.update(shadow);
+	EXPECT_EQ(keys, (std::vector<std::string>{"gui/new_key", "gui/title_scale"}));
+	EXPECT_EQ(settings.getValue<float>("gui/title_scale"), 5.0f);
+	EXPECT_EQ(settings.getGeneration("theme"), theme);
+	EXPECT_EQ(settings.getGeneration("general"), general);
+	EXPECT_TRUE(settings.update(shadow).empty());
+
+	// only the existing keys, with a prefix
+	Settings themeFile;
+	themeFile.setValue("Text", evl::math::vec4{0.f, 0.f, 0.f, 1.f});
+	themeFile.setValue("name", std::string("dark"));
+	EXPECT_EQ(settings.update(themeFile, "theme", true), std::vector<std::string>{"theme/Text"});
+	EXPECT_FALSE(settings.contains("theme/name"));
+	EXPECT_NE(settings.getGeneration("theme"), theme);
+}
@@ -0,0 +1,72 @@
+/**
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "../TestMainHelper.h"
+
+#include "core/Simulator.h"
+
+using namespace evl::core;
+
+namespace {
+auto makeGame() -> Event {
+	Event evt;
+	evt.setName("simulation");
+	evt.setOrganizerName("toto");
+	evt.pushGameRound(GameRound(GameRound::Type::OneTwoQuineFullCard));
+	evt.pushGameRound(GameRound(GameRound::Type::Pause));
+	evt.pushGameRound(GameRound(GameRound::Type::Inverse));
+	return evt;
+}
+}// namespace
+
+TEST(Simulator, Distribution) {
+	const Event evt = makeGame();
+	Simulator::Options options;
+	options.cards = 200;
+	options.runs = 300;
+	options.seed = 12;
+	options.threads = 4;
+	const auto result = Simulator(evt, options).run();
+	EXPECT_EQ(result.runs, 300);
+	ASSERT_EQ(result.types.size(), 4);
+	const auto& quine = result.types.at(SubGameRound::Type::OneQuine);
+	const auto& full = result.types.at(SubGameRound::Type::FullCard);
+	EXPECT_EQ(quine.samples, 300);
+	EXPECT_EQ(full.samples, 300);
+	EXPECT_EQ(result.types.at(SubGameRound::Type::Inverse).samples, 300);
+	EXPECT_GE(quine.minDraws, 5);
+	EXPECT_LE(full.maxDraws, 90);
+	EXPECT_LT(quine.meanDraws, full.meanDraws + 45.0);
+	uint64_t histogramTotal = 0;
+	for (const auto count: full.drawHistogram) histogramTotal += count;
+	EXPECT_EQ(histogramTotal, full.samples);
+	EXPECT_GE(quine.p90Duration, quine.meanDuration * 0.5);
+	EXPECT_LE(result.medianDuration, result.p90Duration);
+	EXPECT_GT(result.meanDuration.count(), 0.0);
+	EXPECT_GT(result.totalDraws, 0);
+}
+
+TEST(Simulator, Deterministic) {
+	const Event evt = makeGame();
+	Simulator::Options options;
+	options.cards = 100;
+	options.runs = 100;
+	options.seed = 5;
+	options.threads = 1;
+	const auto single = Simulator(evt, options).run();
+	options.threads = 3;
+	const auto multi = Simulator(evt, options).run();
+	EXPECT_EQ(single.totalDraws, multi.totalDraws);
+	for (const auto& [type, stats]: single.types) EXPECT_EQ(stats.drawHistogram, multi.types.at(type).drawHistogram);
+	EXPECT_DOUBLE_EQ(single.p90Duration.count(), multi.p90Duration.count());
+}
+
+TEST(Simulator, Empty) {
+	const Event evt;
+	const auto result = Simulator(evt, {}).run();
+	EXPECT_EQ(result.runs, 0);
+	EXPECT_TRUE(result.types.empty());
+}
@@ -10,6 +10,7 @@
 
 #include <core/utilities.h>
 #include <fstream>
+#include <thread>
 
 using namespace evl::core;
 
@@ -86,3 +87,38 @@ TEST(SubGameRound, serialize) {
 	EXPECT_NEAR(partie2.getValue(), 152.12, 0.001);
 	remove_all(tmp);
 }
+
+TEST(SubGameRound, drawTimes) {
+	SubGameRound partie(SubGameRound::Type::OneQuine);
+	partie.nextStatus();
+	partie.addPickedNumber(12);
+	std::this_thread::sleep_for(std::chrono::milliseconds(20));
+	partie.addPickedNumber(45);
+	partie.addPickedNumber(7);
+	ASSERT_EQ(partie.getDrawDelays().size(), 3);
+	EXPECT_GE(partie.getDrawDelays()[1], 20);
+	EXPECT_GE(partie.getDrawTime(1), partie.getStarting() + std::chrono::milliseconds(20));
+	EXPECT_LE(partie.getDrawTime(1), partie.getDrawTime(2));
+	partie.removeLastPick();
+	EXPECT_EQ(partie.getDrawDelays().size(), 2);
+
+	std::stringstream stream(std::ios::in | std::ios::out | std::ios::binary);
+	partie.write(stream);
+	SubGameRound partie2;
+	partie2.read(stream, getSaveVersion());
+	EXPECT_EQ(partie2.getDrawDelays(), partie.getDrawDelays());
+	EXPECT_EQ(partie2.getDrawTime(1), partie.getDrawTime(1));
+
+	// files without timestamps: unknown delays are null
+	stream.clear();
+	stream.seekg(0);
+	SubGameRound partie3;
+	partie3.read(stream, 7);
+	EXPECT_EQ(partie3.getDraws(), partie.getDraws());
+	EXPECT_EQ(partie3.getDrawDelays(), (SubGameRound::delays_type{0, 0}));
+
+	const auto json = partie.toJson();
+	SubGameRound partie4;
+	partie4.fromJson(json);
+	EXPECT_EQ(partie4.getDrawDelays(), partie.getDrawDelays());
+}
@@ -0,0 +1,51 @@
+/**
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "../TestMainHelper.h"
+
+#include "core/SurvivorSet.h"
+
+using namespace evl::core;
+
+TEST(SurvivorSet, AddRemove) {
+	SurvivorSet set;
+	EXPECT_TRUE(set.empty());
+	EXPECT_TRUE(set.add(5));
+	EXPECT_FALSE(set.add(5));
+	EXPECT_TRUE(set.add(70000));
+	EXPECT_TRUE(set.add(3));
+	EXPECT_EQ(set.size(), 3);
+	EXPECT_EQ(set.containerCount(), 2);
+	EXPECT_TRUE(set.contains(70000));
+	EXPECT_FALSE(set.contains(70001));
+	EXPECT_EQ(set.toVector(), (std::vector<SurvivorSet::value_type>{3, 5, 70000}));
+	EXPECT_EQ(set.toVector(2), (std::vector<SurvivorSet::value_type>{3, 5}));
+	EXPECT_TRUE(set.remove(70000));
+	EXPECT_FALSE(set.remove(70000));
+	EXPECT_FALSE(set.remove(123456));
+	EXPECT_EQ(set.containerCount(), 1);
+	set.clear();
+	EXPECT_TRUE(set.empty());
+}
+
+TEST(SurvivorSet, ContainerForms) {
+	SurvivorSet set;
+	set.fill(135000);
+	EXPECT_EQ(set.size(), 135000);
+	EXPECT_EQ(set.containerCount(), 3);
+	EXPECT_EQ(set.bitmapContainerCount(), 2);
+	EXPECT_TRUE(set.contains(134999));
+	EXPECT_FALSE(set.contains(135000));
+	// Shrink the first container under the array threshold.
+	for (SurvivorSet::value_type value = 0; value < 65536 - SurvivorSet::g_arrayMaxSize; ++value)
+		EXPECT_TRUE(set.remove(value));
+	EXPECT_EQ(set.bitmapContainerCount(), 1);
+	EXPECT_EQ(set.toVector(1).front(), 65536 - SurvivorSet::g_arrayMaxSize);
+	EXPECT_TRUE(set.add(0));
+	EXPECT_EQ(set.bitmapContainerCount(), 2);
+	EXPECT_EQ(set.toVector(1).front(), 0);
+	EXPECT_EQ(set.size(), 135000 - (65536 - SurvivorSet::g_arrayMaxSize) + 1);
+}
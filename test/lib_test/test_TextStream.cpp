@@ -0,0 +1,271 @@
+/**
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "../TestMainHelper.h"
+
+#include "core/Event.h"
+#include "core/TextStream.h"
+
+using namespace evl::core;
+namespace fs = std::filesystem;
+
+namespace {
+auto makeGame() -> Event {
+	Event evt;
+	evt.setName("Loto \"de la\" fête");
+	evt.setOrganizerName("Comité\tdes fêtes");
+	evt.setLocation("Salle des fêtes");
+	evt.setRules("Un carton par personne\nPas de triche \\o/");
+	evt.pushGameRound(GameRound(GameRound::Type::OneQuineFullCard));
+	evt.pushGameRound(GameRound(GameRound::Type::Inverse));
+	evt.getGameRound(0)->getSubRound(1)->define(SubGameRound::Type::FullCard, "un jambon\nune bouteille", 25.5);
+	evt.nextState();
+	evt.nextState();
+	for (const uint8_t draw: {12, 45, 7}) evt.addPickedNumber(draw);
+	evt.addWinnerToCurrentRound("153");
+	evt.addPickedNumber(90);
+	return evt;
+}
+
+void expectSameEvent(const Event& iExpected, const Event& iActual) {
+	EXPECT_EQ(iActual.getName(), iExpected.getName());
+	EXPECT_EQ(iActual.getOrganizerName(), iExpected.getOrganizerName());
+	EXPECT_EQ(iActual.getLocation(), iExpected.getLocation());
+	EXPECT_EQ(iActual.getRules(), iExpected.getRules());
+	EXPECT_EQ(iActual.getStatus(), iExpected.getStatus());
+	EXPECT_EQ(iActual.getStarting(), iExpected.getStarting());
+	ASSERT_EQ(iActual.sizeRounds(), iExpected.sizeRounds());
+	for (auto expected = iExpected.beginRounds(), actual = iActual.beginRounds(); expected != iExpected.endRounds();
+		 ++expected, ++actual) {
+		EXPECT_EQ(actual->getType(), expected->getType());
+		EXPECT_EQ(actual->getStatus(), expected->getStatus());
+		EXPECT_EQ(actual->getStarting(), expected->getStarting());
+		EXPECT_EQ(actual->getAllDraws(), expected->getAllDraws());
+		ASSERT_EQ(actual->sizeSubRound(), expected->sizeSubRound());
+		for (auto subExp = expected->beginSubRound(), sub = actual->beginSubRound(); subExp != expected->endSubRound();
+			 ++subExp, ++sub) {
+			EXPECT_EQ(sub->getType(), subExp->getType());
+			EXPECT_EQ(sub->getStatus(), subExp->getStatus());
+			EXPECT_EQ(sub->getWinner(), subExp->getWinner());
+			EXPECT_EQ(sub->getPrices(), subExp->getPrices());
+			EXPECT_EQ(sub->getValue(), subExp->getValue());
+			EXPECT_EQ(sub->getDraws(), subExp->getDraws());
+			EXPECT_EQ(sub->getDrawDelays(), subExp->getDrawDelays());
+			EXPECT_EQ(sub->getStarting(), subExp->getStarting());
+		}
+	}
+	EXPECT_EQ(iActual.getCurrentGameRoundIndex(), iExpected.getCurrentGameRoundIndex());
+}
+
+auto readTokens(TextReader& ioReader) -> std::string {
+	std::string result;
+	while (true) {
+		switch (ioReader.next()) {
+			case TextReader::Token::BeginMap:
+				result += '{';
+				break;
+			case TextReader::Token::EndMap:
+				result += '}';
+				break;
+			case TextReader::Token::BeginSeq:
+				result += '[';
+				break;
+			case TextReader::Token::EndSeq:
+				result += ']';
+				break;
+			case TextReader::Token::Scalar:
+				result += std::format("<{}>", ioReader.text());
+				break;
+			case TextReader::Token::End:
+				return result;
+			case TextReader::Token::Error:
+				return result + "!";
+		}
+	}
+}
+
+auto readJson(const std::string& iText) -> std::string {
+	std::istringstream stream(iText);
+	JsonReader reader(stream);
+	return readTokens(reader);
+}
+}// namespace
+
+TEST(TextStream, JsonWriter) {
+	std::ostringstream stream;
+	JsonWriter writer(stream);
+	writer.beginMap();
+	writer.putString("name", "a \"b\"\n\\c\x01");
+	writer.putInteger("count", -3);
+	writer.putDouble("value", 0.1);
+	writer.key("list");
+	writer.beginSeq(true);
+	writer.integer(1);
+	writer.integer(2);
+	writer.endSeq();
+	writer.key("empty");
+	writer.beginMap();
+	writer.endMap();
+	writer.endMap();
+	EXPECT_TRUE(writer.good());
+	EXPECT_EQ(stream.str(), "{\n\t\"name\": \"a \\\"b\\\"\\n\\\\c\\u0001\",\n\t\"count\": -3,\n\t\"value\": 0.1,\n"
+							"\t\"list\": [1, 2],\n\t\"empty\": {}\n}\n");
+}
+
+TEST(TextStream, JsonReader) {
+	EXPECT_EQ(readJson(R"({"a": [1, -2.5e3, true, null], "b": {"c": "x\"\u00e9\ud83d\ude00"}, "d": []})"),
+			  "{<a>[<1><-2.5e3><true><>]<b>{<c><x\"é😀>}<d>[]}");
+	EXPECT_EQ(readJson(" \"alone\" "), "<alone>");
+	// invalid documents
+	EXPECT_EQ(readJson(R"({"a" 1})"), "{<a>!");
+	EXPECT_EQ(readJson(R"({"a": 1,})"), "{<a><1>!");
+	EXPECT_EQ(readJson(R"([1 2])"), "[<1>!");
+	EXPECT_EQ(readJson(R"({"a": 1]})"), "{<a><1>!");
+	EXPECT_EQ(readJson(R"({a: 1})"), "{!");
+	EXPECT_EQ(readJson(R"([01x])"), "[!");
+	EXPECT_EQ(readJson(R"(["\ud83d"])"), "[!");
+	EXPECT_EQ(readJson(R"({"a": 1} 2)"), "{<a><1>}!");
+	EXPECT_EQ(readJson(R"({"a": [1)"), "{<a>[<1>!");
+	EXPECT_EQ(readJson(std::string(TextReader::g_maxDepth + 1, '[')), std::string(TextReader::g_maxDepth, '[') + "!");
+}
+
+TEST(TextStream, Skip) {
+	std::istringstream stream(R"({"x": {"y": [1, {"z": []}]}, "a": "b"})");
+	JsonReader reader(stream);
+	ASSERT_TRUE(reader.enterMap());
+	std::string key;
+	ASSERT_TRUE(reader.nextKey(key));
+	EXPECT_EQ(key, "x");
+	reader.skip();
+	ASSERT_TRUE(reader.nextKey(key));
+	EXPECT_EQ(key, "a");
+	std::string value;
+	EXPECT_TRUE(reader.readString(value));
+	EXPECT_EQ(value, "b");
+	EXPECT_FALSE(reader.nextKey(key));
+	EXPECT_FALSE(reader.hasFailed());
+	EXPECT_EQ(reader.next(), TextReader::Token::End);
+	// typed reads
+	std::istringstream numbers("[300, 1.5, \"x\"]");
+	JsonReader typed(numbers);
+	ASSERT_TRUE(typed.enterSeq());
+	uint8_t small = 0;
+	EXPECT_FALSE(typed.readInteger(small));
+	EXPECT_TRUE(typed.hasFailed());
+	EXPECT_FALSE(typed.getError().empty());
+}
+
+TEST(TextStream, YamlReader) {
+	std::istringstream stream("a: [1, 2]\nb:\n  c: texte\n  d: ~\n");
+	YamlReader reader(stream);
+	EXPECT_EQ(readTokens(reader), "{<a>[<1><2>]<b>{<c><texte><d><>}}");
+	// more tokens than a batch
+	std::string big = "[";
+	for (size_t i = 0; i < 3 * YamlReader::g_batchSize; ++i) big += std::format("{}, ", i);
+	big += "end]";
+	std::istringstream bigStream(big);
+	YamlReader bigReader(bigStream);
+	ASSERT_TRUE(bigReader.enterSeq());
+	size_t count = 0;
+	std::string value;
+	while (bigReader.nextItem() && bigReader.readString(value)) ++count;
+	EXPECT_EQ(count, 3 * YamlReader::g_batchSize + 1);
+	EXPECT_EQ(value, "end");
+	// invalid document
+	std::istringstream invalid("a: [1, 2\nb: c");
+	YamlReader invalidReader(invalid);
+	EXPECT_TRUE(readTokens(invalidReader).ends_with('!'));
+	EXPECT_TRUE(invalidReader.hasFailed());
+	// reader destroyed before the end of the document
+	std::istringstream partial(big);
+	{
+		YamlReader partialReader(partial);
+		EXPECT_EQ(partialReader.next(), TextReader::Token::BeginSeq);
+	}
+}
+
+TEST(TextStream, EventJson) {
+	const Event evt = makeGame();
+	std::stringstream stream;
+	JsonWriter writer(stream);
+	evt.writeText(writer);
+	ASSERT_TRUE(writer.good());
+	JsonReader reader(stream);
+	Event evt2;
+	ASSERT_TRUE(evt2.readText(reader));
+	expectSameEvent(evt, evt2);
+}
+
+TEST(TextStream, EventYaml) {
+	const Event evt = makeGame();
+	std::stringstream stream;
+	YamlWriter writer(stream);
+	evt.writeText(writer);
+	ASSERT_TRUE(writer.good());
+	YamlReader reader(stream);
+	Event evt2;
+	ASSERT_TRUE(evt2.readText(reader));
+	expectSameEvent(evt, evt2);
+}
+
+TEST(TextStream, EventImport) {
+	// the export of a played event imports as a template: only the configuration of the rounds
+	const Event evt = makeGame();
+	const fs::path tmp = fs::temp_directory_path() / "evl_text_import";
+	create_directories(tmp);
+	for (const auto& file: {tmp / "event.json", tmp / "event.yaml"}) {
+		ASSERT_TRUE(file.extension() == ".json" ? evt.exportJSON(file) : evt.exportYaml(file));
+		Event evt2;
+		evt2.setName("autre");
+		evt2.setOrganizerName("moi");
+		ASSERT_TRUE(file.extension() == ".json" ? evt2.importJSON(file) : evt2.importYaml(file));
+		EXPECT_EQ(evt2.getName(), "autre");
+		EXPECT_EQ(evt2.getStatus(), Event::Status::Ready);
+		ASSERT_EQ(evt2.sizeRounds(), evt.sizeRounds());
+		EXPECT_EQ(evt2.getGameRound(1)->getType(), GameRound::Type::Inverse);
+		EXPECT_EQ(evt2.getGameRound(0)->getStatus(), GameRound::Status::Ready);
+		EXPECT_TRUE(evt2.getGameRound(0)->getAllDraws().empty());
+		EXPECT_EQ(evt2.getGameRound(0)->getSubRound(0)->getWinner(), "");
+		EXPECT_EQ(evt2.getGameRound(0)->getSubRound(1)->getPrices(), "un jambon\nune bouteille");
+		EXPECT_EQ(evt2.getGameRound(0)->getSubRound(1)->getValue(), 25.5);
+	}
+	// a started event is not modified
+	Event started = makeGame();
+	EXPECT_FALSE(started.importJSON(tmp / "event.json"));
+	EXPECT_EQ(started.beginRounds()->getAllDraws(), evt.beginRounds()->getAllDraws());
+	remove_all(tmp);
+}
+
+TEST(TextStream, EventPartial) {
+	// a round template keeps the data of the event and ignores the unknown keys
+	const fs::path tmp = fs::temp_directory_path() / "evl_text_partial";
+	create_directories(tmp);
+	const fs::path file = tmp / "rounds.json";
+	{
+		std::ofstream out(file);
+		out << R"({"comment": {"x": [1]}, "rounds": [{"type": "Inverse", "Id": 4, "subGames": [)"
+			   R"({"type": "inverse", "prices": "un lot", "value": 10}]}]})";
+	}
+	Event evt;
+	evt.setName("toto");
+	ASSERT_TRUE(evt.importJSON(file));
+	EXPECT_EQ(evt.getName(), "toto");
+	ASSERT_EQ(evt.sizeRounds(), 1);
+	EXPECT_EQ(evt.getGameRound(0)->getType(), GameRound::Type::Inverse);
+	EXPECT_EQ(evt.getGameRound(0)->getId(), 4);
+	EXPECT_EQ(evt.getGameRound(0)->getSubRound(0)->getPrices(), "un lot");
+	EXPECT_EQ(evt.getGameRound(0)->getSubRound(0)->getValue(), 10);
+	// an invalid file leaves the event untouched
+	{
+		std::ofstream out(file);
+		out << R"({"name": "autre", "rounds": [{"subGames": [{"draws": [12, 91]}]}]})";
+	}
+	EXPECT_FALSE(evt.importJSON(file));
+	EXPECT_EQ(evt.getName(), "toto");
+	EXPECT_EQ(evt.sizeRounds(), 1);
+	EXPECT_FALSE(evt.importYaml(tmp / "missing.yaml"));
+	remove_all(tmp);
+}
@@ -0,0 +1,43 @@
+/**
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "../TestMainHelper.h"
+
+#include "core/ThreadPool.h"
+
+using namespace evl::core;
+
+TEST(ThreadPool, RunAll) {
+	ThreadPool pool(4);
+	EXPECT_EQ(pool.size(), 4);
+	EXPECT_EQ(pool.currentWorker(), ThreadPool::g_noWorker);
+	std::vector<size_t> done(1000, 0);
+	std::atomic<bool> validWorker = true;
+	for (size_t i = 0; i < done.size(); ++i) {
+		pool.submit([&, i] {
+			if (pool.currentWorker() >= pool.size())
+				validWorker = false;
+			done[i] = i + 1;
+		});
+	}
+	pool.wait();
+	EXPECT_TRUE(validWorker);
+	for (size_t i = 0; i < done.size(); ++i) EXPECT_EQ(done[i], i + 1);
+}
+
+TEST(ThreadPool, NestedSubmit) {
+	ThreadPool pool(3);
+	std::atomic<size_t> count = 0;
+	for (size_t i = 0; i < 10; ++i) {
+		pool.submit([&] {
+			for (size_t j = 0; j < 10; ++j) pool.submit([&] { ++count; });
+			++count;
+		});
+	}
+	pool.wait();
+	EXPECT_EQ(count, 110);
+	pool.wait();// nothing pending
+}
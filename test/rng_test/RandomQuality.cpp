@@ -0,0 +1,207 @@
+/**
+ * @file RandomQuality.cpp
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "pch.h"
+
+#include "RandomQuality.h"
+
+#include "core/Log.h"
+#include "core/Parallel.h"
+
+namespace evl::core {
+
+namespace {
+/// Minimal number of games played by a thread.
+constexpr uint64_t g_minChunk = 1024;
+/// Number of numbers in a game.
+constexpr size_t g_numbers = NumberMask::g_maxNumber;
+/// Width of a bin of the gap test.
+constexpr uint64_t g_gapWidth = 30;
+/// Number of bins of the gap test (the last one holds all the longer gaps).
+constexpr size_t g_gapBins = 11;
+
+/// Counters of a thread.
+struct Accumulator {
+	/// Count of each number as first draw.
+	std::array<uint64_t, g_numbers + 1> first{};
+	/// Count of each number at each position.
+	std::vector<uint64_t> position = std::vector<uint64_t>(g_numbers * (g_numbers + 1), 0);
+	/// Histogram of the gaps.
+	std::array<uint64_t, g_gapBins> gaps{};
+	/// Sums for the serial correlation.
+	uint64_t sumX = 0;
+	uint64_t sumY = 0;
+	uint64_t sumXX = 0;
+	uint64_t sumYY = 0;
+	uint64_t sumXY = 0;
+	uint64_t pairs = 0;
+};
+
+auto chunkSeed(const uint64_t iSeed, const size_t iChunk) -> uint64_t {
+	return iSeed + 0x9E3779B97F4A7C15ULL * (iChunk + 1);
+}
+
+/**
+ * @brief Convert a chi-square statistic to a z-score (Wilson–Hilferty).
+ * @param iChi2 The statistic.
+ * @param iFreedom The degrees of freedom.
+ * @return The z-score.
+ */
+auto chiSquareZ(const double iChi2, const double iFreedom) -> double {
+	const double variance = 2.0 / (9.0 * iFreedom);
+	return (std::cbrt(iChi2 / iFreedom) - (1.0 - variance)) / std::sqrt(variance);
+}
+
+/**
+ * @brief Chi-square statistic of counts against equiprobable cells.
+ * @param iCounts The counts.
+ * @return The statistic.
+ */
+auto uniformChiSquare(const std::span<const uint64_t> iCounts) -> double {
+	const double total = std::accumulate(iCounts.begin(), iCounts.end(), 0.0);
+	const double expected = total / static_cast<double>(iCounts.size());
+	if (expected <= 0.0)
+		return 0.0;
+	double chi2 = 0.0;
+	for (const auto count: iCounts) {
+		const double delta = static_cast<double>(count) - expected;
+		chi2 += delta * delta / expected;
+	}
+	return chi2;
+}
+
+void playGames(const RandomNumberGenerator::Engine iEngine, const uint64_t iSeed, const uint64_t iGames,
+			   Accumulator& oAcc) {
+	RandomNumberGenerator rng(true, iEngine);
+	rng.seed(iSeed);
+	std::array<uint64_t, g_numbers + 1> lastSeen{};
+	lastSeen.fill(std::numeric_limits<uint64_t>::max());
+	for (uint64_t game = 0; game < iGames; ++game) {
+		rng.resetPick();
+		uint8_t previous = rng.pick();
+		++oAcc.first[previous];
+		++oAcc.position[previous];
+		if (lastSeen[previous] != std::numeric_limits<uint64_t>::max())
+			++oAcc.gaps[std::min<uint64_t>((game - lastSeen[previous] - 1) / g_gapWidth, g_gapBins - 1)];
+		lastSeen[previous] = game;
+		for (size_t pos = 1; pos < g_numbers; ++pos) {
+			const uint8_t number = rng.pick();
+			++oAcc.position[pos * (g_numbers + 1) + number];
+			oAcc.sumX += previous;
+			oAcc.sumY += number;
+			oAcc.sumXX += static_cast<uint64_t>(previous) * previous;
+			oAcc.sumYY += static_cast<uint64_t>(number) * number;
+			oAcc.sumXY += static_cast<uint64_t>(previous) * number;
+			previous = number;
+		}
+		oAcc.pairs += g_numbers - 1;
+	}
+}
+}// namespace
+
+auto RandomQualityReport::passed(const double iLimit) const -> bool {
+	return std::abs(uniformityZ) < iLimit && std::abs(positionZ) < iLimit && std::abs(serialZ) < iLimit &&
+		   std::abs(gapZ) < iLimit;
+}
+
+auto assessRandomQuality(const RandomNumberGenerator::Engine iEngine, const uint64_t iGames, const uint64_t iSeed)
+		-> RandomQualityReport {
+	RandomQualityReport report;
+	report.engine = iEngine;
+	report.games = iGames;
+	report.draws = iGames * g_numbers;
+	if (iGames == 0)
+		return report;
+	const auto start = std::chrono::steady_clock::now();
+	const size_t chunks = chunkCount(iGames, g_minChunk);
+	std::vector<Accumulator> accumulators(chunks);
+	parallelChunks(iGames, chunks, [&](const size_t iChunk, const size_t iBegin, const size_t iEnd) {
+		playGames(iEngine, chunkSeed(iSeed, iChunk), iEnd - iBegin, accumulators[iChunk]);
+	});
+	const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	report.drawsPerSecond = static_cast<double>(report.draws) / std::max(elapsed.count(), 1e-9);
+
+	Accumulator total;
+	for (const auto& acc: accumulators) {
+		for (size_t i = 0; i < total.first.size(); ++i) total.first[i] += acc.first[i];
+		for (size_t i = 0; i < total.position.size(); ++i) total.position[i] += acc.position[i];
+		for (size_t i = 0; i < total.gaps.size(); ++i) total.gaps[i] += acc.gaps[i];
+		total.sumX += acc.sumX;
+		total.sumY += acc.sumY;
+		total.sumXX += acc.sumXX;
+		total.sumYY += acc.sumYY;
+		total.sumXY += acc.sumXY;
+		total.pairs += acc.pairs;
+	}
+
+	// uniformity of the first draws (number 0 never drawn)
+	report.uniformityZ =
+			chiSquareZ(uniformChiSquare(std::span(total.first).subspan(1)), static_cast<double>(g_numbers - 1));
+
+	// each position is a uniform draw: chi-square per position, summed; the rows and the columns of the table have
+	// fixed sums (each game draws each number once), hence (n-1)² degrees of freedom
+	double positionChi2 = 0.0;
+	for (size_t pos = 0; pos < g_numbers; ++pos)
+		positionChi2 += uniformChiSquare(std::span(total.position).subspan(pos * (g_numbers + 1) + 1, g_numbers));
+	report.positionZ = chiSquareZ(positionChi2, static_cast<double>((g_numbers - 1) * (g_numbers - 1)));
+
+	// lag-1 correlation inside the games
+	const auto n = static_cast<double>(total.pairs);
+	const auto sx = static_cast<double>(total.sumX);
+	const auto sy = static_cast<double>(total.sumY);
+	const double covariance = n * static_cast<double>(total.sumXY) - sx * sy;
+	const double varianceX = n * static_cast<double>(total.sumXX) - sx * sx;
+	const double varianceY = n * static_cast<double>(total.sumYY) - sy * sy;
+	report.serialCorrelation = covariance / std::sqrt(varianceX * varianceY);
+	report.serialZ = (report.serialCorrelation + 1.0 / static_cast<double>(g_numbers - 1)) * std::sqrt(n);
+
+	// gaps between two games with the same first number: geometric law of parameter 1/90
+	const double gapCount = std::accumulate(total.gaps.begin(), total.gaps.end(), 0.0);
+	const double stay = 1.0 - 1.0 / static_cast<double>(g_numbers);
+	double gapChi2 = 0.0;
+	for (size_t bin = 0; bin < g_gapBins; ++bin) {
+		const double low = std::pow(stay, static_cast<double>(bin * g_gapWidth));
+		const double high = bin + 1 < g_gapBins ? std::pow(stay, static_cast<double>((bin + 1) * g_gapWidth)) : 0.0;
+		const double expected = gapCount * (low - high);
+		if (expected <= 0.0)
+			continue;
+		const double delta = static_cast<double>(total.gaps[bin]) - expected;
+		gapChi2 += delta * delta / expected;
+	}
+	report.gapZ = chiSquareZ(gapChi2, static_cast<double>(g_gapBins - 1));
+
+	log_info("Qualité du générateur {}: {} tirages, z uniformité {:.2f}, position {:.2f}, série {:.2f}, écarts {:.2f}",
+			 magic_enum::enum_name(iEngine), report.draws, report.uniformityZ, report.positionZ, report.serialZ,
+			 report.gapZ);
+	return report;
+}
+
+auto measureDrawThroughput(const RandomNumberGenerator::Engine iEngine, const uint64_t iDraws) -> double {
+	const uint64_t games = iDraws / g_numbers;
+	if (games == 0)
+		return 0.0;
+	const auto start = std::chrono::steady_clock::now();
+	const size_t chunks = chunkCount(games, g_minChunk);
+	std::vector<uint64_t> checksums(chunks, 0);
+	parallelChunks(games, chunks, [&](const size_t iChunk, const size_t iBegin, const size_t iEnd) {
+		RandomNumberGenerator rng(true, iEngine);
+		rng.seed(chunkSeed(0, iChunk));
+		uint64_t checksum = 0;
+		for (size_t game = iBegin; game < iEnd; ++game) {
+			rng.resetPick();
+			for (size_t pos = 0; pos < g_numbers; ++pos) checksum = checksum * 31 + rng.pick();
+		}
+		checksums[iChunk] = checksum;
+	});
+	const std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+	const double rate = static_cast<double>(games * g_numbers) / std::max(elapsed.count(), 1e-9);
+	log_info("Débit du générateur {}: {:.0f} tirages/s (somme de contrôle {})", magic_enum::enum_name(iEngine), rate,
+			 std::reduce(checksums.begin(), checksums.end(), uint64_t{0}));
+	return rate;
+}
+
+}// namespace evl::core
@@ -0,0 +1,67 @@
+/**
+ * @file RandomQuality.h
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#pragma once
+
+#include "core/RandomNumberGenerator.h"
+
+#include <cstdint>
+
+namespace evl::core {
+
+/**
+ * @brief Result of the statistical tests of a draw generator.
+ *
+ * Each test is summarized as a z-score: near 0 for an unbiased generator, its absolute value rarely above 4.
+ * Chi-square statistics are converted with the Wilson–Hilferty approximation.
+ */
+struct RandomQualityReport {
+	/// The tested engine.
+	RandomNumberGenerator::Engine engine = RandomNumberGenerator::Engine::Pcg;
+	/// Number of complete games (90 draws each).
+	uint64_t games = 0;
+	/// Total number of draws.
+	uint64_t draws = 0;
+	/// Uniformity of the first draw of the games (chi-square, 89 degrees of freedom).
+	double uniformityZ = 0.0;
+	/// Uniformity of each number at each position of the games (chi-square, 89² degrees of freedom).
+	double positionZ = 0.0;
+	/// Correlation between consecutive draws of a game (-1/89 expected for a uniform permutation).
+	double serialCorrelation = 0.0;
+	/// Deviation of the serial correlation.
+	double serialZ = 0.0;
+	/// Distribution of the gaps between two games starting with the same number (chi-square).
+	double gapZ = 0.0;
+	/// Throughput of the draws (statistics included), all threads together.
+	double drawsPerSecond = 0.0;
+
+	/**
+	 * @brief Check that all the tests are within the limit.
+	 * @param iLimit The maximal absolute z-score.
+	 * @return True if the generator passes all the tests.
+	 */
+	[[nodiscard]] auto passed(double iLimit = 5.0) const -> bool;
+};
+
+/**
+ * @brief Play complete games on all the cores and run the statistical tests on the draws.
+ * @param iEngine The engine to test.
+ * @param iGames The number of games.
+ * @param iSeed The seed (each thread derives its own).
+ * @return The report.
+ */
+auto assessRandomQuality(RandomNumberGenerator::Engine iEngine, uint64_t iGames, uint64_t iSeed) -> RandomQualityReport;
+
+/**
+ * @brief Measure the raw draw throughput of an engine on all the cores.
+ * @param iEngine The engine to measure.
+ * @param iDraws The number of draws.
+ * @return The number of draws per second.
+ */
+auto measureDrawThroughput(RandomNumberGenerator::Engine iEngine, uint64_t iDraws) -> double;
+
+}// namespace evl::core
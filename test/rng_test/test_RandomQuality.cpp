@@ -0,0 +1,59 @@
+/**
+ * @author Silmaen
+ * @date 17/10/2026
+ * Copyright © 2026 All rights reserved.
+ * All modification must get authorization from the author.
+ */
+#include "../TestMainHelper.h"
+
+#include "RandomQuality.h"
+
+using namespace evl::core;
+
+namespace {
+/**
+ * @brief Number of games per engine: EVL_RNG_GAMES if defined (for long runs), small enough for the CI otherwise.
+ * @return The number of games.
+ */
+auto gameCount() -> uint64_t {
+	//NOLINTBEGIN
+	if (const char* games = std::getenv("EVL_RNG_GAMES"); games != nullptr)
+		return std::strtoull(games, nullptr, 10);
+	//NOLINTEND
+	return 200000;
+}
+
+constexpr std::array g_engines{RandomNumberGenerator::Engine::Pcg, RandomNumberGenerator::Engine::Xoshiro,
+							   RandomNumberGenerator::Engine::ChaCha20};
+}// namespace
+
+TEST(RandomQuality, Engines) {
+	for (const auto engine: g_engines) {
+		const auto report = assessRandomQuality(engine, gameCount(), 2026);
+		std::cout << std::format("engine {}: {} draws, {:.3g} draws/s | z: uniformity {:.2f}, position {:.2f}, "
+								 "serial {:.2f} (r = {:.5f}), gap {:.2f}\n",
+								 static_cast<int>(engine), report.draws, report.drawsPerSecond, report.uniformityZ,
+								 report.positionZ, report.serialZ, report.serialCorrelation, report.gapZ);
+		EXPECT_EQ(report.draws, gameCount() * 90);
+		EXPECT_TRUE(report.passed());
+	}
+}
+
+TEST(RandomQuality, Throughput) {
+	for (const auto engine: g_engines) {
+		const double rate = measureDrawThroughput(engine, gameCount() * 90);
+		std::cout << std::format("engine {}: {:.3g} draws/s\n", static_cast<int>(engine), rate);
+		EXPECT_GT(rate, 0.0);
+	}
+}
+
+TEST(RandomQuality, Report) {
+	RandomQualityReport report;
+	EXPECT_TRUE(report.passed());
+	report.gapZ = -6.0;
+	EXPECT_FALSE(report.passed());
+	EXPECT_TRUE(report.passed(7.0));
+	const auto empty = assessRandomQuality(RandomNumberGenerator::Engine::Pcg, 0, 1);
+	EXPECT_EQ(empty.draws, 0);
+	EXPECT_EQ(measureDrawThroughput(RandomNumberGenerator::Engine::Pcg, 10), 0.0);
+}